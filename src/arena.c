@@ -0,0 +1,237 @@
+#include "arena.h"
+
+/**
+ *
+ * @function salam_arena_create
+ * @brief Create an arena, everything allocated from it is freed at once by
+ * salam_arena_destroy
+ * @params {size_t} chunk_size - Size of a chunk, 0 for SALAM_ARENA_CHUNK_SIZE
+ * @returns {salam_arena_t*}
+ *
+ */
+salam_arena_t *salam_arena_create(size_t chunk_size) {
+    DEBUG_ME;
+    salam_arena_t *arena = memory_allocate(sizeof(salam_arena_t));
+
+    arena->chunks = NULL;
+    arena->chunk_size = SALAM_ARENA_ALIGN(
+        chunk_size == 0 ? SALAM_ARENA_CHUNK_SIZE : chunk_size);
+
+    arena->allocated = 0;
+    arena->reserved = 0;
+
+    return arena;
+}
+
+/**
+ *
+ * @function salam_arena_chunk_create
+ * @brief Add a chunk to the arena
+ * @params {salam_arena_t*} arena - Arena
+ * @params {size_t} capacity - Bytes the chunk must hold
+ * @params {bool} current - Whether the chunk becomes the one being filled, or
+ * is only kept for a large allocation
+ * @returns {salam_arena_chunk_t*}
+ *
+ */
+salam_arena_chunk_t *salam_arena_chunk_create(salam_arena_t *arena,
+                                              size_t capacity, bool current) {
+    DEBUG_ME;
+    salam_arena_chunk_t *chunk = memory_allocate(
+        SALAM_ARENA_ALIGN(sizeof(salam_arena_chunk_t)) + capacity);
+
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    chunk->last = 0;
+
+    // A large allocation goes behind the current chunk, so the free space
+    // left in it is still used
+    if (current || arena->chunks == NULL) {
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    } else {
+        chunk->next = arena->chunks->next;
+        arena->chunks->next = chunk;
+    }
+
+    arena->reserved += capacity;
+
+    return chunk;
+}
+
+/**
+ *
+ * @function salam_arena_allocate
+ * @brief Allocate memory from an arena, or from the heap if arena is NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {size_t} size - Size in bytes
+ * @returns {void*}
+ *
+ */
+void *salam_arena_allocate(salam_arena_t *arena, size_t size) {
+    DEBUG_ME;
+    if (arena == NULL) {
+        return memory_allocate(size);
+    }
+
+    size_t aligned = SALAM_ARENA_ALIGN(size == 0 ? 1 : size);
+    salam_arena_chunk_t *chunk = arena->chunks;
+
+    if (SALAM_ARENA_LARGE(arena, aligned)) {
+        chunk = salam_arena_chunk_create(arena, aligned, false);
+    } else if (chunk == NULL || chunk->used + aligned > chunk->capacity) {
+        chunk = salam_arena_chunk_create(arena, arena->chunk_size, true);
+    }
+
+    chunk->last = chunk->used;
+    chunk->used += aligned;
+
+    arena->allocated += aligned;
+
+    return SALAM_ARENA_DATA(chunk) + chunk->last;
+}
+
+/**
+ *
+ * @function salam_arena_callocate
+ * @brief Allocate zeroed memory from an arena, or from the heap if arena is
+ * NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {size_t} count - Number of elements
+ * @params {size_t} size - Size of an element in bytes
+ * @returns {void*}
+ *
+ */
+void *salam_arena_callocate(salam_arena_t *arena, size_t count, size_t size) {
+    DEBUG_ME;
+    if (arena == NULL) {
+        return memory_callocate(count, size);
+    }
+
+    void *ptr = salam_arena_allocate(arena, count * size);
+
+    memset(ptr, 0, count * size);
+
+    return ptr;
+}
+
+/**
+ *
+ * @function salam_arena_reallocate
+ * @brief Grow memory of salam_arena_allocate, the last allocation of the
+ * current chunk grows in place, other ones are copied
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {void*} ptr - Memory (can be NULL)
+ * @params {size_t} old_size - Size of the memory in bytes
+ * @params {size_t} new_size - New size in bytes
+ * @returns {void*}
+ *
+ */
+void *salam_arena_reallocate(salam_arena_t *arena, void *ptr, size_t old_size,
+                             size_t new_size) {
+    DEBUG_ME;
+    if (arena == NULL) {
+        return memory_reallocate(ptr, new_size);
+    } else if (ptr == NULL) {
+        return salam_arena_allocate(arena, new_size);
+    } else if (new_size <= old_size) {
+        return ptr;
+    }
+
+    salam_arena_chunk_t *chunk = arena->chunks;
+
+    if ((char *)ptr == SALAM_ARENA_DATA(chunk) + chunk->last) {
+        size_t end = chunk->last + SALAM_ARENA_ALIGN(new_size);
+
+        if (end <= chunk->capacity) {
+            arena->allocated += end - chunk->used;
+            chunk->used = end;
+
+            return ptr;
+        }
+    }
+
+    void *new_ptr = salam_arena_allocate(arena, new_size);
+
+    memcpy(new_ptr, ptr, old_size);
+
+    return new_ptr;
+}
+
+/**
+ *
+ * @function salam_arena_free
+ * @brief Free memory of salam_arena_allocate: heap memory (NULL arena) is
+ * freed, arena memory is left to salam_arena_destroy
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {void*} ptr - Memory
+ * @returns {void}
+ *
+ */
+void salam_arena_free(salam_arena_t *arena, void *ptr) {
+    DEBUG_ME;
+    if (arena == NULL) {
+        memory_destroy(ptr);
+    }
+}
+
+/**
+ *
+ * @function salam_arena_strdup
+ * @brief Duplicate a string into an arena, or into the heap if arena is NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {const char*} value - String
+ * @returns {char*}
+ *
+ */
+char *salam_arena_strdup(salam_arena_t *arena, const char *value) {
+    DEBUG_ME;
+    return salam_arena_strndup(arena, value, strlen(value));
+}
+
+/**
+ *
+ * @function salam_arena_strndup
+ * @brief Duplicate the first bytes of a string into an arena, or into the heap
+ * if arena is NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {char*}
+ *
+ */
+char *salam_arena_strndup(salam_arena_t *arena, const char *value,
+                          size_t length) {
+    DEBUG_ME;
+    char *copy = salam_arena_allocate(arena, length + 1);
+
+    memcpy(copy, value, length);
+    copy[length] = '\0';
+
+    return copy;
+}
+
+/**
+ *
+ * @function salam_arena_destroy
+ * @brief Free an arena and everything allocated from it
+ * @params {salam_arena_t*} arena - Arena
+ * @returns {void}
+ *
+ */
+void salam_arena_destroy(salam_arena_t *arena) {
+    DEBUG_ME;
+    if (arena != NULL) {
+        salam_arena_chunk_t *chunk = arena->chunks;
+
+        while (chunk != NULL) {
+            salam_arena_chunk_t *next = chunk->next;
+
+            memory_destroy(chunk);
+
+            chunk = next;
+        }
+
+        memory_destroy(arena);
+    }
+}
@@ -0,0 +1,156 @@
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "base.h"
+#include "log.h"
+#include "memory.h"
+
+// Size of a chunk when salam_arena_create is given 0
+#define SALAM_ARENA_CHUNK_SIZE (64 * 1024)
+
+// Every allocation is aligned to this, must be a power of two
+#define SALAM_ARENA_ALIGNMENT 16
+
+// Allocations larger than a quarter of a chunk get a chunk of their own
+#define SALAM_ARENA_LARGE(ARENA, SIZE) ((SIZE) > (ARENA)->chunk_size / 4)
+
+typedef struct salam_arena_chunk_t {
+    struct salam_arena_chunk_t *next;
+    size_t capacity;  // bytes after the header
+    size_t used;
+    size_t last;  // offset of the last allocation, to grow it in place
+} salam_arena_chunk_t;
+
+#define SALAM_ARENA_ALIGN(SIZE)             \
+    (((SIZE) + SALAM_ARENA_ALIGNMENT - 1) & \
+     ~(size_t)(SALAM_ARENA_ALIGNMENT - 1))
+
+// The data of a chunk starts after its header, at an aligned offset
+#define SALAM_ARENA_DATA(CHUNK) \
+    ((char *)(CHUNK) + SALAM_ARENA_ALIGN(sizeof(salam_arena_chunk_t)))
+
+typedef struct {
+    salam_arena_chunk_t *chunks;  // the first chunk is the one being filled
+    size_t chunk_size;
+
+    size_t allocated;  // bytes handed out, including the alignment padding
+    size_t reserved;   // bytes of all the chunks
+} salam_arena_t;
+
+/**
+ *
+ * @function salam_arena_create
+ * @brief Create an arena, everything allocated from it is freed at once by
+ * salam_arena_destroy
+ * @params {size_t} chunk_size - Size of a chunk, 0 for SALAM_ARENA_CHUNK_SIZE
+ * @returns {salam_arena_t*}
+ *
+ */
+salam_arena_t *salam_arena_create(size_t chunk_size);
+
+/**
+ *
+ * @function salam_arena_chunk_create
+ * @brief Add a chunk to the arena
+ * @params {salam_arena_t*} arena - Arena
+ * @params {size_t} capacity - Bytes the chunk must hold
+ * @params {bool} current - Whether the chunk becomes the one being filled, or
+ * is only kept for a large allocation
+ * @returns {salam_arena_chunk_t*}
+ *
+ */
+salam_arena_chunk_t *salam_arena_chunk_create(salam_arena_t *arena,
+                                              size_t capacity, bool current);
+
+/**
+ *
+ * @function salam_arena_allocate
+ * @brief Allocate memory from an arena, or from the heap if arena is NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {size_t} size - Size in bytes
+ * @returns {void*}
+ *
+ */
+void *salam_arena_allocate(salam_arena_t *arena, size_t size);
+
+/**
+ *
+ * @function salam_arena_callocate
+ * @brief Allocate zeroed memory from an arena, or from the heap if arena is
+ * NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {size_t} count - Number of elements
+ * @params {size_t} size - Size of an element in bytes
+ * @returns {void*}
+ *
+ */
+void *salam_arena_callocate(salam_arena_t *arena, size_t count, size_t size);
+
+/**
+ *
+ * @function salam_arena_reallocate
+ * @brief Grow memory of salam_arena_allocate, the last allocation of the
+ * current chunk grows in place, other ones are copied
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {void*} ptr - Memory (can be NULL)
+ * @params {size_t} old_size - Size of the memory in bytes
+ * @params {size_t} new_size - New size in bytes
+ * @returns {void*}
+ *
+ */
+void *salam_arena_reallocate(salam_arena_t *arena, void *ptr, size_t old_size,
+                             size_t new_size);
+
+/**
+ *
+ * @function salam_arena_free
+ * @brief Free memory of salam_arena_allocate: heap memory (NULL arena) is
+ * freed, arena memory is left to salam_arena_destroy
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {void*} ptr - Memory
+ * @returns {void}
+ *
+ */
+void salam_arena_free(salam_arena_t *arena, void *ptr);
+
+/**
+ *
+ * @function salam_arena_strdup
+ * @brief Duplicate a string into an arena, or into the heap if arena is NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {const char*} value - String
+ * @returns {char*}
+ *
+ */
+char *salam_arena_strdup(salam_arena_t *arena, const char *value);
+
+/**
+ *
+ * @function salam_arena_strndup
+ * @brief Duplicate the first bytes of a string into an arena, or into the heap
+ * if arena is NULL
+ * @params {salam_arena_t*} arena - Arena (can be NULL)
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {char*}
+ *
+ */
+char *salam_arena_strndup(salam_arena_t *arena, const char *value,
+                          size_t length);
+
+/**
+ *
+ * @function salam_arena_destroy
+ * @brief Free an arena and everything allocated from it
+ * @params {salam_arena_t*} arena - Arena
+ * @returns {void}
+ *
+ */
+void salam_arena_destroy(salam_arena_t *arena);
+
+#endif
@@ -13,14 +13,30 @@
  */
 array_t *array_create(size_t element_capacity, size_t capacity) {
     DEBUG_ME;
-    array_t *array = memory_allocate(sizeof(array_t));
+    return array_create_arena(NULL, element_capacity, capacity);
+}
+
+/**
+ *
+ * @function array_create_arena
+ * @brief Create a new array in an arena, it grows in the arena and is released
+ * with it
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} element_capacity - Size of each element
+ * @params {size_t} capacity - Initial capacity of the array
+ * @returns {array_t*} - Pointer to the created array
+ *
+ */
+array_t *array_create_arena(salam_arena_t *arena, size_t element_capacity,
+                            size_t capacity) {
+    DEBUG_ME;
+    array_t *array = salam_arena_allocate(arena, sizeof(array_t));
     array->length = 0;
     array->capacity = capacity;
     array->element_capacity = element_capacity;
-    array->data = memory_allocate(array->element_capacity * array->capacity);
-
-    array->print = cast(void (*)(void *), array_print);
-    array->destroy = cast(void (*)(void *), array_destroy);
+    array->arena = arena;
+    array->data = salam_arena_allocate(
+        arena, array->element_capacity * array->capacity);
 
     return array;
 }
@@ -40,6 +56,7 @@ void array_init(array_t *array, size_t capacity, size_t element_capacity) {
     array->length = 0;
     array->capacity = capacity;
     array->element_capacity = element_capacity;
+    array->arena = NULL;
     array->data = memory_allocate(element_capacity * capacity);
 }
 
@@ -55,9 +72,7 @@ void array_init(array_t *array, size_t capacity, size_t element_capacity) {
 bool array_push(array_t *array, void *element) {
     DEBUG_ME;
     if (array->length >= array->capacity) {
-        array->capacity *= 2;
-        array->data = memory_reallocate(
-            array->data, array->element_capacity * array->capacity);
+        array_resize(array, array->capacity * 2);
     }
 
     array->data[array->length++] = element;
@@ -100,9 +115,10 @@ bool array_pop(array_t *array, void *element) {
  */
 void array_resize(array_t *array, size_t new_capacity) {
     DEBUG_ME;
+    array->data = salam_arena_reallocate(
+        array->arena, array->data, array->element_capacity * array->capacity,
+        array->element_capacity * new_capacity);
     array->capacity = new_capacity;
-    array->data =
-        memory_reallocate(array->data, array->element_capacity * new_capacity);
 }
 
 /**
@@ -134,13 +150,13 @@ void *array_get(array_t *array, size_t index) {
 void array_destroy(array_t *array) {
     DEBUG_ME;
     if (array != NULL) {
-        memory_destroy(array->data);
+        salam_arena_free(array->arena, array->data);
 
         array->capacity = 0;
         array->length = 0;
         array->element_capacity = 0;
 
-        memory_destroy(array);
+        salam_arena_free(array->arena, array);
     }
 }
 
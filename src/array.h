@@ -7,18 +7,17 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
+
 typedef struct array_t {
     void **data;
     size_t length;
     size_t capacity;
     size_t element_capacity;
 
-    void (*print)(void *node);
-    char *(*stringify)(void *);
-    void (*destroy)(void *node);
+    salam_arena_t *arena;  // NULL if the array is on the heap
 } array_t;
 
-typedef array_t array_token_t;
 typedef array_t array_node_t;
 typedef array_t array_node_layout_t;
 typedef array_t array_layout_attribute_t;
@@ -45,6 +44,20 @@ typedef array_t array_value_t;
  */
 array_t *array_create(size_t element_capacity, size_t capacity);
 
+/**
+ *
+ * @function array_create_arena
+ * @brief Create a new array in an arena, it grows in the arena and is released
+ * with it
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} element_capacity - Size of each element
+ * @params {size_t} capacity - Initial capacity of the array
+ * @returns {array_t*} - Pointer to the created array
+ *
+ */
+array_t *array_create_arena(salam_arena_t *arena, size_t element_capacity,
+                            size_t capacity);
+
 /**
  *
  * @function array_init
@@ -1,36 +1,5 @@
 #include "array_custom.h"
 
-/**
- *
- * @function array_string_token
- * @brief Convert the token array to a string
- * @params {array_t*} array - Array
- * @params {char*} separator - Separator
- * @returns {char*} - String
- *
- */
-char *array_string_token(array_t *array, char *separator) {
-    DEBUG_ME;
-    if (array == NULL || array->length == 0) {
-        return NULL;
-    }
-
-    string_t *str = string_create(16);
-    for (size_t i = 0; i < array->length; i++) {
-        token_t *token = array_get(array, i);
-        string_append_str(str, token_value_stringify(token));
-
-        if (i < array->length - 1) {
-            string_append_str(str, separator);
-        }
-    }
-
-    char *buffer = string_strdup(str->data);
-    string_destroy(str);
-
-    return buffer;
-}
-
 /**
  *
  * @function array_destroy_custom
@@ -42,7 +11,7 @@ char *array_string_token(array_t *array, char *separator) {
  */
 void array_destroy_custom(array_t *array, void (*free_fn)(void *)) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             if (free_fn != NULL) {
                 for (size_t i = 0; i < array->length; i++) {
@@ -63,55 +32,6 @@ void array_destroy_custom(array_t *array, void (*free_fn)(void *)) {
     }
 }
 
-/**
- *
- * @function array_token_print
- * @brief Print the token array
- * @params {array_token_t*} array - Token array
- * @returns {void}
- *
- */
-void array_token_print(array_token_t *array) {
-    DEBUG_ME;
-    printf("Array Token: ");
-    printf("%zu\n", array->length);
-    char *str = array_token_stringify(array);
-
-    printf("%s\n", str);
-    memory_destroy(str);
-}
-
-/**
- *
- * @function array_token_stringify
- * @brief Convert the token array to a string
- * @params {array_token_t*} array - Token array
- * @params {char*} separator - Separator
- * @returns {char*} - String
- *
- */
-char *array_token_stringify(array_token_t *array) {
-    DEBUG_ME;
-    if (array == NULL || array->length == 0) {
-        return string_strdup("Token array is empty");
-    }
-
-    string_t *str = string_create(20);
-
-    for (size_t i = 0; i < array->length; i++) {
-        token_t *token = array_get(array, i);
-        char *token_str = token->stringify(token);
-
-        string_append_str(str, token_str);
-
-        if (i < array->length - 1) {
-            string_append_str(str, ",");
-        }
-    }
-
-    return string_destroy_and_get(str);
-}
-
 /**
  *
  * @function array_node_destroy
@@ -122,7 +42,7 @@ char *array_token_stringify(array_token_t *array) {
  */
 void array_node_destroy(array_node_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_node_t *node = array_get(array, i);
@@ -184,30 +104,7 @@ void array_layout_attribute_print(array_layout_attribute_t *array) {
         printf("\t");
         ast_layout_attribute_t *attribute = array_get(array, i);
 
-        attribute->print(attribute);
-    }
-}
-
-/**
- *
- * @function array_token_destroy
- * @brief Free the token array memory
- * @params {array_token_t*} array - Token array
- * @returns {void}
- *
- */
-void array_token_destroy(array_token_t *array) {
-    DEBUG_ME;
-    if (array != NULL) {
-        for (size_t i = 0; i < array->length; i++) {
-            token_t *token = array_get(array, i);
-
-            if (token != NULL) {
-                token->destroy(token);
-            }
-        }
-
-        array_destroy(array);
+        ast_layout_attribute_print(attribute);
     }
 }
 
@@ -221,13 +118,13 @@ void array_token_destroy(array_token_t *array) {
  */
 void array_layout_node_destroy(array_node_layout_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_layout_node_t *node = array_get(array, i);
 
                 if (node != NULL) {
-                    node->destroy(node);
+                    ast_layout_node_destroy(node);
                 }
             }
 
@@ -259,7 +156,7 @@ void array_layout_node_print(array_node_layout_t *array) {
         ast_layout_node_t *node =
             cast(ast_layout_node_t *, array_get(cast(array_t *, array), i));
         if (node != NULL) {
-            node->print(node);
+            ast_layout_node_print(node);
         } else {
             printf("NULL\n");
         }
@@ -296,7 +193,7 @@ void array_function_parameter_print(array_function_parameter_t *array) {
  */
 void array_function_parameter_destroy(array_function_parameter_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_function_parameter_t *parameter = array_get(array, i);
@@ -326,7 +223,7 @@ void array_function_parameter_destroy(array_function_parameter_t *array) {
  */
 void array_function_destroy(array_function_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_function_t *function = array_get(array, i);
@@ -377,7 +274,7 @@ void array_function_print(array_function_t *array) {
  */
 void array_if_destroy(array_if_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_if_t *if_statement = array_get(array, i);
@@ -428,13 +325,13 @@ void array_if_print(array_if_t *array) {
  */
 void array_value_destroy(array_value_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_value_t *value = array_get(array, i);
 
                 if (value != NULL) {
-                    value->destroy(value);
+                    ast_value_destroy(value);
                 }
             }
 
@@ -459,7 +356,7 @@ void array_value_destroy(array_value_t *array) {
  */
 void array_block_destroy(array_block_t *array) {
     DEBUG_ME;
-    if (array != NULL) {
+    if (array != NULL && array->arena == NULL) {
         if (array->data != NULL) {
             for (size_t i = 0; i < array->length; i++) {
                 ast_block_t *block = array_get(array, i);
@@ -509,16 +406,15 @@ void array_block_print(array_block_t *array) {
  *
  * @function array_value_create
  * @brief Create a new value array
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {size_t} capacity - Initial capacity of the array
  * @returns {array_value_t*} - Pointer to the created array
  *
  */
-array_value_t *array_value_create(size_t capacity) {
+array_value_t *array_value_create(salam_arena_t *arena, size_t capacity) {
     DEBUG_ME;
-    array_value_t *array = array_create(sizeof(ast_value_t *), capacity);
-
-    array->print = cast(void (*)(void *), array_value_print);
-    array->destroy = cast(void (*)(void *), array_value_destroy);
+    array_value_t *array =
+        array_create_arena(arena, sizeof(ast_value_t *), capacity);
 
     return array;
 }
@@ -543,7 +439,7 @@ void array_value_print(array_value_t *array) {
             printf("NULL\n");
             continue;
         } else {
-            value->print(value);
+            ast_value_print(value);
         }
     }
 }
@@ -567,7 +463,7 @@ char *array_value_first_stringify(array_value_t *array) {
         ast_value_t *value = array_get(array, i);
 
         if (value != NULL) {
-            string_append_str(str, value->get_data(value));
+            string_append_str(str, ast_value_data(value));
             break;
         }
     }
@@ -589,6 +485,22 @@ char *array_value_first_stringify(array_value_t *array) {
  */
 char *array_value_stringify(array_value_t *array, char *separator) {
     DEBUG_ME;
+    return array_value_stringify_arena(NULL, array, separator);
+}
+
+/**
+ *
+ * @function array_value_stringify_arena
+ * @brief Convert the attribute value array to a string in an arena
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {array_value_t*} array - Array
+ * @params {char*} separator - Separator
+ * @returns {char*} - String, NULL for an empty array
+ *
+ */
+char *array_value_stringify_arena(salam_arena_t *arena, array_value_t *array,
+                                  char *separator) {
+    DEBUG_ME;
     if (array == NULL || array->length == 0) {
         return NULL;
     }
@@ -598,7 +510,7 @@ char *array_value_stringify(array_value_t *array, char *separator) {
         ast_value_t *value = array_get(array, i);
 
         if (value != NULL) {
-            string_append_str(str, value->get_data(value));
+            string_append_str(str, ast_value_data(value));
 
             if (i < array->length - 1) {
                 string_append_str(str, separator);
@@ -606,7 +518,7 @@ char *array_value_stringify(array_value_t *array, char *separator) {
         }
     }
 
-    char *buffer = string_strdup(str->data);
+    char *buffer = salam_arena_strdup(arena, str->data);
     string_destroy(str);
 
     return buffer;
@@ -616,18 +528,19 @@ char *array_value_stringify(array_value_t *array, char *separator) {
  *
  * @function array_value_copy
  * @brief Copy the attribute value array
+ * @params {salam_arena_t*} arena - Arena of the copy (can be NULL for the heap)
  * @params {array_value_t*} values - Array
  * @returns {array_value_t*} - Copied array
  *
  */
-array_value_t *array_value_copy(array_value_t *values) {
+array_value_t *array_value_copy(salam_arena_t *arena, array_value_t *values) {
     DEBUG_ME;
-    array_value_t *copy = array_value_create(values->length);
+    array_value_t *copy = array_value_create(arena, values->length);
 
     for (size_t i = 0; i < values->length; i++) {
         ast_value_t *value = values->data[i];
 
-        array_push(copy, ast_value_copy(value));
+        array_push(copy, ast_value_copy(arena, value));
     }
 
     return copy;
@@ -25,16 +25,6 @@
  */
 void array_destroy_custom(array_t *array, void (*free_fn)(void *));
 
-/**
- *
- * @function array_token_print
- * @brief Print the token array
- * @params {array_token_t*} array - Token array
- * @returns {void}
- *
- */
-void array_token_print(array_token_t *array);
-
 /**
  *
  * @function array_node_destroy
@@ -55,16 +45,6 @@ void array_node_destroy(array_node_t *array);
  */
 void array_node_print(array_node_t *array);
 
-/**
- *
- * @function array_token_destroy
- * @brief Free the token array memory
- * @params {array_token_t*} array - Token array
- * @returns {void}
- *
- */
-void array_token_destroy(array_token_t *array);
-
 /**
  *
  * @function array_layout_attribute_print
@@ -75,17 +55,6 @@ void array_token_destroy(array_token_t *array);
  */
 void array_layout_attribute_print(array_layout_attribute_t *array);
 
-/**
- *
- * @function array_string_token
- * @brief Convert the token array to a string
- * @params {array_t*} array - Array
- * @params {char*} separator - Separator
- * @returns {char*} - String
- *
- */
-char *array_string_token(array_t *array, char *separator);
-
 /**
  *
  * @function array_layout_attribute_print
@@ -209,11 +178,12 @@ void array_block_destroy(array_block_t *array);
  *
  * @function array_value_create
  * @brief Create a new value array
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {size_t} capacity - Initial capacity of the array
  * @returns {array_value_t*} - Pointer to the created array
  *
  */
-array_value_t *array_value_create(size_t capacity);
+array_value_t *array_value_create(salam_arena_t *arena, size_t capacity);
 
 /**
  *
@@ -246,6 +216,19 @@ void array_value_print(array_value_t *array);
  */
 char *array_value_stringify(array_value_t *array, char *separator);
 
+/**
+ *
+ * @function array_value_stringify_arena
+ * @brief Convert the attribute value array to a string in an arena
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {array_value_t*} array - Array
+ * @params {char*} separator - Separator
+ * @returns {char*} - String, NULL for an empty array
+ *
+ */
+char *array_value_stringify_arena(salam_arena_t *arena, array_value_t *array,
+                                  char *separator);
+
 /**
  *
  * @function array_value_first_string
@@ -260,11 +243,12 @@ char *array_value_first_stringify(array_value_t *array);
  *
  * @function array_value_copy
  * @brief Copy the attribute value array
+ * @params {salam_arena_t*} arena - Arena of the copy (can be NULL for the heap)
  * @params {array_value_t*} values - Array
  * @returns {array_value_t*} - Copied array
  *
  */
-array_value_t *array_value_copy(array_value_t *values);
+array_value_t *array_value_copy(salam_arena_t *arena, array_value_t *values);
 
 /**
  *
@@ -277,14 +261,4 @@ array_value_t *array_value_copy(array_value_t *values);
  */
 char *array_value_stringify(array_value_t *array, char *separator);
 
-/**
- *
- * @function array_token_stringify
- * @brief Convert the token array to a string
- * @params {array_token_t*} array - Token array
- * @returns {char*} - String
- *
- */
-char *array_token_stringify(array_token_t *array);
-
 #endif
@@ -4,14 +4,16 @@
  *
  * @function ast_node_create
  * @brief Create a new AST node
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_type_t} type - Type of the AST node
  * @params {location_t} location - Location of the AST node
  * @returns {ast_node_t*} - Pointer to the created AST node
  *
  */
-ast_node_t *ast_node_create(ast_type_t type, location_t location) {
+ast_node_t *ast_node_create(salam_arena_t *arena, ast_type_t type,
+                            location_t location) {
     DEBUG_ME;
-    ast_node_t *node = memory_allocate(sizeof(ast_node_t));
+    ast_node_t *node = salam_arena_allocate(arena, sizeof(ast_node_t));
     node->type = type;
     node->location = location;
 
@@ -88,32 +90,35 @@ void ast_node_destroy(ast_node_t *value) {
 /**
  *
  * @function ast_value_create
- * @brief Create a new AST node layout attribute value
- * @params {ast_value_type_t*} type - Type of the layout attribute value
- * @params {void*} value - Value of the layout attribute value
+ * @brief Create a new AST node layout attribute value, the text of a string
+ * value is copied behind the value in the same allocation
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {ast_value_kind_t} kind - Kind of the value
+ * @params {location_t} location - Location of the value
+ * @params {const char*} value - Text of a string value, NULL for other kinds
  * @returns {ast_value_t*} - Pointer to the created AST node layout attribute
  * value
  *
  */
-ast_value_t *ast_value_create(ast_value_type_t *type, void *value) {
+ast_value_t *ast_value_create(salam_arena_t *arena, ast_value_kind_t kind,
+                              location_t location, const char *value) {
     DEBUG_ME;
-    size_t value_length = strlen(value);
-    ast_value_t *res = memory_allocate(sizeof(ast_value_t));
+    bool is_string = kind == AST_TYPE_KIND_STRING && value != NULL;
+    size_t value_size = is_string ? strlen(value) + 1 : 0;
+    ast_value_t *res =
+        salam_arena_allocate(arena, sizeof(ast_value_t) + value_size);
 
-    res->type = type;
+    res->type.kind = kind;
+    res->type.location = location;
 
-    if (type->kind == AST_TYPE_KIND_STRING) {
-        size_t value_size = value_length < 1 ? 1 : value_length + 1;
+    memset(&res->data, 0, sizeof(res->data));
 
-        res->data.string_value = memory_allocate(value_size);
+    if (is_string) {
+        res->data.string_value = (char *)(res + 1);
 
         memcpy(res->data.string_value, value, value_size);
     }
 
-    res->print = cast(void (*)(void *), ast_value_print);
-    res->destroy = cast(void (*)(void *), ast_value_destroy);
-    res->get_data = cast(char *(*)(void *), ast_value_data);
-
     return res;
 }
 
@@ -127,7 +132,7 @@ ast_value_t *ast_value_create(ast_value_type_t *type, void *value) {
  */
 char *ast_value_data(ast_value_t *value) {
     DEBUG_ME;
-    if (value->type->kind == AST_TYPE_KIND_STRING) {
+    if (value->type.kind == AST_TYPE_KIND_STRING) {
         return value->data.string_value;
     }
 
@@ -138,22 +143,21 @@ char *ast_value_data(ast_value_t *value) {
  *
  * @function ast_block_create
  * @brief Create a new AST block node
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_block_type_t} type - Block type
  * @params {ast_type_t} parent_type - Parent type
  * @returns {ast_block_t*} - AST block node
  *
  */
-ast_block_t *ast_block_create(ast_block_type_t type, ast_type_t parent_type) {
+ast_block_t *ast_block_create(salam_arena_t *arena, ast_block_type_t type,
+                              ast_type_t parent_type) {
     DEBUG_ME;
-    ast_block_t *block = memory_allocate(sizeof(ast_block_t));
+    ast_block_t *block = salam_arena_allocate(arena, sizeof(ast_block_t));
 
     block->type = type;
     block->parent_type = parent_type;
 
-    block->children = array_create(sizeof(ast_node_t *), 4);
-
-    block->children->print = cast(void (*)(void *), array_node_print);
-    block->children->destroy = cast(void (*)(void *), array_node_destroy);
+    block->children = array_create_arena(arena, sizeof(ast_node_t *), 4);
 
     block->print = cast(void (*)(void *), ast_block_print);
     block->destroy = cast(void (*)(void *), ast_block_destroy);
@@ -165,13 +169,14 @@ ast_block_t *ast_block_create(ast_block_type_t type, ast_type_t parent_type) {
  *
  * @function ast_print_create
  * @brief Create a new AST node print
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {array_value_t*} values - Values of the print
  * @returns {ast_print_t*} - Pointer to the created AST node if
  *
  */
-ast_print_t *ast_print_create(array_value_t *values) {
+ast_print_t *ast_print_create(salam_arena_t *arena, array_value_t *values) {
     DEBUG_ME;
-    ast_print_t *node = memory_allocate(sizeof(ast_print_t));
+    ast_print_t *node = salam_arena_allocate(arena, sizeof(ast_print_t));
 
     node->values = values;
 
@@ -195,7 +200,7 @@ void ast_print_print(ast_print_t *node) {
 
     if (node->values != NULL) {
         printf("Values\n");
-        node->values->print(node->values);
+        array_value_print(node->values);
     }
 }
 
@@ -211,7 +216,7 @@ void ast_print_destroy(ast_print_t *node) {
     DEBUG_ME;
     if (node != NULL) {
         if (node->values != NULL) {
-            node->values->destroy(node->values);
+            array_value_destroy(node->values);
         }
 
         memory_destroy(node);
@@ -222,13 +227,14 @@ void ast_print_destroy(ast_print_t *node) {
  *
  * @function ast_return_create
  * @brief Create a new AST node return
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {array_value_t*} values - Values of the return
  * @returns {ast_return_t*} - Pointer to the created AST node if
  *
  */
-ast_return_t *ast_return_create(array_value_t *values) {
+ast_return_t *ast_return_create(salam_arena_t *arena, array_value_t *values) {
     DEBUG_ME;
-    ast_return_t *node = memory_allocate(sizeof(ast_return_t));
+    ast_return_t *node = salam_arena_allocate(arena, sizeof(ast_return_t));
 
     node->values = values;
 
@@ -251,7 +257,7 @@ void ast_return_print(ast_return_t *node) {
 
     if (node->values != NULL) {
         printf("Values\n");
-        node->values->print(node->values);
+        array_value_print(node->values);
     }
 }
 
@@ -267,7 +273,7 @@ void ast_return_destroy(ast_return_t *node) {
     DEBUG_ME;
     if (node != NULL) {
         if (node->values != NULL) {
-            node->values->destroy(node->values);
+            array_value_destroy(node->values);
         }
 
         memory_destroy(node);
@@ -278,26 +284,25 @@ void ast_return_destroy(ast_return_t *node) {
  *
  * @function ast_if_create
  * @brief Create a new AST node if
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_t*} condition - Condition of the if
  * @returns {ast_if_t*} - Pointer to the created AST node if
  *
  */
-ast_if_t *ast_if_create(ast_value_t *condition) {
+ast_if_t *ast_if_create(salam_arena_t *arena, ast_value_t *condition) {
     DEBUG_ME;
-    ast_if_t *node = memory_allocate(sizeof(ast_if_t));
+    ast_if_t *node = salam_arena_allocate(arena, sizeof(ast_if_t));
 
     node->condition = condition;
 
-    node->block = ast_block_create(AST_BLOCK_TYPE_IF, AST_TYPE_IF);  // TODO???
+    node->block =
+        ast_block_create(arena, AST_BLOCK_TYPE_IF, AST_TYPE_IF);  // TODO???
 
     node->block->print = cast(void (*)(void *), ast_block_print);
     node->block->destroy = cast(void (*)(void *), ast_block_destroy);
 
-    node->else_blocks =
-        array_create(sizeof(ast_if_t *), 16);  // Can be NULL for sub else if
-
-    node->else_blocks->print = cast(void (*)(void *), array_if_print);
-    node->else_blocks->destroy = cast(void (*)(void *), array_if_destroy);
+    node->else_blocks = array_create_arena(
+        arena, sizeof(ast_if_t *), 16);  // Can be NULL for sub else if
 
     node->print = cast(void (*)(void *), ast_if_print);
     node->destroy = cast(void (*)(void *), ast_if_destroy);
@@ -309,18 +314,19 @@ ast_if_t *ast_if_create(ast_value_t *condition) {
  *
  * @function ast_elseif_create
  * @brief Create a new AST node else if
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_t*} condition - Condition of the else if
  * @returns {ast_if_t*} - Pointer to the created AST node else if
  *
  */
-ast_if_t *ast_elseif_create(ast_value_t *condition) {
+ast_if_t *ast_elseif_create(salam_arena_t *arena, ast_value_t *condition) {
     DEBUG_ME;
-    ast_if_t *node = memory_allocate(sizeof(ast_if_t));
+    ast_if_t *node = salam_arena_allocate(arena, sizeof(ast_if_t));
 
     node->condition = condition;
 
-    node->block =
-        ast_block_create(AST_BLOCK_TYPE_IF, AST_TYPE_ELSE_IF);  // TODO???
+    node->block = ast_block_create(arena, AST_BLOCK_TYPE_IF,
+                                   AST_TYPE_ELSE_IF);  // TODO???
     node->block->print = cast(void (*)(void *), ast_block_print);
     node->block->destroy = cast(void (*)(void *), ast_block_destroy);
 
@@ -336,17 +342,18 @@ ast_if_t *ast_elseif_create(ast_value_t *condition) {
  *
  * @function ast_else_create
  * @brief Create a new AST node else
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_if_t*} - Pointer to the created AST node else
  *
  */
-ast_if_t *ast_else_create() {
+ast_if_t *ast_else_create(salam_arena_t *arena) {
     DEBUG_ME;
-    ast_if_t *node = memory_allocate(sizeof(ast_if_t));
+    ast_if_t *node = salam_arena_allocate(arena, sizeof(ast_if_t));
 
     node->condition = NULL;
 
-    node->block =
-        ast_block_create(AST_BLOCK_TYPE_ELSE_IF, AST_TYPE_ELSE_IF);  // TODO???
+    node->block = ast_block_create(arena, AST_BLOCK_TYPE_ELSE_IF,
+                                   AST_TYPE_ELSE_IF);  // TODO???
     node->block->print = cast(void (*)(void *), ast_block_print);
     node->block->destroy = cast(void (*)(void *), ast_block_destroy);
 
@@ -371,14 +378,14 @@ void ast_if_print(ast_if_t *node) {
 
     printf("Condition\n");
     if (node->condition != NULL) {
-        node->condition->print(node->condition);
+        ast_value_print(node->condition);
     } else {
         printf("NULL\n");
     }
 
     printf("Else Blocks\n");
     if (node->else_blocks != NULL) {
-        node->else_blocks->print(node->else_blocks);
+        array_if_print(node->else_blocks);
     } else {
         printf("NULL\n");
     }
@@ -403,7 +410,7 @@ void ast_if_destroy(ast_if_t *node) {
     DEBUG_ME;
     if (node != NULL) {
         if (node->condition != NULL) {
-            node->condition->destroy(node->condition);
+            ast_value_destroy(node->condition);
         }
 
         if (node->block != NULL) {
@@ -411,7 +418,7 @@ void ast_if_destroy(ast_if_t *node) {
         }
 
         if (node->else_blocks != NULL) {
-            node->else_blocks->destroy(node->else_blocks);
+            array_if_destroy(node->else_blocks);
         }
 
         memory_destroy(node);
@@ -422,27 +429,25 @@ void ast_if_destroy(ast_if_t *node) {
  *
  * @function ast_function_create
  * @brief Create a new AST node function
- * @params {char*} name - Name of the function
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {const char*} name - Name of the function
  * @returns {ast_function_t*} - Pointer to the created AST node function
  *
  */
-ast_function_t *ast_function_create(char *name) {
+ast_function_t *ast_function_create(salam_arena_t *arena, const char *name) {
     DEBUG_ME;
-    ast_function_t *node = memory_allocate(sizeof(ast_function_t));
-    node->name = string_strdup(name);
+    ast_function_t *node = salam_arena_allocate(arena, sizeof(ast_function_t));
+    node->name = salam_intern(name);
 
     location_t return_location = {0, 0, 0, 0, 0, 0};  // TODO: Fix this
     node->return_type =
-        ast_value_type_create(AST_TYPE_KIND_VOID, return_location);
+        ast_value_type_create(arena, AST_TYPE_KIND_VOID, return_location);
 
-    node->parameters = array_create(sizeof(ast_function_parameter_t *), 16);
+    node->parameters =
+        array_create_arena(arena, sizeof(ast_function_parameter_t *), 16);
 
-    node->parameters->print =
-        cast(void (*)(void *), array_function_parameter_print);
-    node->parameters->destroy =
-        cast(void (*)(void *), array_function_parameter_destroy);
-
-    node->block = ast_block_create(AST_BLOCK_TYPE_FUNCTION, AST_TYPE_FUNCTION);
+    node->block =
+        ast_block_create(arena, AST_BLOCK_TYPE_FUNCTION, AST_TYPE_FUNCTION);
 
     node->block->print = cast(void (*)(void *), ast_block_print);
     node->block->destroy = cast(void (*)(void *), ast_block_destroy);
@@ -485,7 +490,7 @@ void ast_block_destroy(ast_block_t *block) {
     DEBUG_ME;
     if (block != NULL) {
         if (block->children != NULL) {
-            block->children->destroy(block->children);
+            array_node_destroy(block->children);
         }
 
         memory_destroy(block);
@@ -532,21 +537,21 @@ void ast_value_type_print(ast_value_type_t *type) {
  *
  * @function ast_value_type_create
  * @brief Create a new AST value type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_kind_t} kind - Kind of the value type
  * @params {location_t} location - Location of the value type
  * @returns {ast_value_type_t*} - Pointer to the created AST value type
  *
  */
-ast_value_type_t *ast_value_type_create(ast_value_kind_t kind,
+ast_value_type_t *ast_value_type_create(salam_arena_t *arena,
+                                        ast_value_kind_t kind,
                                         location_t location) {
     DEBUG_ME;
-    ast_value_type_t *type = memory_allocate(sizeof(ast_value_type_t));
+    ast_value_type_t *type =
+        salam_arena_allocate(arena, sizeof(ast_value_type_t));
     type->kind = kind;
     type->location = location;
 
-    type->print = cast(void (*)(void *), ast_value_type_print);
-    type->destroy = cast(void (*)(void *), ast_value_type_destroy);
-
     return type;
 }
 
@@ -589,10 +594,6 @@ void ast_function_parameter_print(ast_function_parameter_t *value) {
 void ast_function_parameter_destroy(ast_function_parameter_t *value) {
     DEBUG_ME;
     if (value != NULL) {
-        if (value->name != NULL) {
-            memory_destroy(value->name);
-        }
-
         memory_destroy(value);
     }
 }
@@ -613,7 +614,7 @@ void ast_function_print(ast_function_t *value) {
     size_t parameters_capacity = array_length(parameters);
 
     printf("Return Type: ");
-    value->return_type->print(value->return_type);
+    ast_value_type_print(value->return_type);
     printf("\n");
 
     printf("Parameters: %zu\n", parameters_capacity);
@@ -645,16 +646,12 @@ void ast_function_print(ast_function_t *value) {
 void ast_function_destroy(ast_function_t *value) {
     DEBUG_ME;
     if (value != NULL) {
-        if (value->name != NULL) {
-            memory_destroy(value->name);
-        }
-
         if (value->parameters != NULL) {
-            value->parameters->destroy(value->parameters);
+            array_function_parameter_destroy(value->parameters);
         }
 
         if (value->return_type != NULL) {
-            value->return_type->destroy(value->return_type);
+            ast_value_type_destroy(value->return_type);
         }
 
         if (value->block != NULL) {
@@ -712,17 +709,17 @@ char *ast_block_type_name(ast_block_type_t type) {
  *
  * @function ast_create
  * @brief Create a new AST
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_t*} - Pointer to the created AST
  *
  */
-ast_t *ast_create() {
+ast_t *ast_create(salam_arena_t *arena) {
     DEBUG_ME;
-    ast_t *ast = memory_allocate(sizeof(ast_t));
+    ast_t *ast = salam_arena_allocate(arena, sizeof(ast_t));
     ast->layout = NULL;
+    ast->arena = arena;
 
-    ast->functions = array_create(sizeof(ast_function_t *), 16);
-    ast->functions->print = cast(void (*)(void *), array_function_print);
-    ast->functions->destroy = cast(void (*)(void *), array_function_destroy);
+    ast->functions = array_create_arena(arena, sizeof(ast_function_t *), 16);
 
     ast->print = cast(void (*)(void *), ast_print);
     ast->destroy = cast(void (*)(void *), ast_destroy);
@@ -762,13 +759,14 @@ void ast_debug(ast_t *ast) {
  */
 void ast_destroy(ast_t *ast) {
     DEBUG_ME;
-    if (ast != NULL) {
+    // An AST built in an arena is released with it, by its owner
+    if (ast != NULL && ast->arena == NULL) {
         if (ast->layout != NULL) {
             ast_layout_destroy(ast->layout);
         }
 
         if (ast->functions != NULL) {
-            ast->functions->destroy(ast->functions);
+            array_function_destroy(ast->functions);
         }
 
         memory_destroy(ast);
@@ -796,7 +794,7 @@ void ast_print(ast_t *ast) {
 
     printf("AST Functions: ");
     if (ast->functions != NULL) {
-        ast->functions->print(ast->functions);
+        array_function_print(ast->functions);
     } else {
         printf("NULL\n");
     }
@@ -813,14 +811,6 @@ void ast_print(ast_t *ast) {
 void ast_value_destroy(ast_value_t *value) {
     DEBUG_ME;
     if (value != NULL) {
-        if (value->type != NULL) {
-            value->type->destroy(value->type);
-        }
-
-        if (value->data.string_value != NULL) {
-            memory_destroy(value->data.string_value);
-        }
-
         memory_destroy(value);
     }
 }
@@ -839,15 +829,10 @@ void ast_value_print(ast_value_t *value) {
 
     if (value != NULL) {
         printf("Value Type:\n");
-
-        if (value->type != NULL) {
-            value->type->print(value->type);
-        } else {
-            printf("NULL\n");
-        }
+        ast_value_type_print(&value->type);
 
         printf("Value Data:\n");
-        if (value->data.string_value != NULL) {
+        if (value->type.kind == AST_TYPE_KIND_STRING) {
             printf("%s\n", value->data.string_value);
         } else {
             printf("NULL\n");
@@ -861,15 +846,22 @@ void ast_value_print(ast_value_t *value) {
  *
  * @function ast_value_copy
  * @brief Copy the AST layout attribute value
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_t*} value - AST Layout Attribute Value
  * @returns {ast_value_t*} - Copied AST Layout Attribute Value
  *
  */
-ast_value_t *ast_value_copy(ast_value_t *value) {
+ast_value_t *ast_value_copy(salam_arena_t *arena, ast_value_t *value) {
     DEBUG_ME;
-    ast_value_type_t *type = ast_value_type_copy(value->type);
+    if (value->type.kind == AST_TYPE_KIND_STRING) {
+        return ast_value_create(arena, value->type.kind, value->type.location,
+                                value->data.string_value);
+    }
+
+    ast_value_t *copy = ast_value_create(arena, value->type.kind,
+                                         value->type.location, NULL);
 
-    ast_value_t *copy = ast_value_create(type, value->data.string_value);
+    copy->data = value->data;
 
     return copy;
 }
@@ -878,13 +870,16 @@ ast_value_t *ast_value_copy(ast_value_t *value) {
  *
  * @function ast_value_type_copy
  * @brief Copy the AST layout attribute value type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_type_t*} type - AST Layout Attribute Value Type
  * @returns {ast_value_type_t*} - Copied AST Layout Attribute Value Type
  *
  */
-ast_value_type_t *ast_value_type_copy(ast_value_type_t *type) {
+ast_value_type_t *ast_value_type_copy(salam_arena_t *arena,
+                                      ast_value_type_t *type) {
     DEBUG_ME;
-    ast_value_type_t *copy = ast_value_type_create(type->kind, type->location);
+    ast_value_type_t *copy =
+        ast_value_type_create(arena, type->kind, type->location);
 
     return copy;
 }
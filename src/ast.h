@@ -8,9 +8,9 @@
 #include "array_custom.h"
 #include "base.h"
 #include "hashmap.h"
+#include "intern.h"
 #include "lexer.h"
 #include "memory.h"
-// #include "hashmap_custom.h"
 #include "string_buffer.h"
 
 typedef enum {
@@ -56,16 +56,13 @@ typedef enum ast_value_kind_t {
 typedef struct ast_value_type_t {
     ast_value_kind_t kind;
     location_t location;
-
-    void (*destroy)(void *node);
-    void (*print)(void *node);
 } ast_value_type_t;
 
 #include "ast_layout.h"
 #include "ast_layout_style.h"
 
 typedef struct ast_function_t {
-    char *name;
+    const char *name;  // interned, see salam_intern
     array_function_parameter_t *parameters;
     ast_block_t *block;
     ast_value_type_t *return_type;
@@ -74,8 +71,10 @@ typedef struct ast_function_t {
     void (*print)(void *node);
 } ast_function_t;
 
+// A value is one allocation: the type is stored inline and the text of a
+// string value right after the value itself
 typedef struct ast_value_t {
-    ast_value_type_t *type;
+    ast_value_type_t type;
     union data {
         int int_value;
         float float_value;
@@ -83,10 +82,6 @@ typedef struct ast_value_t {
         bool bool_value;
         char *string_value;
     } data;
-
-    void (*destroy)(void *node);
-    void (*print)(void *node);
-    char *(*get_data)(void *node);
 } ast_value_t;
 
 typedef struct ast_if_t {
@@ -113,7 +108,7 @@ typedef struct ast_print_t {
 } ast_print_t;
 
 typedef struct ast_function_parameter_t {
-    char *name;
+    const char *name;  // interned, see salam_intern
     ast_value_type_t *type;
 
     void (*destroy)(void *node);
@@ -144,6 +139,8 @@ typedef struct ast_t {
     struct ast_layout_t *layout;
     array_function_t *functions;
 
+    salam_arena_t *arena;  // NULL if the AST is on the heap
+
     void (*destroy)(void *node);
     void (*print)(void *node);
 } ast_t;
@@ -162,12 +159,14 @@ void ast_node_destroy_notall(ast_node_t *value);
  *
  * @function ast_node_create
  * @brief Create a new AST node
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_type_t} type - Type of the AST node
  * @params {location_t} location - Location of the AST node
  * @returns {ast_node_t*} - Pointer to the created AST node
  *
  */
-ast_node_t *ast_node_create(ast_type_t type, location_t location);
+ast_node_t *ast_node_create(salam_arena_t *arena, ast_type_t type,
+                            location_t location);
 
 /**
  *
@@ -193,10 +192,11 @@ void ast_node_destroy(ast_node_t *value);
  *
  * @function ast_create
  * @brief Create a new AST
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_t*} - Pointer to the created AST
  *
  */
-ast_t *ast_create();
+ast_t *ast_create(salam_arena_t *arena);
 
 /**
  *
@@ -222,22 +222,25 @@ void ast_destroy(ast_t *ast);
  *
  * @function ast_block_create
  * @brief Create a new AST block node
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_block_type_t} type - Block type
  * @params {ast_type_t} parent_type - Parent type
  * @returns {ast_block_t*} - AST block node
  *
  */
-ast_block_t *ast_block_create(ast_block_type_t type, ast_type_t parent_type);
+ast_block_t *ast_block_create(salam_arena_t *arena, ast_block_type_t type,
+                              ast_type_t parent_type);
 
 /**
  *
  * @function ast_function_create
  * @brief Create a new AST node function
- * @params {char*} name - Name of the function
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {const char*} name - Name of the function
  * @returns {ast_function_t*} - Pointer to the created AST node function
  *
  */
-ast_function_t *ast_function_create(char *name);
+ast_function_t *ast_function_create(salam_arena_t *arena, const char *name);
 
 /**
  *
@@ -283,12 +286,14 @@ void ast_function_destroy(ast_function_t *value);
  *
  * @function ast_value_type_create
  * @brief Create a new AST value type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_kind_t} kind - Kind of the value type
  * @params {location_t} location - Location of the value type
  * @returns {ast_value_type_t*} - Pointer to the created AST value type
  *
  */
-ast_value_type_t *ast_value_type_create(ast_value_kind_t kind,
+ast_value_type_t *ast_value_type_create(salam_arena_t *arena,
+                                        ast_value_kind_t kind,
                                         location_t location);
 
 /**
@@ -364,11 +369,12 @@ void ast_if_print(ast_if_t *node);
  *
  * @function ast_elseif_create
  * @brief Create a new AST node else if
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_t*} condition - Condition of the else if
  * @returns {ast_if_t*} - Pointer to the created AST node else if
  *
  */
-ast_if_t *ast_elseif_create(ast_value_t *condition);
+ast_if_t *ast_elseif_create(salam_arena_t *arena, ast_value_t *condition);
 
 /**
  *
@@ -384,22 +390,26 @@ void ast_if_destroy(ast_if_t *node);
  *
  * @function ast_if_create
  * @brief Create a new AST node if
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_t*} condition - Condition of the if
  * @returns {ast_if_t*} - Pointer to the created AST node if
  *
  */
-ast_if_t *ast_if_create(ast_value_t *condition);
+ast_if_t *ast_if_create(salam_arena_t *arena, ast_value_t *condition);
 
 /**
  *
  * @function ast_value_create
  * @brief Create a new AST value
- * @params {ast_value_type_t*} type - Value type
- * @params {void*} data - Value data
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {ast_value_kind_t} kind - Kind of the value
+ * @params {location_t} location - Location of the value
+ * @params {const char*} data - Text of a string value, NULL for other kinds
  * @returns {ast_value_t*} - Pointer to the created AST value
  *
  */
-ast_value_t *ast_value_create(ast_value_type_t *type, void *data);
+ast_value_t *ast_value_create(salam_arena_t *arena, ast_value_kind_t kind,
+                              location_t location, const char *data);
 
 /**
  *
@@ -434,10 +444,11 @@ char *ast_block_type_name(ast_block_type_t type);
  *
  * @function ast_else_create
  * @brief Create a new AST node else
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_if_t*} - Pointer to the created AST node else
  *
  */
-ast_if_t *ast_else_create();
+ast_if_t *ast_else_create(salam_arena_t *arena);
 
 /**
  *
@@ -462,21 +473,23 @@ void ast_return_destroy(ast_return_t *node);
  *
  * @function ast_return_create
  * @brief Create a new AST node return
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {array_value_t*} values - Values of the return
  * @returns {ast_return_t*} - Pointer to the created AST node if
  *
  */
-ast_return_t *ast_return_create(array_value_t *values);
+ast_return_t *ast_return_create(salam_arena_t *arena, array_value_t *values);
 
 /**
  *
  * @function ast_print_create
  * @brief Create a new AST node print
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {array_value_t*} values - Values of the print
  * @returns {ast_print_t*} - Pointer to the created AST node if
  *
  */
-ast_print_t *ast_print_create(array_value_t *values);
+ast_print_t *ast_print_create(salam_arena_t *arena, array_value_t *values);
 
 /**
  *
@@ -542,20 +555,23 @@ char *ast_value_data(ast_value_t *value);
  *
  * @function ast_value_copy
  * @brief Copy the AST layout attribute value
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_t*} value - AST Layout Attribute Value
  * @returns {ast_value_t*} - Copied AST Layout Attribute Value
  *
  */
-ast_value_t *ast_value_copy(ast_value_t *value);
+ast_value_t *ast_value_copy(salam_arena_t *arena, ast_value_t *value);
 
 /**
  *
  * @function ast_value_type_copy
  * @brief Copy the AST layout attribute value type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_value_type_t*} type - AST Layout Attribute Value Type
  * @returns {ast_value_type_t*} - Copied AST Layout Attribute Value Type
  *
  */
-ast_value_type_t *ast_value_type_copy(ast_value_type_t *type);
+ast_value_type_t *ast_value_type_copy(salam_arena_t *arena,
+                                      ast_value_type_t *type);
 
 #endif
@@ -0,0 +1,1268 @@
+#include "ast_binary.h"
+
+/**
+ *
+ * @function ast_binary_create
+ * @brief Create an empty precompiled AST buffer, starting with its header
+ * @returns {ast_binary_t*}
+ *
+ */
+ast_binary_t *ast_binary_create(void) {
+    DEBUG_ME;
+    ast_binary_t *binary = memory_allocate(sizeof(ast_binary_t));
+
+    binary->data = NULL;
+    binary->length = 0;
+    binary->capacity = 0;
+
+    ast_binary_reserve(binary, sizeof(ast_binary_header_t));
+
+    ast_binary_header_t *header =
+        AST_BINARY_AT(binary->data, ast_binary_header_t, 0);
+
+    memcpy(header->magic, AST_BINARY_MAGIC, AST_BINARY_MAGIC_SIZE);
+    header->version = AST_BINARY_VERSION;
+
+    return binary;
+}
+
+/**
+ *
+ * @function ast_binary_reserve
+ * @brief Reserve a zeroed record at the end of the buffer
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {size_t} size - Size of the record in bytes
+ * @returns {uint32_t} - Offset of the record, aligned to 4 bytes
+ *
+ */
+uint32_t ast_binary_reserve(ast_binary_t *binary, size_t size) {
+    DEBUG_ME;
+    size_t offset = binary->length;
+    size_t length = offset + ((size + 3) & ~(size_t)3);
+
+    if (length > UINT32_MAX) {
+        panic("Precompiled AST is larger than 4 GiB");
+    }
+
+    if (length > binary->capacity) {
+        size_t capacity = binary->capacity == 0 ? 4096 : binary->capacity;
+
+        while (capacity < length) {
+            capacity *= 2;
+        }
+
+        binary->data = memory_reallocate(binary->data, capacity);
+        binary->capacity = capacity;
+    }
+
+    memset(binary->data + offset, 0, length - offset);
+
+    binary->length = length;
+
+    return (uint32_t)offset;
+}
+
+/**
+ *
+ * @function ast_binary_reserve_record
+ * @brief Reserve a zeroed record at the end of the buffer, starting with its
+ * type
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {size_t} size - Size of the record in bytes
+ * @params {ast_binary_record_t} record - Type of the record
+ * @returns {uint32_t} - Offset of the record, aligned to 4 bytes
+ *
+ */
+uint32_t ast_binary_reserve_record(ast_binary_t *binary, size_t size,
+                                   ast_binary_record_t record) {
+    DEBUG_ME;
+    uint32_t offset = ast_binary_reserve(binary, size);
+
+    *AST_BINARY_AT(binary->data, uint32_t, offset) = record;
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_string
+ * @brief Write a string record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {const char*} value - String (can be NULL)
+ * @returns {uint32_t} - Offset of the record, 0 if value is NULL
+ *
+ */
+uint32_t ast_binary_write_string(ast_binary_t *binary, const char *value) {
+    DEBUG_ME;
+    if (value == NULL) {
+        return 0;
+    }
+
+    size_t length = strlen(value);
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_string_t) + length + 1,
+        AST_BINARY_RECORD_STRING);
+    ast_binary_string_t *string =
+        AST_BINARY_AT(binary->data, ast_binary_string_t, offset);
+
+    string->length = (uint32_t)length;
+    memcpy(string->data, value, length);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_list
+ * @brief Write a list record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {const uint32_t*} items - Offsets (or pairs of a map)
+ * @params {size_t} length - Number of offsets (or pairs of a map)
+ * @params {size_t} width - 1 for a list, 2 for a map
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_list(ast_binary_t *binary, const uint32_t *items,
+                               size_t length, size_t width) {
+    DEBUG_ME;
+    size_t size = length * width * sizeof(uint32_t);
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_list_t) + size,
+        width == 1 ? AST_BINARY_RECORD_LIST : AST_BINARY_RECORD_MAP);
+    ast_binary_list_t *list =
+        AST_BINARY_AT(binary->data, ast_binary_list_t, offset);
+
+    list->length = (uint32_t)length;
+
+    if (size > 0) {
+        memcpy(list->items, items, size);
+    }
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_location
+ * @brief Store a location in a record
+ * @params {ast_binary_location_t*} out - Location of the record
+ * @params {location_t} location - Location
+ * @returns {void}
+ *
+ */
+void ast_binary_write_location(ast_binary_location_t *out,
+                               location_t location) {
+    DEBUG_ME;
+    out->index = (uint32_t)location.index;
+    out->length = (uint32_t)location.length;
+    out->start_line = (uint32_t)location.start_line;
+    out->start_column = (uint32_t)location.start_column;
+    out->end_line = (uint32_t)location.end_line;
+    out->end_column = (uint32_t)location.end_column;
+}
+
+/**
+ *
+ * @function ast_binary_write_value
+ * @brief Write a value record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_value_t*} value - AST value
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_value(ast_binary_t *binary, ast_value_t *value) {
+    DEBUG_ME;
+    uint32_t data = 0;
+
+    switch (value->type.kind) {
+        case AST_TYPE_KIND_STRING:
+            data = ast_binary_write_string(binary, value->data.string_value);
+            break;
+
+        case AST_TYPE_KIND_INT:
+            memcpy(&data, &value->data.int_value, sizeof(int));
+            break;
+
+        case AST_TYPE_KIND_FLOAT:
+            memcpy(&data, &value->data.float_value, sizeof(float));
+            break;
+
+        case AST_TYPE_KIND_CHAR:
+            data = (unsigned char)value->data.char_value;
+            break;
+
+        case AST_TYPE_KIND_BOOL:
+            data = value->data.bool_value ? 1 : 0;
+            break;
+
+        default:
+            break;
+    }
+
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_value_t), AST_BINARY_RECORD_VALUE);
+    ast_binary_value_t *record =
+        AST_BINARY_AT(binary->data, ast_binary_value_t, offset);
+
+    record->kind = value->type.kind;
+    ast_binary_write_location(&record->location, value->type.location);
+    record->data = data;
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_values
+ * @brief Write a list of value records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {array_value_t*} values - AST values (can be NULL)
+ * @returns {uint32_t} - Offset of the list, 0 if values is NULL
+ *
+ */
+uint32_t ast_binary_write_values(ast_binary_t *binary, array_value_t *values) {
+    DEBUG_ME;
+    if (values == NULL) {
+        return 0;
+    }
+
+    uint32_t *items = memory_allocate((values->length + 1) * sizeof(uint32_t));
+
+    for (size_t i = 0; i < values->length; i++) {
+        items[i] = ast_binary_write_value(binary, array_get(values, i));
+    }
+
+    uint32_t offset = ast_binary_write_list(binary, items, values->length, 1);
+
+    memory_destroy(items);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_attribute
+ * @brief Write a layout attribute record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_layout_attribute_t*} attribute - AST layout attribute
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_attribute(ast_binary_t *binary,
+                                    ast_layout_attribute_t *attribute) {
+    DEBUG_ME;
+    uint32_t key = ast_binary_write_string(binary, attribute->key);
+    uint32_t final_key = ast_binary_write_string(binary, attribute->final_key);
+    uint32_t final_value =
+        ast_binary_write_string(binary, attribute->final_value);
+    uint32_t values = ast_binary_write_values(binary, attribute->values);
+
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_attribute_t), AST_BINARY_RECORD_ATTRIBUTE);
+    ast_binary_attribute_t *record =
+        AST_BINARY_AT(binary->data, ast_binary_attribute_t, offset);
+
+    record->type = attribute->type;
+    record->parent_node_type = attribute->parent_node_type;
+
+    record->flags = (attribute->isStyle ? AST_BINARY_ATTRIBUTE_STYLE : 0) |
+                    (attribute->isContent ? AST_BINARY_ATTRIBUTE_CONTENT : 0) |
+                    (attribute->ignoreMe ? AST_BINARY_ATTRIBUTE_IGNORE : 0);
+
+    record->key = key;
+    record->final_key = final_key;
+    record->final_value = final_value;
+    record->values = values;
+
+    ast_binary_write_location(&record->key_location, attribute->key_location);
+    ast_binary_write_location(&record->value_location,
+                              attribute->value_location);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_attributes
+ * @brief Write a map of layout attribute records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {enum_map_layout_attribute_t*} map - Layout attributes
+ * @returns {uint32_t} - Offset of the map
+ *
+ */
+uint32_t ast_binary_write_attributes(ast_binary_t *binary,
+                                     enum_map_layout_attribute_t *map) {
+    DEBUG_ME;
+    uint32_t *items = memory_allocate((map->length + 1) * 2 * sizeof(uint32_t));
+
+    for (size_t i = 0; i < map->length; i++) {
+        items[i * 2] = map->keys[i];
+        items[i * 2 + 1] = ast_binary_write_attribute(binary, map->data[i]);
+    }
+
+    uint32_t offset = ast_binary_write_list(binary, items, map->length, 2);
+
+    memory_destroy(items);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_states
+ * @brief Write a map of style state records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {enum_map_layout_style_state_t*} map - Style states
+ * @returns {uint32_t} - Offset of the map
+ *
+ */
+uint32_t ast_binary_write_states(ast_binary_t *binary,
+                                 enum_map_layout_style_state_t *map) {
+    DEBUG_ME;
+    uint32_t *items = memory_allocate((map->length + 1) * 2 * sizeof(uint32_t));
+
+    for (size_t i = 0; i < map->length; i++) {
+        ast_layout_style_state_t *state = map->data[i];
+
+        uint32_t styles = ast_binary_write_attributes(binary, state->normal);
+        uint32_t new_styles = ast_binary_write_attributes(binary, state->new);
+
+        uint32_t offset = ast_binary_reserve_record(
+            binary, sizeof(ast_binary_state_t), AST_BINARY_RECORD_STATE);
+        ast_binary_state_t *record =
+            AST_BINARY_AT(binary->data, ast_binary_state_t, offset);
+
+        record->styles = styles;
+        record->new_styles = new_styles;
+
+        items[i * 2] = map->keys[i];
+        items[i * 2 + 1] = offset;
+    }
+
+    uint32_t offset = ast_binary_write_list(binary, items, map->length, 2);
+
+    memory_destroy(items);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_layout_nodes
+ * @brief Write a list of layout node records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {array_node_layout_t*} nodes - AST layout nodes
+ * @returns {uint32_t} - Offset of the list
+ *
+ */
+uint32_t ast_binary_write_layout_nodes(ast_binary_t *binary,
+                                       array_node_layout_t *nodes) {
+    DEBUG_ME;
+    uint32_t *items = memory_allocate((nodes->length + 1) * sizeof(uint32_t));
+
+    for (size_t i = 0; i < nodes->length; i++) {
+        ast_layout_node_t *node = array_get(nodes, i);
+
+        uint32_t block = ast_binary_write_block(binary, node->block);
+
+        uint32_t offset = ast_binary_reserve_record(
+            binary, sizeof(ast_binary_layout_node_t),
+            AST_BINARY_RECORD_LAYOUT_NODE);
+        ast_binary_layout_node_t *record =
+            AST_BINARY_AT(binary->data, ast_binary_layout_node_t, offset);
+
+        record->type = node->type;
+        record->block = block;
+
+        items[i] = offset;
+    }
+
+    uint32_t offset = ast_binary_write_list(binary, items, nodes->length, 1);
+
+    memory_destroy(items);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_block
+ * @brief Write a layout block record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_layout_block_t*} block - AST layout block
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_block(ast_binary_t *binary,
+                                ast_layout_block_t *block) {
+    DEBUG_ME;
+    uint32_t text_content =
+        ast_binary_write_string(binary, block->text_content);
+    uint32_t attributes =
+        ast_binary_write_attributes(binary, block->attributes);
+    uint32_t styles =
+        ast_binary_write_attributes(binary, block->styles->normal);
+    uint32_t new_styles =
+        ast_binary_write_attributes(binary, block->styles->new);
+    uint32_t states = ast_binary_write_states(binary, block->states);
+    uint32_t children = ast_binary_write_layout_nodes(binary, block->children);
+    uint32_t meta_children =
+        ast_binary_write_layout_nodes(binary, block->meta_children);
+
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_block_t), AST_BINARY_RECORD_BLOCK);
+    ast_binary_block_t *record =
+        AST_BINARY_AT(binary->data, ast_binary_block_t, offset);
+
+    record->type = block->type;
+    record->parent_type = block->parent_type;
+    record->parent_node_type = block->parent_node_type;
+    record->text_content = text_content;
+    record->attributes = attributes;
+    record->styles = styles;
+    record->new_styles = new_styles;
+    record->states = states;
+    record->children = children;
+    record->meta_children = meta_children;
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_node
+ * @brief Write a statement record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_node_t*} node - AST node
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_node(ast_binary_t *binary, ast_node_t *node) {
+    DEBUG_ME;
+    uint32_t values = 0;
+    uint32_t condition = 0;
+    uint32_t statements = 0;
+    uint32_t else_blocks = 0;
+    uint32_t function = 0;
+    uint32_t layout = 0;
+
+    switch (node->type) {
+        case AST_TYPE_PRINT:
+            values = ast_binary_write_values(binary, node->data.print->values);
+            break;
+
+        case AST_TYPE_RETURN:
+            values =
+                ast_binary_write_values(binary, node->data.returns->values);
+            break;
+
+        case AST_TYPE_IF:
+        case AST_TYPE_ELSE_IF:
+            if (node->data.ifclause->condition != NULL) {
+                condition = ast_binary_write_value(
+                    binary, node->data.ifclause->condition);
+            }
+
+            statements = ast_binary_write_nodes(
+                binary, node->data.ifclause->block->children);
+            else_blocks = ast_binary_write_nodes(
+                binary, node->data.ifclause->else_blocks);
+            break;
+
+        case AST_TYPE_FUNCTION:
+            function =
+                ast_binary_write_function(binary, node->data.function);
+            break;
+
+        case AST_TYPE_LAYOUT:
+            layout =
+                ast_binary_write_block(binary, node->data.layout->block);
+            break;
+
+        default:
+            error(1, "Statement of type %d cannot be precompiled",
+                  node->type);
+            break;
+    }
+
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_node_t), AST_BINARY_RECORD_NODE);
+    ast_binary_node_t *record =
+        AST_BINARY_AT(binary->data, ast_binary_node_t, offset);
+
+    record->type = node->type;
+    ast_binary_write_location(&record->location, node->location);
+    record->values = values;
+    record->condition = condition;
+    record->statements = statements;
+    record->else_blocks = else_blocks;
+    record->function = function;
+    record->layout = layout;
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_nodes
+ * @brief Write a list of statement records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {array_node_t*} nodes - AST nodes (can be NULL)
+ * @returns {uint32_t} - Offset of the list, 0 if nodes is NULL
+ *
+ */
+uint32_t ast_binary_write_nodes(ast_binary_t *binary, array_node_t *nodes) {
+    DEBUG_ME;
+    if (nodes == NULL) {
+        return 0;
+    }
+
+    uint32_t *items = memory_allocate((nodes->length + 1) * sizeof(uint32_t));
+
+    for (size_t i = 0; i < nodes->length; i++) {
+        items[i] = ast_binary_write_node(binary, array_get(nodes, i));
+    }
+
+    uint32_t offset = ast_binary_write_list(binary, items, nodes->length, 1);
+
+    memory_destroy(items);
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write_function
+ * @brief Write a function record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_function_t*} function - AST function
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_function(ast_binary_t *binary,
+                                   ast_function_t *function) {
+    DEBUG_ME;
+    uint32_t name = ast_binary_write_string(binary, function->name);
+    uint32_t statements =
+        ast_binary_write_nodes(binary, function->block->children);
+
+    uint32_t offset = ast_binary_reserve_record(
+        binary, sizeof(ast_binary_function_t), AST_BINARY_RECORD_FUNCTION);
+    ast_binary_function_t *record =
+        AST_BINARY_AT(binary->data, ast_binary_function_t, offset);
+
+    record->name = name;
+    record->statements = statements;
+
+    return offset;
+}
+
+/**
+ *
+ * @function ast_binary_write
+ * @brief Write an AST to a new precompiled AST buffer
+ * @params {ast_t*} ast - AST, parsed and validated
+ * @returns {ast_binary_t*}
+ *
+ */
+ast_binary_t *ast_binary_write(ast_t *ast) {
+    DEBUG_ME;
+    ast_binary_t *binary = ast_binary_create();
+
+    uint32_t layout = 0;
+
+    if (ast->layout != NULL) {
+        layout = ast_binary_write_block(binary, ast->layout->block);
+    }
+
+    uint32_t *items =
+        memory_allocate((ast->functions->length + 1) * sizeof(uint32_t));
+
+    for (size_t i = 0; i < ast->functions->length; i++) {
+        items[i] =
+            ast_binary_write_function(binary, array_get(ast->functions, i));
+    }
+
+    uint32_t functions =
+        ast_binary_write_list(binary, items, ast->functions->length, 1);
+
+    memory_destroy(items);
+
+    ast_binary_header_t *header =
+        AST_BINARY_AT(binary->data, ast_binary_header_t, 0);
+
+    header->size = (uint32_t)binary->length;
+    header->layout = layout;
+    header->functions = functions;
+
+    return binary;
+}
+
+/**
+ *
+ * @function ast_binary_save
+ * @brief Write an AST to a .salamc file
+ * @params {ast_t*} ast - AST, parsed and validated
+ * @params {const char*} path - Path of the file
+ * @returns {bool}
+ *
+ */
+bool ast_binary_save(ast_t *ast, const char *path) {
+    DEBUG_ME;
+    ast_binary_t *binary = ast_binary_write(ast);
+
+    bool saved = file_writes_binary(path, binary->data, binary->length);
+
+    ast_binary_destroy(binary);
+
+    return saved;
+}
+
+/**
+ *
+ * @function ast_binary_destroy
+ * @brief Free a precompiled AST buffer
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @returns {void}
+ *
+ */
+void ast_binary_destroy(ast_binary_t *binary) {
+    DEBUG_ME;
+    if (binary != NULL) {
+        if (binary->data != NULL) {
+            memory_destroy(binary->data);
+        }
+
+        memory_destroy(binary);
+    }
+}
+
+/**
+ *
+ * @function ast_binary_is_path
+ * @brief Check if a path is a precompiled AST by its extension
+ * @params {const char*} path - Path of the file
+ * @returns {bool}
+ *
+ */
+bool ast_binary_is_path(const char *path) {
+    DEBUG_ME;
+    size_t length = strlen(path);
+    size_t extension_length = strlen(AST_BINARY_EXTENSION);
+
+    return length > extension_length &&
+           strcmp(path + length - extension_length, AST_BINARY_EXTENSION) ==
+               0;
+}
+
+/**
+ *
+ * @function ast_binary_read
+ * @brief Get a record, the file is rejected if it does not hold the record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {size_t} size - Size of the record in bytes
+ * @returns {const void*}
+ *
+ */
+const void *ast_binary_read(ast_binary_reader_t *reader, uint32_t offset,
+                            size_t size) {
+    DEBUG_ME;
+    if (offset < sizeof(ast_binary_header_t) || offset % 4 != 0 ||
+        size > reader->size || offset > reader->size - size) {
+        error(1, "Precompiled AST '%s' is corrupted at offset %u",
+              reader->path, offset);
+    }
+
+    return reader->data + offset;
+}
+
+/**
+ *
+ * @function ast_binary_read_record
+ * @brief Get a record, the file is rejected if it does not hold a record of
+ * this type there
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {size_t} size - Size of the record in bytes
+ * @params {ast_binary_record_t} record - Type of the record
+ * @returns {const void*}
+ *
+ */
+const void *ast_binary_read_record(ast_binary_reader_t *reader,
+                                   uint32_t offset, size_t size,
+                                   ast_binary_record_t record) {
+    DEBUG_ME;
+    const uint32_t *data = ast_binary_read(reader, offset, size);
+
+    if (*data != record) {
+        error(1, "Precompiled AST '%s' is corrupted at offset %u",
+              reader->path, offset);
+    }
+
+    return data;
+}
+
+/**
+ *
+ * @function ast_binary_read_type
+ * @brief Check that a stored enum value is one of the values of its enum
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} value - Stored value
+ * @params {uint32_t} count - Number of values of the enum
+ * @params {uint32_t} offset - Offset of the record holding the value
+ * @returns {uint32_t} - The value
+ *
+ */
+uint32_t ast_binary_read_type(ast_binary_reader_t *reader, uint32_t value,
+                              uint32_t count, uint32_t offset) {
+    DEBUG_ME;
+    if (value >= count) {
+        error(1, "Precompiled AST '%s' is corrupted at offset %u",
+              reader->path, offset);
+    }
+
+    return value;
+}
+
+/**
+ *
+ * @function ast_binary_read_before
+ * @brief Check that a record is before the record which refers to it. The
+ * writer writes every record before the records referring to it, so the
+ * reader cannot be sent back to a record it is already reading
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {uint32_t} parent - Offset of the record which refers to it
+ * @returns {void}
+ *
+ */
+void ast_binary_read_before(ast_binary_reader_t *reader, uint32_t offset,
+                            uint32_t parent) {
+    DEBUG_ME;
+    if (offset >= parent) {
+        error(1, "Precompiled AST '%s' is corrupted at offset %u",
+              reader->path, parent);
+    }
+}
+
+/**
+ *
+ * @function ast_binary_read_list
+ * @brief Get a list record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {size_t} width - 1 for a list, 2 for a map
+ * @returns {const ast_binary_list_t*}
+ *
+ */
+const ast_binary_list_t *ast_binary_read_list(ast_binary_reader_t *reader,
+                                              uint32_t offset, size_t width) {
+    DEBUG_ME;
+    const ast_binary_list_t *list = ast_binary_read_record(
+        reader, offset, sizeof(ast_binary_list_t),
+        width == 1 ? AST_BINARY_RECORD_LIST : AST_BINARY_RECORD_MAP);
+
+    ast_binary_read(reader, offset,
+                    sizeof(ast_binary_list_t) +
+                        (size_t)list->length * width * sizeof(uint32_t));
+
+    return list;
+}
+
+/**
+ *
+ * @function ast_binary_read_string
+ * @brief Get the text of a string record, it points into the file
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record (can be 0)
+ * @returns {const char*} - NULL if offset is 0
+ *
+ */
+const char *ast_binary_read_string(ast_binary_reader_t *reader,
+                                   uint32_t offset) {
+    DEBUG_ME;
+    if (offset == 0) {
+        return NULL;
+    }
+
+    const ast_binary_string_t *string = ast_binary_read_record(
+        reader, offset, sizeof(ast_binary_string_t), AST_BINARY_RECORD_STRING);
+
+    ast_binary_read(reader, offset,
+                    sizeof(ast_binary_string_t) + (size_t)string->length + 1);
+
+    if (string->data[string->length] != '\0') {
+        error(1, "Precompiled AST '%s' is corrupted at offset %u",
+              reader->path, offset);
+    }
+
+    return string->data;
+}
+
+/**
+ *
+ * @function ast_binary_read_location
+ * @brief Get a location stored in a record
+ * @params {const ast_binary_location_t*} location - Location of the record
+ * @returns {location_t}
+ *
+ */
+location_t ast_binary_read_location(const ast_binary_location_t *location) {
+    DEBUG_ME;
+    location_t result;
+
+    result.index = location->index;
+    result.length = location->length;
+    result.start_line = location->start_line;
+    result.start_column = location->start_column;
+    result.end_line = location->end_line;
+    result.end_column = location->end_column;
+
+    return result;
+}
+
+/**
+ *
+ * @function ast_binary_read_value
+ * @brief Read a value record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @returns {ast_value_t*}
+ *
+ */
+ast_value_t *ast_binary_read_value(ast_binary_reader_t *reader,
+                                   uint32_t offset) {
+    DEBUG_ME;
+    const ast_binary_value_t *record = ast_binary_read_record(
+        reader, offset, sizeof(ast_binary_value_t), AST_BINARY_RECORD_VALUE);
+    location_t location = ast_binary_read_location(&record->location);
+
+    ast_binary_read_type(reader, record->kind, AST_BINARY_VALUE_KINDS, offset);
+
+    if (record->kind == AST_TYPE_KIND_STRING) {
+        // A string value always has its text
+        if (record->data == 0) {
+            error(1, "Precompiled AST '%s' is corrupted at offset %u",
+                  reader->path, offset);
+        }
+
+        return ast_value_create(reader->arena, AST_TYPE_KIND_STRING, location,
+                                ast_binary_read_string(reader, record->data));
+    }
+
+    ast_value_t *value =
+        ast_value_create(reader->arena, record->kind, location, NULL);
+
+    switch (record->kind) {
+        case AST_TYPE_KIND_INT:
+            memcpy(&value->data.int_value, &record->data, sizeof(int));
+            break;
+
+        case AST_TYPE_KIND_FLOAT:
+            memcpy(&value->data.float_value, &record->data, sizeof(float));
+            break;
+
+        case AST_TYPE_KIND_CHAR:
+            value->data.char_value = (char)record->data;
+            break;
+
+        case AST_TYPE_KIND_BOOL:
+            value->data.bool_value = record->data != 0;
+            break;
+
+        default:
+            break;
+    }
+
+    return value;
+}
+
+/**
+ *
+ * @function ast_binary_read_values
+ * @brief Read a list of value records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the list
+ * @params {array_value_t*} values - AST values to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_values(ast_binary_reader_t *reader, uint32_t offset,
+                            array_value_t *values) {
+    DEBUG_ME;
+    const ast_binary_list_t *list = ast_binary_read_list(reader, offset, 1);
+
+    for (uint32_t i = 0; i < list->length; i++) {
+        array_push(values, ast_binary_read_value(reader, list->items[i]));
+    }
+}
+
+/**
+ *
+ * @function ast_binary_read_attribute
+ * @brief Read a layout attribute record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @returns {ast_layout_attribute_t*}
+ *
+ */
+ast_layout_attribute_t *ast_binary_read_attribute(ast_binary_reader_t *reader,
+                                                  uint32_t offset) {
+    DEBUG_ME;
+    const ast_binary_attribute_t *record =
+        ast_binary_read_record(reader, offset, sizeof(ast_binary_attribute_t),
+                               AST_BINARY_RECORD_ATTRIBUTE);
+    array_value_t *values = array_value_create(reader->arena, 1);
+
+    ast_binary_read_type(reader, record->type, AST_LAYOUT_ATTRIBUTE_TYPES,
+                         offset);
+    ast_binary_read_type(reader, record->parent_node_type,
+                         AST_BINARY_LAYOUT_TYPES, offset);
+
+    ast_binary_read_values(reader, record->values, values);
+
+    // The validator reads the first value of every attribute
+    if (values->length == 0) {
+        error(1, "Precompiled AST '%s' is corrupted at offset %u",
+              reader->path, offset);
+    }
+
+    ast_layout_attribute_t *attribute = ast_layout_attribute_create(
+        reader->arena, record->type,
+        ast_binary_read_string(reader, record->key), values,
+        record->parent_node_type,
+        ast_binary_read_location(&record->key_location),
+        ast_binary_read_location(&record->value_location));
+
+    attribute->isStyle = (record->flags & AST_BINARY_ATTRIBUTE_STYLE) != 0;
+    attribute->isContent = (record->flags & AST_BINARY_ATTRIBUTE_CONTENT) != 0;
+    attribute->ignoreMe = (record->flags & AST_BINARY_ATTRIBUTE_IGNORE) != 0;
+
+    ast_layout_attribute_set_final_key(
+        attribute, ast_binary_read_string(reader, record->final_key));
+    ast_layout_attribute_set_final_value(
+        attribute, ast_binary_read_string(reader, record->final_value));
+
+    return attribute;
+}
+
+/**
+ *
+ * @function ast_binary_read_attributes
+ * @brief Read a map of layout attribute records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the map
+ * @params {enum_map_layout_attribute_t*} map - Layout attributes to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_attributes(ast_binary_reader_t *reader, uint32_t offset,
+                                enum_map_layout_attribute_t *map) {
+    DEBUG_ME;
+    const ast_binary_list_t *list = ast_binary_read_list(reader, offset, 2);
+
+    for (uint32_t i = 0; i < list->length; i++) {
+        ast_binary_read_type(reader, list->items[i * 2],
+                             AST_LAYOUT_ATTRIBUTE_TYPES, offset);
+
+        enum_map_put(map, list->items[i * 2],
+                     ast_binary_read_attribute(reader, list->items[i * 2 + 1]));
+    }
+}
+
+/**
+ *
+ * @function ast_binary_read_states
+ * @brief Read a map of style state records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the map
+ * @params {enum_map_layout_style_state_t*} map - Style states to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_states(ast_binary_reader_t *reader, uint32_t offset,
+                            enum_map_layout_style_state_t *map) {
+    DEBUG_ME;
+    const ast_binary_list_t *list = ast_binary_read_list(reader, offset, 2);
+
+    for (uint32_t i = 0; i < list->length; i++) {
+        const ast_binary_state_t *record =
+            ast_binary_read_record(reader, list->items[i * 2 + 1],
+                                   sizeof(ast_binary_state_t),
+                                   AST_BINARY_RECORD_STATE);
+
+        ast_binary_read_type(reader, list->items[i * 2],
+                             AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR + 1,
+                             offset);
+
+        ast_layout_style_state_t *state =
+            ast_layout_style_state_create(reader->arena);
+
+        ast_binary_read_attributes(reader, record->styles, state->normal);
+        ast_binary_read_attributes(reader, record->new_styles, state->new);
+
+        enum_map_put(map, list->items[i * 2], state);
+    }
+}
+
+/**
+ *
+ * @function ast_binary_read_layout_nodes
+ * @brief Read a list of layout node records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the list
+ * @params {array_node_layout_t*} nodes - AST layout nodes to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_layout_nodes(ast_binary_reader_t *reader,
+                                  uint32_t offset, array_node_layout_t *nodes) {
+    DEBUG_ME;
+    const ast_binary_list_t *list = ast_binary_read_list(reader, offset, 1);
+
+    for (uint32_t i = 0; i < list->length; i++) {
+        ast_binary_read_before(reader, list->items[i], offset);
+
+        const ast_binary_layout_node_t *record =
+            ast_binary_read_record(reader, list->items[i],
+                                   sizeof(ast_binary_layout_node_t),
+                                   AST_BINARY_RECORD_LAYOUT_NODE);
+
+        ast_binary_read_before(reader, record->block, list->items[i]);
+
+        ast_layout_node_t *node = ast_layout_node_create(
+            reader->arena,
+            ast_binary_read_type(reader, record->type,
+                                 AST_BINARY_LAYOUT_TYPES, list->items[i]));
+
+        ast_binary_read_block(reader, record->block, node->block);
+
+        array_push(nodes, node);
+    }
+}
+
+/**
+ *
+ * @function ast_binary_read_block
+ * @brief Read a layout block record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {ast_layout_block_t*} block - AST layout block to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_block(ast_binary_reader_t *reader, uint32_t offset,
+                           ast_layout_block_t *block) {
+    DEBUG_ME;
+    const ast_binary_block_t *record = ast_binary_read_record(
+        reader, offset, sizeof(ast_binary_block_t), AST_BINARY_RECORD_BLOCK);
+
+    block->type = ast_binary_read_type(reader, record->type,
+                                       AST_BINARY_BLOCK_TYPES, offset);
+    block->parent_type = ast_binary_read_type(reader, record->parent_type,
+                                              AST_BINARY_TYPES, offset);
+    block->parent_node_type = ast_binary_read_type(
+        reader, record->parent_node_type, AST_BINARY_LAYOUT_TYPES, offset);
+
+    ast_layout_block_set_text_content(
+        block, ast_binary_read_string(reader, record->text_content));
+
+    ast_binary_read_attributes(reader, record->attributes, block->attributes);
+    ast_binary_read_attributes(reader, record->styles, block->styles->normal);
+    ast_binary_read_attributes(reader, record->new_styles, block->styles->new);
+    ast_binary_read_states(reader, record->states, block->states);
+
+    ast_binary_read_before(reader, record->children, offset);
+    ast_binary_read_before(reader, record->meta_children, offset);
+
+    ast_binary_read_layout_nodes(reader, record->children, block->children);
+    ast_binary_read_layout_nodes(reader, record->meta_children,
+                                 block->meta_children);
+}
+
+/**
+ *
+ * @function ast_binary_read_node
+ * @brief Read a statement record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {bool} in_else - Whether the statement is an else if or an else
+ * @returns {ast_node_t*}
+ *
+ */
+ast_node_t *ast_binary_read_node(ast_binary_reader_t *reader, uint32_t offset,
+                                 bool in_else) {
+    DEBUG_ME;
+    const ast_binary_node_t *record = ast_binary_read_record(
+        reader, offset, sizeof(ast_binary_node_t), AST_BINARY_RECORD_NODE);
+    ast_node_t *node = ast_node_create(
+        reader->arena,
+        ast_binary_read_type(reader, record->type, AST_BINARY_TYPES, offset),
+        ast_binary_read_location(&record->location));
+    array_value_t *values = NULL;
+
+    switch (record->type) {
+        case AST_TYPE_PRINT:
+        case AST_TYPE_RETURN:
+            values = array_value_create(reader->arena, 1);
+
+            ast_binary_read_values(reader, record->values, values);
+
+            if (record->type == AST_TYPE_PRINT) {
+                node->data.print = ast_print_create(reader->arena, values);
+            } else {
+                node->data.returns = ast_return_create(reader->arena, values);
+            }
+            break;
+
+        case AST_TYPE_IF:
+        case AST_TYPE_ELSE_IF: {
+            ast_value_t *condition =
+                record->condition == 0
+                    ? NULL
+                    : ast_binary_read_value(reader, record->condition);
+
+            // Like the parser: an if, then in its else blocks an else if is
+            // an if node and an else is an else if node
+            if (!in_else) {
+                node->data.ifclause = ast_if_create(reader->arena, condition);
+
+                ast_binary_read_before(reader, record->else_blocks, offset);
+                ast_binary_read_nodes(reader, record->else_blocks, true,
+                                      node->data.ifclause->else_blocks);
+            } else if (record->type == AST_TYPE_IF) {
+                node->data.ifclause =
+                    ast_elseif_create(reader->arena, condition);
+            } else {
+                node->data.ifclause = ast_else_create(reader->arena);
+            }
+
+            ast_binary_read_before(reader, record->statements, offset);
+            ast_binary_read_nodes(reader, record->statements, false,
+                                  node->data.ifclause->block->children);
+            break;
+        }
+
+        case AST_TYPE_FUNCTION:
+            ast_binary_read_before(reader, record->function, offset);
+
+            node->data.function =
+                ast_binary_read_function(reader, record->function);
+            break;
+
+        case AST_TYPE_LAYOUT:
+            node->data.layout = ast_layout_create(reader->arena);
+
+            ast_binary_read_before(reader, record->layout, offset);
+            ast_binary_read_block(reader, record->layout,
+                                  node->data.layout->block);
+            break;
+
+        default:
+            error(1, "Precompiled AST '%s' is corrupted at offset %u",
+                  reader->path, offset);
+            break;
+    }
+
+    return node;
+}
+
+/**
+ *
+ * @function ast_binary_read_nodes
+ * @brief Read a list of statement records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the list
+ * @params {bool} in_else - Whether the statements are else ifs and elses
+ * @params {array_node_t*} nodes - AST nodes to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_nodes(ast_binary_reader_t *reader, uint32_t offset,
+                           bool in_else, array_node_t *nodes) {
+    DEBUG_ME;
+    const ast_binary_list_t *list = ast_binary_read_list(reader, offset, 1);
+
+    for (uint32_t i = 0; i < list->length; i++) {
+        ast_binary_read_before(reader, list->items[i], offset);
+
+        array_push(nodes,
+                   ast_binary_read_node(reader, list->items[i], in_else));
+    }
+}
+
+/**
+ *
+ * @function ast_binary_read_function
+ * @brief Read a function record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @returns {ast_function_t*}
+ *
+ */
+ast_function_t *ast_binary_read_function(ast_binary_reader_t *reader,
+                                         uint32_t offset) {
+    DEBUG_ME;
+    const ast_binary_function_t *record =
+        ast_binary_read_record(reader, offset, sizeof(ast_binary_function_t),
+                               AST_BINARY_RECORD_FUNCTION);
+
+    ast_function_t *function = ast_function_create(
+        reader->arena, ast_binary_read_string(reader, record->name));
+
+    ast_binary_read_before(reader, record->statements, offset);
+    ast_binary_read_nodes(reader, record->statements, false,
+                          function->block->children);
+
+    return function;
+}
+
+/**
+ *
+ * @function ast_binary_load
+ * @brief Build the AST of a precompiled AST, without lexing, parsing or
+ * validating it again. Strings are copied, so the data can be unmapped after
+ * @params {salam_arena_t*} arena - Arena the AST is built in
+ * @params {const char*} path - Path of the file, for errors
+ * @params {const char*} data - Content of the file
+ * @params {size_t} size - Size of the content in bytes
+ * @returns {ast_t*}
+ *
+ */
+ast_t *ast_binary_load(salam_arena_t *arena, const char *path,
+                       const char *data, size_t size) {
+    DEBUG_ME;
+    ast_binary_reader_t reader = {data, size, path, arena};
+    const ast_binary_header_t *header = (const ast_binary_header_t *)data;
+
+    if (size < sizeof(ast_binary_header_t) ||
+        memcmp(header->magic, AST_BINARY_MAGIC, AST_BINARY_MAGIC_SIZE) != 0) {
+        error(1, "File '%s' is not a precompiled AST", path);
+    } else if (header->version != AST_BINARY_VERSION) {
+        error(1,
+              "Precompiled AST '%s' has version %u but version %u is "
+              "expected, compile it again",
+              path, header->version, AST_BINARY_VERSION);
+    } else if (header->size != size) {
+        error(1, "Precompiled AST '%s' is truncated", path);
+    }
+
+    ast_t *ast = ast_create(arena);
+
+    if (header->layout != 0) {
+        ast->layout = ast_layout_create(arena);
+
+        ast_binary_read_block(&reader, header->layout, ast->layout->block);
+    }
+
+    const ast_binary_list_t *functions =
+        ast_binary_read_list(&reader, header->functions, 1);
+
+    for (uint32_t i = 0; i < functions->length; i++) {
+        array_push(ast->functions,
+                   ast_binary_read_function(&reader, functions->items[i]));
+    }
+
+    return ast;
+}
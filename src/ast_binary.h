@@ -0,0 +1,670 @@
+#ifndef _AST_BINARY_H_
+#define _AST_BINARY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "arena.h"
+#include "ast.h"
+#include "ast_layout.h"
+#include "base.h"
+#include "file.h"
+#include "log.h"
+#include "memory.h"
+
+// A precompiled AST (.salamc) is the AST of a parsed and validated file
+// stored as flat records of 32-bit words. Records refer to each other by
+// their offset from the start of the file, 0 being none, so the file is
+// position independent and is read in place from its mapping. The version
+// must be bumped whenever a record or a stored enum (node, attribute, style
+// state or value types) changes
+#define AST_BINARY_MAGIC "SALAMC\r\n"
+#define AST_BINARY_MAGIC_SIZE 8
+#define AST_BINARY_VERSION 2
+#define AST_BINARY_EXTENSION ".salamc"
+
+// First word of every record but the header, a record is only read as the
+// type it was written as
+typedef enum {
+    AST_BINARY_RECORD_LIST = 1,
+    AST_BINARY_RECORD_MAP,
+    AST_BINARY_RECORD_STRING,
+    AST_BINARY_RECORD_VALUE,
+    AST_BINARY_RECORD_ATTRIBUTE,
+    AST_BINARY_RECORD_STATE,
+    AST_BINARY_RECORD_BLOCK,
+    AST_BINARY_RECORD_LAYOUT_NODE,
+    AST_BINARY_RECORD_NODE,
+    AST_BINARY_RECORD_FUNCTION,
+} ast_binary_record_t;
+
+// Number of values of the stored enums, counted from the same tables. A
+// stored value outside its enum is rejected, as the generator indexes tables
+// with it
+enum {
+    AST_BINARY_TYPES = 0
+#undef ADD_TYPE
+#define ADD_TYPE(TYPE, NAME, NAME_LOWER) +1
+
+#include "ast_type.h"
+};
+
+enum {
+    AST_BINARY_BLOCK_TYPES = 0
+#undef ADD_BLOCK_TYPE
+#define ADD_BLOCK_TYPE(TYPE, NAME, NAME_LOWER) +1
+
+#include "ast_block_type.h"
+};
+
+enum {
+    AST_BINARY_VALUE_KINDS = 0
+#undef ADD_VALUE_KIND
+#define ADD_VALUE_KIND(TYPE, NAME, NAME_LOWER) +1
+
+#include "ast_value_kind.h"
+};
+
+enum {
+    AST_BINARY_LAYOUT_TYPES = 0
+#undef ADD_LAYOUT_TYPE
+#undef ADD_LAYOUT_TYPE_HIDE
+#undef ADD_LAYOUT_TYPE_REPEAT
+
+#define ADD_LAYOUT_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, ENDUSER_NAME, \
+                        IS_MOTHER)                                            \
+    +1
+#define ADD_LAYOUT_TYPE_HIDE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
+                             ENDUSER_NAME, IS_MOTHER)                \
+    +1
+#define ADD_LAYOUT_TYPE_REPEAT(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
+                               ENDUSER_NAME, IS_MOTHER)
+
+#include "ast_layout_type.h"
+};
+
+// Flags of ast_binary_attribute_t
+#define AST_BINARY_ATTRIBUTE_STYLE 1
+#define AST_BINARY_ATTRIBUTE_CONTENT 2
+#define AST_BINARY_ATTRIBUTE_IGNORE 4
+
+typedef struct {
+    char magic[AST_BINARY_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t size;  // of the whole file in bytes
+    uint32_t layout;  // ast_binary_block_t, 0 if the file has no layout
+    uint32_t functions;  // list of ast_binary_function_t
+} ast_binary_header_t;
+
+typedef struct {
+    uint32_t index;
+    uint32_t length;
+    uint32_t start_line;
+    uint32_t start_column;
+    uint32_t end_line;
+    uint32_t end_column;
+} ast_binary_location_t;
+
+// A list holds offsets, a map holds pairs of a key and an offset
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t length;  // number of offsets, or of pairs for a map
+    uint32_t items[];
+} ast_binary_list_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t length;  // in bytes, the text is NUL-terminated
+    char data[];
+} ast_binary_string_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t kind;  // ast_value_kind_t
+    ast_binary_location_t location;
+    uint32_t data;  // string of a string value, the union bits otherwise
+} ast_binary_value_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t type;  // ast_layout_attribute_type_t
+    uint32_t parent_node_type;
+    uint32_t flags;  // AST_BINARY_ATTRIBUTE_*
+    uint32_t key;  // string
+    uint32_t final_key;  // string
+    uint32_t final_value;  // string
+    uint32_t values;  // list of ast_binary_value_t
+    ast_binary_location_t key_location;
+    ast_binary_location_t value_location;
+} ast_binary_attribute_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t styles;  // map of ast_binary_attribute_t
+    uint32_t new_styles;  // map of ast_binary_attribute_t
+} ast_binary_state_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t type;  // ast_block_type_t
+    uint32_t parent_type;
+    uint32_t parent_node_type;
+    uint32_t text_content;  // string
+    uint32_t attributes;  // map of ast_binary_attribute_t
+    uint32_t styles;  // map of ast_binary_attribute_t
+    uint32_t new_styles;  // map of ast_binary_attribute_t
+    uint32_t states;  // map of ast_binary_state_t
+    uint32_t children;  // list of ast_binary_layout_node_t
+    uint32_t meta_children;  // list of ast_binary_layout_node_t
+} ast_binary_block_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t type;  // ast_layout_node_type_t
+    uint32_t block;  // ast_binary_block_t
+} ast_binary_layout_node_t;
+
+// A statement: print, return, if, else if, else, function or layout
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t type;  // ast_type_t
+    ast_binary_location_t location;
+    uint32_t values;  // list of ast_binary_value_t, print and return
+    uint32_t condition;  // ast_binary_value_t, if and else if
+    uint32_t statements;  // list of ast_binary_node_t, if and else
+    uint32_t else_blocks;  // list of ast_binary_node_t, if
+    uint32_t function;  // ast_binary_function_t, function
+    uint32_t layout;  // ast_binary_block_t, layout
+} ast_binary_node_t;
+
+typedef struct {
+    uint32_t record;  // ast_binary_record_t
+    uint32_t name;  // string
+    uint32_t statements;  // list of ast_binary_node_t
+} ast_binary_function_t;
+
+// Buffer a precompiled AST is written to
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} ast_binary_t;
+
+// A precompiled AST being read
+typedef struct {
+    const char *data;
+    size_t size;
+    const char *path;  // for errors
+    salam_arena_t *arena;  // the AST is built in it
+} ast_binary_reader_t;
+
+// Record of a buffer or a reader at an offset
+#define AST_BINARY_AT(DATA, TYPE, OFFSET) ((TYPE *)((DATA) + (OFFSET)))
+
+/**
+ *
+ * @function ast_binary_create
+ * @brief Create an empty precompiled AST buffer, starting with its header
+ * @returns {ast_binary_t*}
+ *
+ */
+ast_binary_t *ast_binary_create(void);
+
+/**
+ *
+ * @function ast_binary_reserve
+ * @brief Reserve a zeroed record at the end of the buffer
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {size_t} size - Size of the record in bytes
+ * @returns {uint32_t} - Offset of the record, aligned to 4 bytes
+ *
+ */
+uint32_t ast_binary_reserve(ast_binary_t *binary, size_t size);
+
+/**
+ *
+ * @function ast_binary_reserve_record
+ * @brief Reserve a zeroed record at the end of the buffer, starting with its
+ * type
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {size_t} size - Size of the record in bytes
+ * @params {ast_binary_record_t} record - Type of the record
+ * @returns {uint32_t} - Offset of the record, aligned to 4 bytes
+ *
+ */
+uint32_t ast_binary_reserve_record(ast_binary_t *binary, size_t size,
+                                   ast_binary_record_t record);
+
+/**
+ *
+ * @function ast_binary_write_string
+ * @brief Write a string record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {const char*} value - String (can be NULL)
+ * @returns {uint32_t} - Offset of the record, 0 if value is NULL
+ *
+ */
+uint32_t ast_binary_write_string(ast_binary_t *binary, const char *value);
+
+/**
+ *
+ * @function ast_binary_write_list
+ * @brief Write a list record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {const uint32_t*} items - Offsets (or pairs of a map)
+ * @params {size_t} length - Number of offsets (or pairs of a map)
+ * @params {size_t} width - 1 for a list, 2 for a map
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_list(ast_binary_t *binary, const uint32_t *items,
+                               size_t length, size_t width);
+
+/**
+ *
+ * @function ast_binary_write_location
+ * @brief Store a location in a record
+ * @params {ast_binary_location_t*} out - Location of the record
+ * @params {location_t} location - Location
+ * @returns {void}
+ *
+ */
+void ast_binary_write_location(ast_binary_location_t *out,
+                               location_t location);
+
+/**
+ *
+ * @function ast_binary_write_value
+ * @brief Write a value record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_value_t*} value - AST value
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_value(ast_binary_t *binary, ast_value_t *value);
+
+/**
+ *
+ * @function ast_binary_write_values
+ * @brief Write a list of value records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {array_value_t*} values - AST values (can be NULL)
+ * @returns {uint32_t} - Offset of the list, 0 if values is NULL
+ *
+ */
+uint32_t ast_binary_write_values(ast_binary_t *binary, array_value_t *values);
+
+/**
+ *
+ * @function ast_binary_write_attribute
+ * @brief Write a layout attribute record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_layout_attribute_t*} attribute - AST layout attribute
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_attribute(ast_binary_t *binary,
+                                    ast_layout_attribute_t *attribute);
+
+/**
+ *
+ * @function ast_binary_write_attributes
+ * @brief Write a map of layout attribute records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {enum_map_layout_attribute_t*} map - Layout attributes
+ * @returns {uint32_t} - Offset of the map
+ *
+ */
+uint32_t ast_binary_write_attributes(ast_binary_t *binary,
+                                     enum_map_layout_attribute_t *map);
+
+/**
+ *
+ * @function ast_binary_write_states
+ * @brief Write a map of style state records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {enum_map_layout_style_state_t*} map - Style states
+ * @returns {uint32_t} - Offset of the map
+ *
+ */
+uint32_t ast_binary_write_states(ast_binary_t *binary,
+                                 enum_map_layout_style_state_t *map);
+
+/**
+ *
+ * @function ast_binary_write_layout_nodes
+ * @brief Write a list of layout node records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {array_node_layout_t*} nodes - AST layout nodes
+ * @returns {uint32_t} - Offset of the list
+ *
+ */
+uint32_t ast_binary_write_layout_nodes(ast_binary_t *binary,
+                                       array_node_layout_t *nodes);
+
+/**
+ *
+ * @function ast_binary_write_block
+ * @brief Write a layout block record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_layout_block_t*} block - AST layout block
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_block(ast_binary_t *binary,
+                                ast_layout_block_t *block);
+
+/**
+ *
+ * @function ast_binary_write_node
+ * @brief Write a statement record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_node_t*} node - AST node
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_node(ast_binary_t *binary, ast_node_t *node);
+
+/**
+ *
+ * @function ast_binary_write_nodes
+ * @brief Write a list of statement records
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {array_node_t*} nodes - AST nodes (can be NULL)
+ * @returns {uint32_t} - Offset of the list, 0 if nodes is NULL
+ *
+ */
+uint32_t ast_binary_write_nodes(ast_binary_t *binary, array_node_t *nodes);
+
+/**
+ *
+ * @function ast_binary_write_function
+ * @brief Write a function record
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @params {ast_function_t*} function - AST function
+ * @returns {uint32_t} - Offset of the record
+ *
+ */
+uint32_t ast_binary_write_function(ast_binary_t *binary,
+                                   ast_function_t *function);
+
+/**
+ *
+ * @function ast_binary_write
+ * @brief Write an AST to a new precompiled AST buffer
+ * @params {ast_t*} ast - AST, parsed and validated
+ * @returns {ast_binary_t*}
+ *
+ */
+ast_binary_t *ast_binary_write(ast_t *ast);
+
+/**
+ *
+ * @function ast_binary_save
+ * @brief Write an AST to a .salamc file
+ * @params {ast_t*} ast - AST, parsed and validated
+ * @params {const char*} path - Path of the file
+ * @returns {bool}
+ *
+ */
+bool ast_binary_save(ast_t *ast, const char *path);
+
+/**
+ *
+ * @function ast_binary_destroy
+ * @brief Free a precompiled AST buffer
+ * @params {ast_binary_t*} binary - Precompiled AST buffer
+ * @returns {void}
+ *
+ */
+void ast_binary_destroy(ast_binary_t *binary);
+
+/**
+ *
+ * @function ast_binary_is_path
+ * @brief Check if a path is a precompiled AST by its extension
+ * @params {const char*} path - Path of the file
+ * @returns {bool}
+ *
+ */
+bool ast_binary_is_path(const char *path);
+
+/**
+ *
+ * @function ast_binary_read
+ * @brief Get a record, the file is rejected if it does not hold the record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {size_t} size - Size of the record in bytes
+ * @returns {const void*}
+ *
+ */
+const void *ast_binary_read(ast_binary_reader_t *reader, uint32_t offset,
+                            size_t size);
+
+/**
+ *
+ * @function ast_binary_read_record
+ * @brief Get a record, the file is rejected if it does not hold a record of
+ * this type there
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {size_t} size - Size of the record in bytes
+ * @params {ast_binary_record_t} record - Type of the record
+ * @returns {const void*}
+ *
+ */
+const void *ast_binary_read_record(ast_binary_reader_t *reader,
+                                   uint32_t offset, size_t size,
+                                   ast_binary_record_t record);
+
+/**
+ *
+ * @function ast_binary_read_type
+ * @brief Check that a stored enum value is one of the values of its enum
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} value - Stored value
+ * @params {uint32_t} count - Number of values of the enum
+ * @params {uint32_t} offset - Offset of the record holding the value
+ * @returns {uint32_t} - The value
+ *
+ */
+uint32_t ast_binary_read_type(ast_binary_reader_t *reader, uint32_t value,
+                              uint32_t count, uint32_t offset);
+
+/**
+ *
+ * @function ast_binary_read_before
+ * @brief Check that a record is before the record which refers to it. The
+ * writer writes every record before the records referring to it, so the
+ * reader cannot be sent back to a record it is already reading
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {uint32_t} parent - Offset of the record which refers to it
+ * @returns {void}
+ *
+ */
+void ast_binary_read_before(ast_binary_reader_t *reader, uint32_t offset,
+                            uint32_t parent);
+
+/**
+ *
+ * @function ast_binary_read_list
+ * @brief Get a list record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {size_t} width - 1 for a list, 2 for a map
+ * @returns {const ast_binary_list_t*}
+ *
+ */
+const ast_binary_list_t *ast_binary_read_list(ast_binary_reader_t *reader,
+                                              uint32_t offset, size_t width);
+
+/**
+ *
+ * @function ast_binary_read_string
+ * @brief Get the text of a string record, it points into the file
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record (can be 0)
+ * @returns {const char*} - NULL if offset is 0
+ *
+ */
+const char *ast_binary_read_string(ast_binary_reader_t *reader,
+                                   uint32_t offset);
+
+/**
+ *
+ * @function ast_binary_read_location
+ * @brief Get a location stored in a record
+ * @params {const ast_binary_location_t*} location - Location of the record
+ * @returns {location_t}
+ *
+ */
+location_t ast_binary_read_location(const ast_binary_location_t *location);
+
+/**
+ *
+ * @function ast_binary_read_value
+ * @brief Read a value record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @returns {ast_value_t*}
+ *
+ */
+ast_value_t *ast_binary_read_value(ast_binary_reader_t *reader,
+                                   uint32_t offset);
+
+/**
+ *
+ * @function ast_binary_read_values
+ * @brief Read a list of value records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the list
+ * @params {array_value_t*} values - AST values to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_values(ast_binary_reader_t *reader, uint32_t offset,
+                            array_value_t *values);
+
+/**
+ *
+ * @function ast_binary_read_attribute
+ * @brief Read a layout attribute record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @returns {ast_layout_attribute_t*}
+ *
+ */
+ast_layout_attribute_t *ast_binary_read_attribute(ast_binary_reader_t *reader,
+                                                  uint32_t offset);
+
+/**
+ *
+ * @function ast_binary_read_attributes
+ * @brief Read a map of layout attribute records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the map
+ * @params {enum_map_layout_attribute_t*} map - Layout attributes to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_attributes(ast_binary_reader_t *reader, uint32_t offset,
+                                enum_map_layout_attribute_t *map);
+
+/**
+ *
+ * @function ast_binary_read_states
+ * @brief Read a map of style state records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the map
+ * @params {enum_map_layout_style_state_t*} map - Style states to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_states(ast_binary_reader_t *reader, uint32_t offset,
+                            enum_map_layout_style_state_t *map);
+
+/**
+ *
+ * @function ast_binary_read_layout_nodes
+ * @brief Read a list of layout node records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the list
+ * @params {array_node_layout_t*} nodes - AST layout nodes to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_layout_nodes(ast_binary_reader_t *reader,
+                                  uint32_t offset, array_node_layout_t *nodes);
+
+/**
+ *
+ * @function ast_binary_read_block
+ * @brief Read a layout block record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {ast_layout_block_t*} block - AST layout block to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_block(ast_binary_reader_t *reader, uint32_t offset,
+                           ast_layout_block_t *block);
+
+/**
+ *
+ * @function ast_binary_read_node
+ * @brief Read a statement record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @params {bool} in_else - Whether the statement is an else if or an else
+ * @returns {ast_node_t*}
+ *
+ */
+ast_node_t *ast_binary_read_node(ast_binary_reader_t *reader, uint32_t offset,
+                                 bool in_else);
+
+/**
+ *
+ * @function ast_binary_read_nodes
+ * @brief Read a list of statement records
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the list
+ * @params {bool} in_else - Whether the statements are else ifs and elses
+ * @params {array_node_t*} nodes - AST nodes to fill
+ * @returns {void}
+ *
+ */
+void ast_binary_read_nodes(ast_binary_reader_t *reader, uint32_t offset,
+                           bool in_else, array_node_t *nodes);
+
+/**
+ *
+ * @function ast_binary_read_function
+ * @brief Read a function record
+ * @params {ast_binary_reader_t*} reader - Precompiled AST reader
+ * @params {uint32_t} offset - Offset of the record
+ * @returns {ast_function_t*}
+ *
+ */
+ast_function_t *ast_binary_read_function(ast_binary_reader_t *reader,
+                                         uint32_t offset);
+
+/**
+ *
+ * @function ast_binary_load
+ * @brief Build the AST of a precompiled AST, without lexing, parsing or
+ * validating it again. Strings are copied, so the data can be unmapped after
+ * @params {salam_arena_t*} arena - Arena the AST is built in
+ * @params {const char*} path - Path of the file, for errors
+ * @params {const char*} data - Content of the file
+ * @params {size_t} size - Size of the content in bytes
+ * @returns {ast_t*}
+ *
+ */
+ast_t *ast_binary_load(salam_arena_t *arena, const char *path,
+                       const char *data, size_t size);
+
+#endif
@@ -16,7 +16,7 @@ void ast_layout_attribute_print(ast_layout_attribute_t *value) {
     if (value->values == NULL) {
         printf("NULL\n");
     } else {
-        value->values->print(value->values);
+        array_value_print(value->values);
     }
 }
 
@@ -24,38 +24,37 @@ void ast_layout_attribute_print(ast_layout_attribute_t *value) {
  *
  * @function ast_layout_block_create
  * @brief Create a new AST node layout block
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_type_t} node_type - Node type
  * @params {ast_layout_node_type_t} layout_node_type - Layout node type
  * @returns {ast_layout_block_t*} - Pointer to the created AST node layout block
  *
  */
 ast_layout_block_t *ast_layout_block_create(
-    ast_type_t node_type, ast_layout_node_type_t layout_node_type) {
+    salam_arena_t *arena, ast_type_t node_type,
+    ast_layout_node_type_t layout_node_type) {
     DEBUG_ME;
-    ast_layout_block_t *block = memory_allocate(sizeof(ast_layout_block_t));
+    ast_layout_block_t *block =
+        salam_arena_allocate(arena, sizeof(ast_layout_block_t));
 
+    block->arena = arena;
     block->tag = NULL;
     block->type = AST_BLOCK_TYPE_LAYOUT;
     block->parent_type = node_type;
     block->parent_node_type = layout_node_type;
     block->text_content = NULL;
 
-    block->attributes = cast(struct hashmap_t *, hashmap_create(3));
+    block->attributes = enum_map_create_layout_attribute(arena, 0);
 
-    block->styles = ast_layout_style_state_create();
+    block->styles = ast_layout_style_state_create(arena);
 
-    block->states = hashmap_create_layout_attribute_style_state(1);
+    block->states = enum_map_create_layout_style_state(arena, 0);
 
-    block->children = array_create(sizeof(ast_layout_node_t *), 3);
-    block->children->print = cast(void (*)(void *), array_layout_node_print);
-    block->children->destroy =
-        cast(void (*)(void *), array_layout_node_destroy);
+    block->children =
+        array_create_arena(arena, sizeof(ast_layout_node_t *), 3);
 
-    block->meta_children = array_create(sizeof(ast_layout_node_t *), 1);
-    block->meta_children->print =
-        cast(void (*)(void *), array_layout_node_print);
-    block->meta_children->destroy =
-        cast(void (*)(void *), array_layout_node_destroy);
+    block->meta_children =
+        array_create_arena(arena, sizeof(ast_layout_node_t *), 1);
 
     block->print = cast(void (*)(void *), ast_layout_block_print);
     block->destroy = cast(void (*)(void *), ast_layout_block_destroy);
@@ -67,6 +66,7 @@ ast_layout_block_t *ast_layout_block_create(
  *
  * @function ast_layout_attribute_create
  * @brief Create a new AST node layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_layout_attribute_type_t} type - Type of the layout attribute
  * @params {const char*} key - Key of the attribute
  * @params {array_value_t*} values - Values of the attribute
@@ -78,17 +78,18 @@ ast_layout_block_t *ast_layout_block_create(
  *
  */
 ast_layout_attribute_t *ast_layout_attribute_create(
-    ast_layout_attribute_type_t type, char *key, array_value_t *values,
-    ast_layout_node_type_t parent_node_type, location_t last_name,
-    location_t first_value) {
+    salam_arena_t *arena, ast_layout_attribute_type_t type, const char *key,
+    array_value_t *values, ast_layout_node_type_t parent_node_type,
+    location_t last_name, location_t first_value) {
     DEBUG_ME;
     ast_layout_attribute_t *attribute =
-        memory_allocate(sizeof(ast_layout_attribute_t));
+        salam_arena_allocate(arena, sizeof(ast_layout_attribute_t));
+    attribute->arena = arena;
     attribute->type = type;
 
     attribute->parent_node_type = parent_node_type;
 
-    attribute->key = string_strdup(key);
+    attribute->key = salam_intern(key);
     attribute->values = values;
 
     attribute->isStyle = false;
@@ -101,9 +102,6 @@ ast_layout_attribute_t *ast_layout_attribute_create(
     attribute->final_key = NULL;
     attribute->final_value = NULL;
 
-    attribute->print = cast(void (*)(void *), ast_layout_attribute_print);
-    attribute->destroy = cast(void (*)(void *), ast_layout_attribute_destroy);
-
     return attribute;
 }
 
@@ -111,31 +109,65 @@ ast_layout_attribute_t *ast_layout_attribute_create(
  *
  * @function ast_layout_attribute_copy
  * @brief Copy the AST layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_layout_attribute_t*} value - AST layout attribute
  * @returns {ast_layout_attribute_t*} - Pointer to the copied AST layout
  * attribute
  *
  */
 ast_layout_attribute_t *ast_layout_attribute_copy(
-    ast_layout_attribute_t *value) {
+    salam_arena_t *arena, ast_layout_attribute_t *value) {
     DEBUG_ME;
     ast_layout_attribute_t *copy = ast_layout_attribute_create(
-        value->type, value->key, array_value_copy(value->values),
+        arena, value->type, value->key, array_value_copy(arena, value->values),
         value->parent_node_type, value->key_location, value->value_location);
 
     copy->isStyle = value->isStyle;
     copy->isContent = value->isContent;
     copy->ignoreMe = value->ignoreMe;
 
-    if (value->final_key != NULL) {
-        copy->final_key = string_strdup(value->final_key);
-    }
+    ast_layout_attribute_set_final_key(copy, value->final_key);
+    ast_layout_attribute_set_final_value(copy, value->final_value);
 
-    if (value->final_value != NULL) {
-        copy->final_value = string_strdup(value->final_value);
+    return copy;
+}
+
+/**
+ *
+ * @function ast_layout_attribute_set_final_key
+ * @brief Set the generated key of the AST layout attribute to the interned
+ * copy of a string
+ * @params {ast_layout_attribute_t*} attribute - AST layout attribute
+ * @params {const char*} final_key - Key (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_attribute_set_final_key(ast_layout_attribute_t *attribute,
+                                        const char *final_key) {
+    DEBUG_ME;
+    attribute->final_key = salam_intern(final_key);
+}
+
+/**
+ *
+ * @function ast_layout_attribute_set_final_value
+ * @brief Set the generated value of the AST layout attribute to a copy of a
+ * string, in the arena of the attribute
+ * @params {ast_layout_attribute_t*} attribute - AST layout attribute
+ * @params {const char*} final_value - Value (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_attribute_set_final_value(ast_layout_attribute_t *attribute,
+                                          const char *final_value) {
+    DEBUG_ME;
+    if (attribute->final_value != NULL) {
+        salam_arena_free(attribute->arena, attribute->final_value);
     }
 
-    return copy;
+    attribute->final_value =
+        final_value == NULL ? NULL
+                            : salam_arena_strdup(attribute->arena, final_value);
 }
 
 /**
@@ -148,15 +180,7 @@ ast_layout_attribute_t *ast_layout_attribute_copy(
  */
 void ast_layout_attribute_destroy(ast_layout_attribute_t *value) {
     DEBUG_ME;
-    if (value != NULL) {
-        if (value->key != NULL) {
-            memory_destroy(value->key);
-        }
-
-        if (value->final_key != NULL) {
-            memory_destroy(value->final_key);
-        }
-
+    if (value != NULL && value->arena == NULL) {
         if (value->final_value != NULL) {
             memory_destroy(value->final_value);
         }
@@ -179,9 +203,9 @@ void ast_layout_attribute_destroy(ast_layout_attribute_t *value) {
  */
 void ast_layout_block_destroy(ast_layout_block_t *value) {
     DEBUG_ME;
-    if (value != NULL) {
+    if (value != NULL && value->arena == NULL) {
         if (value->attributes != NULL) {
-            hashmap_destroy_layout_attribute(value->attributes);
+            enum_map_destroy_layout_attribute(value->attributes);
         }
 
         if (value->styles != NULL) {
@@ -189,7 +213,7 @@ void ast_layout_block_destroy(ast_layout_block_t *value) {
         }
 
         if (value->states != NULL) {
-            hashmap_destroy_layout_attribute_style_state(value->states);
+            enum_map_destroy_layout_style_state(value->states);
         }
 
         if (value->children != NULL) {
@@ -212,6 +236,47 @@ void ast_layout_block_destroy(ast_layout_block_t *value) {
     }
 }
 
+/**
+ *
+ * @function ast_layout_block_set_tag
+ * @brief Set the generated tag (class name) of the AST layout block to a copy
+ * of a string, in the arena of the block
+ * @params {ast_layout_block_t*} block - AST layout block
+ * @params {const char*} tag - Tag (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_block_set_tag(ast_layout_block_t *block, const char *tag) {
+    DEBUG_ME;
+    if (block->tag != NULL) {
+        salam_arena_free(block->arena, block->tag);
+    }
+
+    block->tag = tag == NULL ? NULL : salam_arena_strdup(block->arena, tag);
+}
+
+/**
+ *
+ * @function ast_layout_block_set_text_content
+ * @brief Set the text content of the AST layout block to a copy of a string,
+ * in the arena of the block
+ * @params {ast_layout_block_t*} block - AST layout block
+ * @params {const char*} text_content - Text content (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_block_set_text_content(ast_layout_block_t *block,
+                                       const char *text_content) {
+    DEBUG_ME;
+    if (block->text_content != NULL) {
+        salam_arena_free(block->arena, block->text_content);
+    }
+
+    block->text_content =
+        text_content == NULL ? NULL
+                             : salam_arena_strdup(block->arena, text_content);
+}
+
 /**
  *
  * @function ast_layout_block_print
@@ -222,13 +287,13 @@ void ast_layout_block_destroy(ast_layout_block_t *value) {
  */
 void ast_layout_block_print(ast_layout_block_t *value) {
     DEBUG_ME;
-    hashmap_t *attributes = cast(hashmap_t *, value->attributes);
-    hashmap_t *styles = cast(hashmap_t *, value->styles);
+    enum_map_layout_attribute_t *attributes = value->attributes;
+    ast_layout_style_state_t *styles = value->styles;
     array_node_layout_t *children = value->children;
     size_t children_capacity = array_length(children);
 
     printf("Block attributes:\n");
-    attributes->print(attributes);
+    enum_map_print_layout_attribute(attributes);
 
     printf("Block styles:\n");
     styles->print(styles);
@@ -238,7 +303,7 @@ void ast_layout_block_print(ast_layout_block_t *value) {
         ast_layout_node_t *node =
             cast(ast_layout_node_t *, array_get(value->children, i));
 
-        node->print(node);
+        ast_layout_node_print(node);
     }
 }
 
@@ -246,22 +311,22 @@ void ast_layout_block_print(ast_layout_block_t *value) {
  *
  * @function ast_layout_node_create
  * @brief Create a new AST node layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_layout_node_type_t} layout_node_type - Layout node type
  * @returns {ast_layout_node_t*} - Pointer to the created AST node layout
  * attribute
  *
  */
 ast_layout_node_t *ast_layout_node_create(
-    ast_layout_node_type_t layout_node_type) {
+    salam_arena_t *arena, ast_layout_node_type_t layout_node_type) {
     DEBUG_ME;
-    ast_layout_node_t *node = memory_allocate(sizeof(ast_layout_node_t));
+    ast_layout_node_t *node =
+        salam_arena_allocate(arena, sizeof(ast_layout_node_t));
 
     node->tag = NULL;
     node->type = layout_node_type;
-    node->block = ast_layout_block_create(AST_TYPE_LAYOUT, layout_node_type);
-
-    node->print = cast(void (*)(void *), ast_layout_node_print);
-    node->destroy = cast(void (*)(void *), ast_layout_node_destroy);
+    node->block =
+        ast_layout_block_create(arena, AST_TYPE_LAYOUT, layout_node_type);
 
     return node;
 }
@@ -307,16 +372,17 @@ void ast_layout_node_destroy(ast_layout_node_t *value) {
  *
  * @function ast_layout_create
  * @brief Create a new AST node layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_layout_attribute_t*} - Pointer to the created AST node layout
  * attribute
  *
  */
-ast_layout_t *ast_layout_create() {
+ast_layout_t *ast_layout_create(salam_arena_t *arena) {
     DEBUG_ME;
-    ast_layout_t *node = memory_allocate(sizeof(ast_layout_t));
+    ast_layout_t *node = salam_arena_allocate(arena, sizeof(ast_layout_t));
 
     node->block =
-        ast_layout_block_create(AST_TYPE_LAYOUT, AST_LAYOUT_TYPE_NONE);
+        ast_layout_block_create(arena, AST_TYPE_LAYOUT, AST_LAYOUT_TYPE_NONE);
 
     node->print = cast(void (*)(void *), ast_layout_print);
     node->destroy = cast(void (*)(void *), ast_layout_destroy);
@@ -357,6 +423,34 @@ void ast_layout_print(ast_layout_t *value) {
     value->block->print(value->block);
 }
 
+/**
+ *
+ * @variable ast_layout_node_type_names
+ * @brief Layout node names (NAME) to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_node_type_names_entries[] = {
+#undef ADD_LAYOUT_TYPE
+#undef ADD_LAYOUT_TYPE_HIDE
+#undef ADD_LAYOUT_TYPE_REPEAT
+
+#define ADD_LAYOUT_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, ENDUSER_NAME, \
+                        IS_MOTHER)                                            \
+    NAME_TABLE_ENTRY(NAME, TYPE)
+#define ADD_LAYOUT_TYPE_HIDE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
+                             ENDUSER_NAME, IS_MOTHER)                \
+    NAME_TABLE_ENTRY(NAME, TYPE)
+#define ADD_LAYOUT_TYPE_REPEAT(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
+                               ENDUSER_NAME, IS_MOTHER)                \
+    NAME_TABLE_ENTRY(NAME, TYPE)
+
+#include "ast_layout_type.h"
+};
+
+name_table_t ast_layout_node_type_names =
+    NAME_TABLE_INIT(ast_layout_node_type_names_entries);
+
 /**
  *
  * @function name_to_ast_layout_node_type
@@ -367,37 +461,40 @@ void ast_layout_print(ast_layout_t *value) {
  */
 ast_layout_node_type_t name_to_ast_layout_node_type(char *name) {
     DEBUG_ME;
-    ast_layout_node_type_t type = AST_LAYOUT_TYPE_ERROR;
+    if (name == NULL) {
+        return AST_LAYOUT_TYPE_ERROR;
+    }
 
+    return name_table_find(&ast_layout_node_type_names, name, strlen(name),
+                           AST_LAYOUT_TYPE_ERROR);
+}
+
+/**
+ *
+ * @variable ast_layout_node_type_enduser_names
+ * @brief Layout node end-user names (including repeats) to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_node_type_enduser_names_entries[] = {
 #undef ADD_LAYOUT_TYPE
 #undef ADD_LAYOUT_TYPE_HIDE
 #undef ADD_LAYOUT_TYPE_REPEAT
 
 #define ADD_LAYOUT_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, ENDUSER_NAME, \
                         IS_MOTHER)                                            \
-    else if (strcmp(name, NAME) == 0) {                                       \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 #define ADD_LAYOUT_TYPE_HIDE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
-                             ENDUSER_NAME, IS_MOTHER)                \
-    else if (strcmp(name, NAME) == 0) {                              \
-        type = TYPE;                                                 \
-        return type;                                                 \
-    }
+                             ENDUSER_NAME, IS_MOTHER)
 #define ADD_LAYOUT_TYPE_REPEAT(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
                                ENDUSER_NAME, IS_MOTHER)                \
-    else if (strcmp(name, NAME) == 0) {                                \
-        type = TYPE;                                                   \
-        return type;                                                   \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 
-    if (false) {
-    }
 #include "ast_layout_type.h"
+};
 
-    return type;
-}
+name_table_t ast_layout_node_type_enduser_names =
+    NAME_TABLE_INIT(ast_layout_node_type_enduser_names_entries);
 
 /**
  *
@@ -409,59 +506,85 @@ ast_layout_node_type_t name_to_ast_layout_node_type(char *name) {
  */
 ast_layout_node_type_t enduser_name_to_ast_layout_node_type(char *name) {
     DEBUG_ME;
-    ast_layout_node_type_t type = AST_LAYOUT_TYPE_ERROR;
+    if (name == NULL) {
+        return AST_LAYOUT_TYPE_ERROR;
+    }
 
+    return name_table_find(&ast_layout_node_type_enduser_names, name,
+                           strlen(name), AST_LAYOUT_TYPE_ERROR);
+}
+
+/**
+ *
+ * @variable ast_layout_node_type_generated_names
+ * @brief Layout node generated (HTML) names to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_node_type_generated_names_entries[] = {
 #undef ADD_LAYOUT_TYPE
 #undef ADD_LAYOUT_TYPE_HIDE
 #undef ADD_LAYOUT_TYPE_REPEAT
 
 #define ADD_LAYOUT_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, ENDUSER_NAME, \
                         IS_MOTHER)                                            \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                               \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(GENERATED_NAME, TYPE)
 #define ADD_LAYOUT_TYPE_HIDE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
-                             ENDUSER_NAME, IS_MOTHER)
+                             ENDUSER_NAME, IS_MOTHER)                \
+    NAME_TABLE_ENTRY(GENERATED_NAME, TYPE)
 #define ADD_LAYOUT_TYPE_REPEAT(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
-                               ENDUSER_NAME, IS_MOTHER)                \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                        \
-        type = TYPE;                                                   \
-        return type;                                                   \
-    }
+                               ENDUSER_NAME, IS_MOTHER)
 
-    if (false) {
-    }
 #include "ast_layout_type.h"
+};
 
-    return type;
+name_table_t ast_layout_node_type_generated_names =
+    NAME_TABLE_INIT(ast_layout_node_type_generated_names_entries);
+
+/**
+ *
+ * @function generated_name_to_ast_layout_node_type
+ * @brief Convert generated (HTML) name to AST layout node type
+ * @params {char*} name - Name
+ * @returns {ast_layout_node_type_t} type - Layout Node Type
+ *
+ */
+ast_layout_node_type_t generated_name_to_ast_layout_node_type(char *name) {
+    DEBUG_ME;
+    if (name == NULL) {
+        return AST_LAYOUT_TYPE_ERROR;
+    }
+
+    return name_table_find(&ast_layout_node_type_generated_names, name,
+                           strlen(name), AST_LAYOUT_TYPE_ERROR);
 }
 
 /**
  *
  * @function token_to_ast_layout_node_type
  * @brief Convert token to AST layout node type
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
  * @returns {ast_layout_node_type_t} type - Layout Node Type
  *
  */
-ast_layout_node_type_t token_to_ast_layout_node_type(token_t *token) {
+ast_layout_node_type_t token_to_ast_layout_node_type(lexer_t *lexer,
+                                                     token_t *token) {
     DEBUG_ME;
     if (token->type != TOKEN_IDENTIFIER) {
         error_ast(2,
                   "Expected token type to be identifier as layout node type, "
                   "got %s at line %d, column %d",
-                  token_name(token->type), token->location.end_line,
-                  token->location.end_column);
+                  token_name(token->type), token->line, token->column);
     }
 
-    ast_layout_node_type_t type =
-        enduser_name_to_ast_layout_node_type(token->data.string);
+    ast_layout_node_type_t type = enduser_name_to_ast_layout_node_type(
+        token_value_stringify(lexer, token));
 
     if (type == AST_LAYOUT_TYPE_ERROR) {
         error_ast(2, "Unknown layout node '%s' at line %d, column %d",
-                  token->data.string, token->location.end_line,
-                  token->location.end_column);
+                  token_value_stringify(lexer, token), token->line,
+                  token->column);
     }
 
     return type;
@@ -533,91 +656,82 @@ char *ast_layout_node_type_to_enduser_name(ast_layout_node_type_t type) {
 
 /**
  *
- * @function name_to_ast_layout_node_type
- * @brief Convert attribute name to AST layout node type
- * @params {char*} name - Name
- * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
+ * @variable ast_layout_attribute_type_names
+ * @brief Attribute and style names (NAME_LOWER) to types
+ * @type {name_table_t}
  *
  */
-ast_layout_attribute_type_t name_to_ast_layout_attribute_type(char *name) {
-    DEBUG_ME;
-    ast_layout_attribute_type_t type = AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
-
-    if (false) {
-    }
-
+const name_table_entry_t ast_layout_attribute_type_names_entries[] = {
 #undef ADD_LAYOUT_ATTRIBUTE_TYPE
 #undef ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT
 
 #define ADD_LAYOUT_ATTRIBUTE_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
                                   ENDUSER_NAME)                           \
-    else if (strcmp(name, NAME_LOWER) == 0) {                             \
-        type = TYPE;                                                      \
-        return type;                                                      \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT(TYPE, NAME, NAME_LOWER,       \
                                          GENERATED_NAME, ENDUSER_NAME) \
-    else if (strcmp(name, NAME_LOWER) == 0) {                          \
-        type = TYPE;                                                   \
-        return type;                                                   \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 
 #include "ast_layout_attribute_type.h"
 
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE
 
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE(TYPE, NAME, NAME_LOWER, ENDUSER_NAME, \
                                         GENERATED_NAME, FILTER,               \
                                         ALLOWED_VALUES, SUBTAGS)              \
-    else if (strcmp(name, NAME_LOWER) == 0) {                                 \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT(                   \
+    TYPE, NAME, NAME_LOWER, ENDUSER_NAME, GENERATED_NAME, FILTER, \
+    ALLOWED_VALUES, SUBTAGS)                                      \
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE(TYPE, NAME, NAME_LOWER,          \
                                              ENDUSER_NAME, GENERATED_NAME,    \
                                              FILTER, ALLOWED_VALUES, SUBTAGS) \
-    else if (strcmp(name, NAME_LOWER) == 0) {                                 \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 
 #include "ast_layout_attribute_style_type.h"
+};
 
-    return type;
-}
+name_table_t ast_layout_attribute_type_names =
+    NAME_TABLE_INIT(ast_layout_attribute_type_names_entries);
 
 /**
  *
- * @function enduser_name_to_ast_layout_attribute_type
- * @brief Convert enduser attribute name to AST layout node type
+ * @function name_to_ast_layout_attribute_type
+ * @brief Convert attribute name to AST layout attribute type
  * @params {char*} name - Name
  * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
  *
  */
-ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_type(
-    char *name) {
+ast_layout_attribute_type_t name_to_ast_layout_attribute_type(char *name) {
     DEBUG_ME;
-    ast_layout_attribute_type_t type = AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
-
-    if (false) {
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
     }
 
+    return name_table_find(&ast_layout_attribute_type_names, name, strlen(name),
+                           AST_LAYOUT_ATTRIBUTE_TYPE_ERROR);
+}
+
+/**
+ *
+ * @variable ast_layout_attribute_type_enduser_names
+ * @brief Attribute and style end-user names (including repeats) to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_attribute_type_enduser_names_entries[] = {
 #undef ADD_LAYOUT_ATTRIBUTE_TYPE
 #undef ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT
 
 #define ADD_LAYOUT_ATTRIBUTE_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
                                   ENDUSER_NAME)                           \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                           \
-        type = TYPE;                                                      \
-        return type;                                                      \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT(TYPE, NAME, NAME_LOWER,       \
                                          GENERATED_NAME, ENDUSER_NAME) \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                        \
-        type = TYPE;                                                   \
-        return type;                                                   \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 
 #include "ast_layout_attribute_type.h"
 
@@ -628,24 +742,98 @@ ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_type(
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE(TYPE, NAME, NAME_LOWER, ENDUSER_NAME, \
                                         GENERATED_NAME, FILTER,               \
                                         ALLOWED_VALUES, SUBTAGS)              \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                               \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT(                   \
     TYPE, NAME, NAME_LOWER, ENDUSER_NAME, GENERATED_NAME, FILTER, \
     ALLOWED_VALUES, SUBTAGS)                                      \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                   \
-        type = TYPE;                                              \
-        return type;                                              \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE(TYPE, NAME, NAME_LOWER,       \
                                              ENDUSER_NAME, GENERATED_NAME, \
                                              FILTER, ALLOWED_VALUES, SUBTAGS)
 
 #include "ast_layout_attribute_style_type.h"
+};
 
-    return type;
+name_table_t ast_layout_attribute_type_enduser_names =
+    NAME_TABLE_INIT(ast_layout_attribute_type_enduser_names_entries);
+
+/**
+ *
+ * @function enduser_name_to_ast_layout_attribute_type
+ * @brief Convert enduser attribute name to AST layout attribute type
+ * @params {char*} name - Name
+ * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
+ *
+ */
+ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_type(
+    char *name) {
+    DEBUG_ME;
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
+    }
+
+    return name_table_find(&ast_layout_attribute_type_enduser_names, name,
+                           strlen(name), AST_LAYOUT_ATTRIBUTE_TYPE_ERROR);
+}
+
+/**
+ *
+ * @variable ast_layout_attribute_type_generated_names
+ * @brief Attribute and style generated (HTML/CSS) names to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_attribute_type_generated_names_entries[] = {
+#undef ADD_LAYOUT_ATTRIBUTE_TYPE
+#undef ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT
+
+#define ADD_LAYOUT_ATTRIBUTE_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
+                                  ENDUSER_NAME)                           \
+    NAME_TABLE_ENTRY(GENERATED_NAME, TYPE)
+#define ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT(TYPE, NAME, NAME_LOWER, \
+                                         GENERATED_NAME, ENDUSER_NAME)
+
+#include "ast_layout_attribute_type.h"
+
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE
+
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE(TYPE, NAME, NAME_LOWER, ENDUSER_NAME, \
+                                        GENERATED_NAME, FILTER,               \
+                                        ALLOWED_VALUES, SUBTAGS)              \
+    NAME_TABLE_ENTRY(GENERATED_NAME, TYPE)
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT(                   \
+    TYPE, NAME, NAME_LOWER, ENDUSER_NAME, GENERATED_NAME, FILTER, \
+    ALLOWED_VALUES, SUBTAGS)
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE(TYPE, NAME, NAME_LOWER,          \
+                                             ENDUSER_NAME, GENERATED_NAME,    \
+                                             FILTER, ALLOWED_VALUES, SUBTAGS) \
+    NAME_TABLE_ENTRY(GENERATED_NAME, TYPE)
+
+#include "ast_layout_attribute_style_type.h"
+};
+
+name_table_t ast_layout_attribute_type_generated_names =
+    NAME_TABLE_INIT(ast_layout_attribute_type_generated_names_entries);
+
+/**
+ *
+ * @function generated_name_to_ast_layout_attribute_type
+ * @brief Convert generated (HTML/CSS) name to AST layout attribute type
+ * @params {char*} name - Name
+ * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
+ *
+ */
+ast_layout_attribute_type_t generated_name_to_ast_layout_attribute_type(
+    char *name) {
+    DEBUG_ME;
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
+    }
+
+    return name_table_find(&ast_layout_attribute_type_generated_names, name,
+                           strlen(name), AST_LAYOUT_ATTRIBUTE_TYPE_ERROR);
 }
 
 /**
@@ -668,7 +856,7 @@ ast_layout_attribute_type_t token_to_ast_layout_attribute_type(
         error_ast(2,
                   "Unknown layout attribute '%s' at line %d, column %d for "
                   "'%s' element",
-                  name, token->location.end_line, token->location.end_column,
+                  name, token->line, token->column,
                   ast_layout_node_type_to_enduser_name(parent_node_type));
     }
 
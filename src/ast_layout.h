@@ -51,25 +51,68 @@ typedef enum {
 #include "ast_layout_attribute_style_type.h"
 } ast_layout_attribute_type_t;
 
+// Number of layout attribute types, counted from the same tables
+enum {
+    AST_LAYOUT_ATTRIBUTE_TYPES = 0
+#undef ADD_LAYOUT_ATTRIBUTE_TYPE
+#undef ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT
+
+#define ADD_LAYOUT_ATTRIBUTE_TYPE(TYPE, NAME, NAME_LOWER, GENERATED_NAME, \
+                                  ENDUSER_NAME)                           \
+    +1
+#define ADD_LAYOUT_ATTRIBUTE_TYPE_REPEAT(TYPE, NAME, NAME_LOWER, \
+                                         GENERATED_NAME, ENDUSER_NAME)
+
+#include "ast_layout_attribute_type.h"
+
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE
+
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE(TYPE, NAME, NAME_LOWER, ENDUSER_NAME, \
+                                        GENERATED_NAME, FILTER,               \
+                                        ALLOWED_VALUES, SUBTAGS)              \
+    +1
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT(                   \
+    TYPE, NAME, NAME_LOWER, ENDUSER_NAME, GENERATED_NAME, FILTER, \
+    ALLOWED_VALUES, SUBTAGS)
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE(TYPE, NAME, NAME_LOWER,       \
+                                             ENDUSER_NAME, GENERATED_NAME, \
+                                             FILTER, ALLOWED_VALUES, SUBTAGS)
+
+#include "ast_layout_attribute_style_type.h"
+};
+
 #include "array.h"
 #include "array_custom.h"
 #include "ast.h"
 #include "ast_layout_style.h"
 #include "base.h"
+#include "enum_map.h"
+#include "enum_map_custom.h"
 #include "hashmap.h"
-#include "hashmap_custom.h"
+#include "intern.h"
 #include "memory.h"
+#include "name_table.h"
+
+// Attributes, styles and style states are kept in enum maps by type
+_Static_assert(AST_LAYOUT_ATTRIBUTE_TYPES <= ENUM_MAP_KEYS,
+               "ENUM_MAP_KEYS must cover every ast_layout_attribute_type_t");
+_Static_assert(AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR < ENUM_MAP_KEYS,
+               "ENUM_MAP_KEYS must cover every style state type");
 
 typedef struct ast_layout_block_t {
+    salam_arena_t *arena;  // NULL if the block is on the heap
+
     char *tag;
     ast_block_type_t type;
     ast_type_t parent_type;
     ast_layout_node_type_t parent_node_type;
     char *text_content;
 
-    struct hashmap_t *attributes;
+    struct enum_map_t *attributes;  // by ast_layout_attribute_type_t
     ast_layout_style_state_t *styles;
-    struct hashmap_t *states;
+    struct enum_map_t *states;  // by ast_layout_attribute_style_state_type
 
     array_node_layout_t *children;
     array_node_layout_t *meta_children;
@@ -79,9 +122,11 @@ typedef struct ast_layout_block_t {
 } ast_layout_block_t;
 
 typedef struct ast_layout_attribute_t {
+    salam_arena_t *arena;  // NULL if the attribute is on the heap
+
     ast_layout_attribute_type_t type;
 
-    char *key;
+    const char *key;  // interned, see salam_intern
     array_value_t *values;
 
     ast_layout_node_type_t parent_node_type;
@@ -89,15 +134,12 @@ typedef struct ast_layout_attribute_t {
     location_t key_location;
     location_t value_location;
 
-    char *final_key;
+    const char *final_key;  // interned, see salam_intern
     char *final_value;
 
     bool isStyle;
     bool isContent;
     bool ignoreMe;
-
-    void (*destroy)(void *node);
-    void (*print)(void *node);
 } ast_layout_attribute_t;
 
 typedef struct ast_layout_t {
@@ -111,11 +153,23 @@ typedef struct ast_layout_node_t {
     char *tag;
     ast_layout_node_type_t type;
     ast_layout_block_t *block;
-
-    void (*destroy)(void *node);
-    void (*print)(void *node);
 } ast_layout_node_t;
 
+/**
+ *
+ * @variable ast_layout_node_type_names
+ * @brief Name tables of layout nodes, attributes and styles (by NAME,
+ * NAME_LOWER, ENDUSER_NAME and GENERATED_NAME)
+ * @type {name_table_t}
+ *
+ */
+extern name_table_t ast_layout_node_type_names;
+extern name_table_t ast_layout_node_type_enduser_names;
+extern name_table_t ast_layout_node_type_generated_names;
+extern name_table_t ast_layout_attribute_type_names;
+extern name_table_t ast_layout_attribute_type_enduser_names;
+extern name_table_t ast_layout_attribute_type_generated_names;
+
 /**
  *
  * @function ast_layout_node_print
@@ -140,11 +194,12 @@ void ast_layout_node_destroy(ast_layout_node_t *value);
  *
  * @function ast_layout_create
  * @brief Create a new AST node layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_layout_attribute_t*} - Pointer to the created AST node layout
  * attribute
  *
  */
-ast_layout_t *ast_layout_create();
+ast_layout_t *ast_layout_create(salam_arena_t *arena);
 
 /**
  *
@@ -160,13 +215,40 @@ void ast_layout_destroy(ast_layout_t *value);
  *
  * @function ast_layout_block_create
  * @brief Create a new AST node layout block
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_type_t} node_type - Node type
  * @params {ast_layout_node_type_t} layout_node_type - Layout node type
  * @returns {ast_layout_block_t*} - Pointer to the created AST node layout block
  *
  */
 ast_layout_block_t *ast_layout_block_create(
-    ast_type_t node_type, ast_layout_node_type_t layout_node_type);
+    salam_arena_t *arena, ast_type_t node_type,
+    ast_layout_node_type_t layout_node_type);
+
+/**
+ *
+ * @function ast_layout_block_set_tag
+ * @brief Set the generated tag (class name) of the AST layout block to a copy
+ * of a string, in the arena of the block
+ * @params {ast_layout_block_t*} block - AST layout block
+ * @params {const char*} tag - Tag (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_block_set_tag(ast_layout_block_t *block, const char *tag);
+
+/**
+ *
+ * @function ast_layout_block_set_text_content
+ * @brief Set the text content of the AST layout block to a copy of a string,
+ * in the arena of the block
+ * @params {ast_layout_block_t*} block - AST layout block
+ * @params {const char*} text_content - Text content (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_block_set_text_content(ast_layout_block_t *block,
+                                       const char *text_content);
 
 /**
  *
@@ -192,13 +274,40 @@ void ast_layout_block_destroy(ast_layout_block_t *value);
  *
  * @function ast_layout_node_create
  * @brief Create a new AST node layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_layout_node_type_t} layout_node_type - Layout node type
  * @returns {ast_layout_node_t*} - Pointer to the created AST node layout
  * attribute
  *
  */
 ast_layout_node_t *ast_layout_node_create(
-    ast_layout_node_type_t layout_node_type);
+    salam_arena_t *arena, ast_layout_node_type_t layout_node_type);
+
+/**
+ *
+ * @function ast_layout_attribute_set_final_key
+ * @brief Set the generated key of the AST layout attribute to the interned
+ * copy of a string
+ * @params {ast_layout_attribute_t*} attribute - AST layout attribute
+ * @params {const char*} final_key - Key (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_attribute_set_final_key(ast_layout_attribute_t *attribute,
+                                        const char *final_key);
+
+/**
+ *
+ * @function ast_layout_attribute_set_final_value
+ * @brief Set the generated value of the AST layout attribute to a copy of a
+ * string, in the arena of the attribute
+ * @params {ast_layout_attribute_t*} attribute - AST layout attribute
+ * @params {const char*} final_value - Value (can be NULL)
+ * @returns {void}
+ *
+ */
+void ast_layout_attribute_set_final_value(ast_layout_attribute_t *attribute,
+                                          const char *final_value);
 
 /**
  *
@@ -234,6 +343,7 @@ void ast_layout_print(ast_layout_t *value);
  *
  * @function ast_layout_attribute_create
  * @brief Create a new AST node layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_layout_attribute_type_t} type - Type of the layout attribute
  * @params {const char*} key - Key of the attribute
  * @params {array_value_t*} values - Values of the attribute
@@ -245,9 +355,9 @@ void ast_layout_print(ast_layout_t *value);
  *
  */
 ast_layout_attribute_t *ast_layout_attribute_create(
-    ast_layout_attribute_type_t type, char *key, array_value_t *values,
-    ast_layout_node_type_t parent_node_type, location_t last_name,
-    location_t first_value);
+    salam_arena_t *arena, ast_layout_attribute_type_t type, const char *key,
+    array_value_t *values, ast_layout_node_type_t parent_node_type,
+    location_t last_name, location_t first_value);
 
 /**
  *
@@ -274,11 +384,13 @@ ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_type(
  *
  * @function token_to_ast_layout_node_type
  * @brief Convert token to AST layout node type
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
  * @returns {ast_layout_node_type_t} type - Layout Node Type
  *
  */
-ast_layout_node_type_t token_to_ast_layout_node_type(token_t *token);
+ast_layout_node_type_t token_to_ast_layout_node_type(lexer_t *lexer,
+                                                     token_t *token);
 
 /**
  *
@@ -317,13 +429,14 @@ char *ast_layout_attribute_type_to_name(ast_layout_attribute_type_t type);
  *
  * @function ast_layout_attribute_copy
  * @brief Copy the AST layout attribute
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @params {ast_layout_attribute_t*} value - AST layout attribute
  * @returns {ast_layout_attribute_t*} - Pointer to the copied AST layout
  * attribute
  *
  */
 ast_layout_attribute_t *ast_layout_attribute_copy(
-    ast_layout_attribute_t *value);
+    salam_arena_t *arena, ast_layout_attribute_t *value);
 
 /**
  *
@@ -355,6 +468,27 @@ char *ast_layout_node_type_to_enduser_name(ast_layout_node_type_t type);
  */
 ast_layout_node_type_t enduser_name_to_ast_layout_node_type(char *name);
 
+/**
+ *
+ * @function generated_name_to_ast_layout_node_type
+ * @brief Convert generated (HTML) name to AST layout node type
+ * @params {char*} name - Name
+ * @returns {ast_layout_node_type_t} type - Layout Node Type
+ *
+ */
+ast_layout_node_type_t generated_name_to_ast_layout_node_type(char *name);
+
+/**
+ *
+ * @function generated_name_to_ast_layout_attribute_type
+ * @brief Convert generated (HTML/CSS) name to AST layout attribute type
+ * @params {char*} name - Name
+ * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
+ *
+ */
+ast_layout_attribute_type_t generated_name_to_ast_layout_attribute_type(
+    char *name);
+
 /**
  *
  * @function ast_layout_attribute_has_any_sub_value
@@ -2,20 +2,12 @@
 
 /**
  *
- * @function enduser_name_to_ast_layout_attribute_style_type
- * @brief Convert style end-user attribute name to AST layout node type
- * @params {char*} name - Name
- * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
+ * @variable ast_layout_style_enduser_names
+ * @brief Style end-user names (including repeats) to types
+ * @type {name_table_t}
  *
  */
-ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_style_type(
-    char *name) {
-    DEBUG_ME;
-    ast_layout_attribute_type_t type = AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
-
-    if (false) {
-    }
-
+const name_table_entry_t ast_layout_style_enduser_names_entries[] = {
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE
@@ -23,42 +15,48 @@ ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_style_type(
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE(TYPE, NAME, NAME_LOWER, ENDUSER_NAME, \
                                         GENERATED_NAME, FILTER,               \
                                         ALLOWED_VALUES, SUBTAGS)              \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                               \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT(                   \
     TYPE, NAME, NAME_LOWER, ENDUSER_NAME, GENERATED_NAME, FILTER, \
     ALLOWED_VALUES, SUBTAGS)                                      \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                   \
-        type = TYPE;                                              \
-        return type;                                              \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE(TYPE, NAME, NAME_LOWER,       \
                                              ENDUSER_NAME, GENERATED_NAME, \
                                              FILTER, ALLOWED_VALUES, SUBTAGS)
 
 #include "ast_layout_attribute_style_type.h"
+};
 
-    return type;
-}
+name_table_t ast_layout_style_enduser_names =
+    NAME_TABLE_INIT(ast_layout_style_enduser_names_entries);
 
 /**
  *
- * @function name_to_ast_layout_attribute_style_type
- * @brief Convert style attribute name to AST layout node type
+ * @function enduser_name_to_ast_layout_attribute_style_type
+ * @brief Convert style end-user attribute name to AST layout attribute type
  * @params {char*} name - Name
  * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
  *
  */
-ast_layout_attribute_type_t name_to_ast_layout_attribute_style_type(
+ast_layout_attribute_type_t enduser_name_to_ast_layout_attribute_style_type(
     char *name) {
     DEBUG_ME;
-    ast_layout_attribute_type_t type = AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
-
-    if (false) {
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
     }
 
+    return name_table_find(&ast_layout_style_enduser_names, name, strlen(name),
+                           AST_LAYOUT_ATTRIBUTE_TYPE_ERROR);
+}
+
+/**
+ *
+ * @variable ast_layout_style_names
+ * @brief Style names (NAME_LOWER) to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_style_names_entries[] = {
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE
@@ -66,59 +64,80 @@ ast_layout_attribute_type_t name_to_ast_layout_attribute_style_type(
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE(TYPE, NAME, NAME_LOWER, ENDUSER_NAME, \
                                         GENERATED_NAME, FILTER,               \
                                         ALLOWED_VALUES, SUBTAGS)              \
-    else if (strcmp(name, NAME_LOWER) == 0) {                                 \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_REPEAT(                   \
     TYPE, NAME, NAME_LOWER, ENDUSER_NAME, GENERATED_NAME, FILTER, \
     ALLOWED_VALUES, SUBTAGS)                                      \
-    else if (strcmp(name, NAME_LOWER) == 0) {                     \
-        type = TYPE;                                              \
-        return type;                                              \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_TYPE_HIDE(TYPE, NAME, NAME_LOWER,          \
                                              ENDUSER_NAME, GENERATED_NAME,    \
                                              FILTER, ALLOWED_VALUES, SUBTAGS) \
-    else if (strcmp(name, NAME_LOWER) == 0) {                                 \
-        type = TYPE;                                                          \
-        return type;                                                          \
-    }
+    NAME_TABLE_ENTRY(NAME_LOWER, TYPE)
 
 #include "ast_layout_attribute_style_type.h"
+};
 
-    return type;
-}
+name_table_t ast_layout_style_names =
+    NAME_TABLE_INIT(ast_layout_style_names_entries);
 
 /**
  *
- * @function enduser_name_to_ast_layout_attribute_style_state_type
- * @brief Convert state type enduser name to AST layout node type
+ * @function name_to_ast_layout_attribute_style_type
+ * @brief Convert style attribute name to AST layout attribute type
  * @params {char*} name - Name
- * @returns {ast_layout_attribute_style_state_type} type - Layout Attribute
- * Style State Type
+ * @returns {ast_layout_attribute_type_t} type - Layout Attribute Type
  *
  */
-ast_layout_attribute_style_state_type
-enduser_name_to_ast_layout_attribute_style_state_type(char *name) {
+ast_layout_attribute_type_t name_to_ast_layout_attribute_style_type(
+    char *name) {
     DEBUG_ME;
-    ast_layout_attribute_style_state_type type =
-        AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_TYPE_ERROR;
+    }
 
+    return name_table_find(&ast_layout_style_names, name, strlen(name),
+                           AST_LAYOUT_ATTRIBUTE_TYPE_ERROR);
+}
+
+/**
+ *
+ * @variable ast_layout_state_enduser_names
+ * @brief Style state end-user names to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_state_enduser_names_entries[] = {
 #undef ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE
 
 #define ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE(TYPE, NAME, NAME_LOWER,       \
                                               ENDUSER_NAME, GENERATED_NAME) \
-    else if (strcmp(name, ENDUSER_NAME) == 0) {                             \
-        type = TYPE;                                                        \
-        return type;                                                        \
-    }
+    NAME_TABLE_ENTRY(ENDUSER_NAME, TYPE)
 
-    if (false) {
-    }
 #include "ast_layout_attribute_style_state_type.h"
+};
+
+name_table_t ast_layout_state_enduser_names =
+    NAME_TABLE_INIT(ast_layout_state_enduser_names_entries);
+
+/**
+ *
+ * @function enduser_name_to_ast_layout_attribute_style_state_type
+ * @brief Convert state type enduser name to AST layout attribute style state
+ * type
+ * @params {char*} name - Name
+ * @returns {ast_layout_attribute_style_state_type} type - Layout Attribute
+ * Style State Type
+ *
+ */
+ast_layout_attribute_style_state_type
+enduser_name_to_ast_layout_attribute_style_state_type(char *name) {
+    DEBUG_ME;
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
+    }
 
-    return type;
+    return name_table_find(&ast_layout_state_enduser_names, name, strlen(name),
+                           AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR);
 }
 
 /**
@@ -135,14 +154,14 @@ void ast_layout_style_state_print(ast_layout_style_state_t *ast) {
     if (ast != NULL) {
         if (ast->normal != NULL) {
             printf("Normal\n");
-            ast->normal->print(ast->normal);
+            enum_map_print_layout_attribute(ast->normal);
         } else {
             printf("Normal: NULL\n");
         }
 
         if (ast->new != NULL) {
             printf("New\n");
-            ast->new->print(ast->new);
+            enum_map_print_layout_attribute(ast->new);
         } else {
             printf("New: NULL\n");
         }
@@ -155,17 +174,18 @@ void ast_layout_style_state_print(ast_layout_style_state_t *ast) {
  *
  * @function ast_layout_style_state_create
  * @brief Create a new AST layout style state
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_layout_style_state_t*} - Pointer to the created AST layout
  * style state
  *
  */
-ast_layout_style_state_t *ast_layout_style_state_create() {
+ast_layout_style_state_t *ast_layout_style_state_create(salam_arena_t *arena) {
     DEBUG_ME;
     ast_layout_style_state_t *ast =
-        memory_allocate(sizeof(ast_layout_style_state_t));
+        salam_arena_allocate(arena, sizeof(ast_layout_style_state_t));
 
-    ast->normal = hashmap_create_layout_attribute(1);
-    ast->new = hashmap_create_layout_attribute(1);
+    ast->normal = enum_map_create_layout_attribute(arena, 0);
+    ast->new = enum_map_create_layout_attribute(arena, 0);
 
     ast->print = cast(void (*)(void *), ast_layout_style_state_print);
     ast->destroy = cast(void (*)(void *), ast_layout_style_state_destroy);
@@ -185,21 +205,41 @@ void ast_layout_style_state_destroy(ast_layout_style_state_t *ast) {
     DEBUG_ME;
     if (ast != NULL) {
         if (ast->normal != NULL) {
-            ast->normal->destroy(ast->normal);
+            enum_map_destroy_layout_attribute(ast->normal);
         }
 
         if (ast->new != NULL) {
-            ast->new->destroy(ast->new);
+            enum_map_destroy_layout_attribute(ast->new);
         }
 
         memory_destroy(ast);
     }
 }
 
+/**
+ *
+ * @variable ast_layout_state_names
+ * @brief Style state names (NAME) to types
+ * @type {name_table_t}
+ *
+ */
+const name_table_entry_t ast_layout_state_names_entries[] = {
+#undef ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE
+
+#define ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE(TYPE, NAME, NAME_LOWER,       \
+                                              ENDUSER_NAME, GENERATED_NAME) \
+    NAME_TABLE_ENTRY(NAME, TYPE)
+
+#include "ast_layout_attribute_style_state_type.h"
+};
+
+name_table_t ast_layout_state_names =
+    NAME_TABLE_INIT(ast_layout_state_names_entries);
+
 /**
  *
  * @function name_to_ast_layout_attribute_style_state_type
- * @brief Convert state type name to AST layout node type
+ * @brief Convert state type name to AST layout attribute style state type
  * @params {char*} name - Name
  * @returns {ast_layout_attribute_style_state_type} type - Layout Attribute
  * Style State Type
@@ -208,23 +248,12 @@ void ast_layout_style_state_destroy(ast_layout_style_state_t *ast) {
 ast_layout_attribute_style_state_type
 name_to_ast_layout_attribute_style_state_type(char *name) {
     DEBUG_ME;
-    ast_layout_attribute_style_state_type type =
-        AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
-
-#undef ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE
-
-#define ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE(TYPE, NAME, NAME_LOWER,       \
-                                              ENDUSER_NAME, GENERATED_NAME) \
-    else if (strcmp(name, NAME) == 0) {                                     \
-        type = TYPE;                                                        \
-        return type;                                                        \
-    }
-
-    if (false) {
+    if (name == NULL) {
+        return AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
     }
-#include "ast_layout_attribute_style_state_type.h"
 
-    return type;
+    return name_table_find(&ast_layout_state_names, name, strlen(name),
+                           AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR);
 }
 
 /**
@@ -239,11 +268,11 @@ name_to_ast_layout_attribute_style_state_type(char *name) {
 bool ast_layout_style_state_has_any_sub_value(ast_layout_style_state_t *value) {
     DEBUG_ME;
     if (value->normal->length > 0) {
-        return hashmap_layout_attribute_has_any_sub_value(value->normal);
+        return enum_map_layout_attribute_has_any_sub_value(value->normal);
     }
 
     if (value->new->length > 0) {
-        return hashmap_layout_attribute_has_any_sub_value(value->new);
+        return enum_map_layout_attribute_has_any_sub_value(value->new);
     }
 
     return false;
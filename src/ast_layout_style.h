@@ -12,8 +12,8 @@ typedef enum {
 } ast_layout_attribute_style_filter_t;
 
 typedef struct ast_layout_style_state_t {
-    struct hashmap_t *normal;
-    struct hashmap_t *new;
+    struct enum_map_t *normal;  // by ast_layout_attribute_type_t
+    struct enum_map_t *new;
 
     void (*destroy)(void *node);
     void (*print)(void *node);
@@ -34,9 +34,23 @@ typedef enum ast_layout_attribute_style_state_type {
 #include "ast.h"
 #include "ast_layout.h"
 #include "base.h"
+#include "enum_map.h"
+#include "enum_map_custom.h"
 #include "hashmap.h"
-#include "hashmap_custom.h"
 #include "memory.h"
+#include "name_table.h"
+
+/**
+ *
+ * @variable ast_layout_style_names
+ * @brief Name tables of styles and style states
+ * @type {name_table_t}
+ *
+ */
+extern name_table_t ast_layout_style_names;
+extern name_table_t ast_layout_style_enduser_names;
+extern name_table_t ast_layout_state_names;
+extern name_table_t ast_layout_state_enduser_names;
 
 /**
  *
@@ -107,11 +121,12 @@ void ast_layout_style_state_print(ast_layout_style_state_t *ast);
  *
  * @function ast_layout_style_state_create
  * @brief Create a new AST layout style state
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
  * @returns {ast_layout_style_state_t*} - Pointer to the created AST layout
  * style state
  *
  */
-ast_layout_style_state_t *ast_layout_style_state_create();
+ast_layout_style_state_t *ast_layout_style_state_create(salam_arena_t *arena);
 
 /**
  *
@@ -8,6 +8,7 @@ sources=(
 	"log.c"
 	"file.c"
 	"memory.c"
+	"arena.c"
 	"array.c"
 	"parser.c"
 	"downloader.c"
@@ -17,15 +18,25 @@ sources=(
 	"generator_salam.c"
 	"generator_layout_style.c"
 	"generator_identifier.c"
+	"generator_include.c"
+	"generator_minify.c"
 	"string_buffer.c"
 	"validator.c"
 	"hashmap.c"
-	"hashmap_custom.c"
+	"intern.c"
+	"enum_map.c"
+	"enum_map_custom.c"
+	"name_table.c"
+	"name_trie.c"
+	"number.c"
+	"unicode.c"
 	"array_custom.c"
 	"lexer.c"
+	"lexer_scan.c"
 	"ast.c"
 	"ast_layout.c"
 	"ast_layout_style.c"
+	"ast_binary.c"
 	"main.c"
 )
 
@@ -12,6 +12,7 @@ sources=(
 	"log.c"
 	"file.c"
 	"memory.c"
+	"arena.c"
 	"array.c"
 	"parser.c"
 	"parser_layout.c"
@@ -21,20 +22,31 @@ sources=(
 	"generator_salam.c"
 	"generator_layout_style.c"
 	"generator_identifier.c"
+	"generator_include.c"
+	"generator_minify.c"
 	"string_buffer.c"
 	"validator.c"
 	"hashmap.c"
-	"hashmap_custom.c"
+	"intern.c"
+	"enum_map.c"
+	"enum_map_custom.c"
+	"name_table.c"
+	"name_trie.c"
+	"number.c"
+	"unicode.c"
 	"array_custom.c"
 	"lexer.c"
+	"lexer_scan.c"
 	"ast.c"
 	"ast_layout.c"
 	"ast_layout_style.c"
+	"ast_binary.c"
 	"main.c"
 )
 
 echo "Compiling C files to WebAssembly..."
 emcc "${sources[@]}" -o ${OUTPUT_BASE}.html \
+	-msimd128 \
 	-s ALLOW_MEMORY_GROWTH=1 \
 	-s EXIT_RUNTIME=1 \
 	-s NO_EXIT_RUNTIME=1 \
@@ -5,7 +5,7 @@ REM Set the output executable name
 set output=salam
 
 REM List of source files
-set sources=log.c file.c memory.c downloader.c array.c parser.c parser_layout.c generator.c generator_layout.c generator_salam.c generator_layout_style.c generator_identifier.c string_buffer.c validator.c hashmap.c hashmap_custom.c array_custom.c lexer.c ast.c ast_layout.c ast_layout_style.c main.c
+set sources=log.c file.c memory.c arena.c downloader.c array.c parser.c parser_layout.c generator.c generator_layout.c generator_salam.c generator_layout_style.c generator_identifier.c generator_include.c generator_minify.c string_buffer.c validator.c hashmap.c intern.c enum_map.c enum_map_custom.c name_table.c name_trie.c number.c unicode.c array_custom.c lexer.c lexer_scan.c ast.c ast_layout.c ast_layout_style.c ast_binary.c main.c
 
 REM Ensure the output directory exists
 if not exist "..\out" (
@@ -0,0 +1,189 @@
+#include "enum_map.h"
+
+/**
+ *
+ * @function enum_map_create
+ * @brief Create a new map of enum keys
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity - Number of entries to reserve, can be 0
+ * @returns {enum_map_t*}
+ *
+ */
+enum_map_t *enum_map_create(salam_arena_t *arena, size_t capacity) {
+    DEBUG_ME;
+    enum_map_t *map = salam_arena_allocate(arena, sizeof(enum_map_t));
+
+    map->arena = arena;
+    memset(map->present, 0, sizeof(map->present));
+
+    map->keys = NULL;
+    map->data = NULL;
+    map->slots = NULL;
+    map->length = 0;
+    map->capacity = capacity;
+
+    if (capacity > 0) {
+        map->keys = salam_arena_allocate(arena, capacity * sizeof(uint16_t));
+        map->data = salam_arena_allocate(arena, capacity * sizeof(void *));
+        map->slots = salam_arena_allocate(arena, capacity * sizeof(uint16_t));
+    }
+
+    return map;
+}
+
+/**
+ *
+ * @function enum_map_index
+ * @brief Get the position a key has (or would have) in the sorted slots,
+ * which is the number of smaller keys in the map
+ * @params {const enum_map_t*} map - Enum map
+ * @params {size_t} key - Key
+ * @returns {size_t}
+ *
+ */
+size_t enum_map_index(const enum_map_t *map, size_t key) {
+    DEBUG_ME;
+    size_t word = key / 64;
+    size_t index = 0;
+
+    for (size_t i = 0; i < word; i++) {
+        index += (size_t)__builtin_popcountll(map->present[i]);
+    }
+
+    uint64_t below = (((uint64_t)1) << (key % 64)) - 1;
+
+    return index + (size_t)__builtin_popcountll(map->present[word] & below);
+}
+
+/**
+ *
+ * @function enum_map_has
+ * @brief Check if the map has a key
+ * @params {const enum_map_t*} map - Enum map
+ * @params {size_t} key - Key
+ * @returns {bool}
+ *
+ */
+bool enum_map_has(const enum_map_t *map, size_t key) {
+    DEBUG_ME;
+    if (key >= ENUM_MAP_KEYS) {
+        return false;
+    }
+
+    return (map->present[key / 64] >> (key % 64)) & 1;
+}
+
+/**
+ *
+ * @function enum_map_get
+ * @brief Get the value of a key
+ * @params {const enum_map_t*} map - Enum map
+ * @params {size_t} key - Key
+ * @returns {void*} Value, NULL if the map does not have the key
+ *
+ */
+void *enum_map_get(const enum_map_t *map, size_t key) {
+    DEBUG_ME;
+    if (!enum_map_has(map, key)) {
+        return NULL;
+    }
+
+    return map->data[map->slots[enum_map_index(map, key)]];
+}
+
+/**
+ *
+ * @function enum_map_put
+ * @brief Put a value in the map, replacing the value of the key if any
+ * @params {enum_map_t*} map - Enum map
+ * @params {size_t} key - Key, smaller than ENUM_MAP_KEYS
+ * @params {void*} value - Value
+ * @returns {void}
+ *
+ */
+void enum_map_put(enum_map_t *map, size_t key, void *value) {
+    DEBUG_ME;
+    if (key >= ENUM_MAP_KEYS) {
+        panic("Enum map key is too large");
+    }
+
+    size_t index = enum_map_index(map, key);
+
+    // A replaced value keeps the position of the key
+    if (enum_map_has(map, key)) {
+        map->data[map->slots[index]] = value;
+
+        return;
+    }
+
+    if (map->length == map->capacity) {
+        size_t capacity = map->capacity == 0 ? 2 : map->capacity * 2;
+
+        map->keys = salam_arena_reallocate(map->arena, map->keys,
+                                           map->capacity * sizeof(uint16_t),
+                                           capacity * sizeof(uint16_t));
+        map->data = salam_arena_reallocate(map->arena, map->data,
+                                           map->capacity * sizeof(void *),
+                                           capacity * sizeof(void *));
+        map->slots = salam_arena_reallocate(map->arena, map->slots,
+                                            map->capacity * sizeof(uint16_t),
+                                            capacity * sizeof(uint16_t));
+        map->capacity = capacity;
+    }
+
+    // The entries keep the order they are put in, so the layout is generated
+    // in source order, only the slots are sorted
+    memmove(map->slots + index + 1, map->slots + index,
+            (map->length - index) * sizeof(uint16_t));
+
+    map->slots[index] = (uint16_t)map->length;
+    map->keys[map->length] = (uint16_t)key;
+    map->data[map->length] = value;
+    map->length++;
+
+    map->present[key / 64] |= ((uint64_t)1) << (key % 64);
+}
+
+/**
+ *
+ * @function enum_map_print
+ * @brief Print the keys of the map
+ * @params {enum_map_t*} map - Enum map
+ * @returns {void}
+ *
+ */
+void enum_map_print(enum_map_t *map) {
+    DEBUG_ME;
+    printf("Enum map length: %zu\n", map->length);
+
+    for (size_t i = 0; i < map->length; i++) {
+        printf("[%zu] Key: %d\n", i, map->keys[i]);
+    }
+}
+
+/**
+ *
+ * @function enum_map_destroy
+ * @brief Free the map, not its values
+ * @params {enum_map_t*} map - Enum map
+ * @returns {void}
+ *
+ */
+void enum_map_destroy(enum_map_t *map) {
+    DEBUG_ME;
+    if (map != NULL && map->arena == NULL) {
+        if (map->keys != NULL) {
+            memory_destroy(map->keys);
+        }
+
+        if (map->data != NULL) {
+            memory_destroy(map->data);
+        }
+
+        if (map->slots != NULL) {
+            memory_destroy(map->slots);
+        }
+
+        memory_destroy(map);
+    }
+}
@@ -0,0 +1,117 @@
+#ifndef _ENUM_MAP_H_
+#define _ENUM_MAP_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arena.h"
+
+// Keys of an enum map are smaller than this, it must be a multiple of 64 and
+// cover every ast_layout_attribute_type_t (checked in ast_layout.h)
+#define ENUM_MAP_KEYS 320
+
+#define ENUM_MAP_WORDS (ENUM_MAP_KEYS / 64)
+
+struct enum_map_t;
+
+typedef struct enum_map_t {
+    salam_arena_t *arena;  // NULL if the map is on the heap
+
+    uint64_t present[ENUM_MAP_WORDS];  // bit of every key in the map
+
+    // Keys and values, in the order first put, NULL until the first put
+    uint16_t *keys;
+    void **data;
+    uint16_t *slots;  // index in keys and data of every key, sorted by key
+    size_t length;
+    size_t capacity;
+} enum_map_t;
+
+typedef enum_map_t enum_map_layout_attribute_t;
+typedef enum_map_t enum_map_layout_style_state_t;
+
+#include "base.h"
+#include "log.h"
+#include "memory.h"
+
+/**
+ *
+ * @function enum_map_create
+ * @brief Create a new map of enum keys
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity - Number of entries to reserve, can be 0
+ * @returns {enum_map_t*}
+ *
+ */
+enum_map_t *enum_map_create(salam_arena_t *arena, size_t capacity);
+
+/**
+ *
+ * @function enum_map_index
+ * @brief Get the position a key has (or would have) in the sorted slots,
+ * which is the number of smaller keys in the map
+ * @params {const enum_map_t*} map - Enum map
+ * @params {size_t} key - Key
+ * @returns {size_t}
+ *
+ */
+size_t enum_map_index(const enum_map_t *map, size_t key);
+
+/**
+ *
+ * @function enum_map_has
+ * @brief Check if the map has a key
+ * @params {const enum_map_t*} map - Enum map
+ * @params {size_t} key - Key
+ * @returns {bool}
+ *
+ */
+bool enum_map_has(const enum_map_t *map, size_t key);
+
+/**
+ *
+ * @function enum_map_get
+ * @brief Get the value of a key
+ * @params {const enum_map_t*} map - Enum map
+ * @params {size_t} key - Key
+ * @returns {void*} Value, NULL if the map does not have the key
+ *
+ */
+void *enum_map_get(const enum_map_t *map, size_t key);
+
+/**
+ *
+ * @function enum_map_put
+ * @brief Put a value in the map, replacing the value of the key if any
+ * @params {enum_map_t*} map - Enum map
+ * @params {size_t} key - Key, smaller than ENUM_MAP_KEYS
+ * @params {void*} value - Value
+ * @returns {void}
+ *
+ */
+void enum_map_put(enum_map_t *map, size_t key, void *value);
+
+/**
+ *
+ * @function enum_map_print
+ * @brief Print the keys of the map
+ * @params {enum_map_t*} map - Enum map
+ * @returns {void}
+ *
+ */
+void enum_map_print(enum_map_t *map);
+
+/**
+ *
+ * @function enum_map_destroy
+ * @brief Free the map, not its values
+ * @params {enum_map_t*} map - Enum map
+ * @returns {void}
+ *
+ */
+void enum_map_destroy(enum_map_t *map);
+
+#endif
@@ -0,0 +1,181 @@
+#include "enum_map_custom.h"
+
+/**
+ *
+ * @function enum_map_create_layout_attribute
+ * @brief Create a new map of layout attributes by attribute type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity
+ * @returns {enum_map_layout_attribute_t*}
+ *
+ */
+enum_map_layout_attribute_t *enum_map_create_layout_attribute(
+    salam_arena_t *arena, size_t capacity) {
+    DEBUG_ME;
+    enum_map_layout_attribute_t *map = enum_map_create(arena, capacity);
+
+    return map;
+}
+
+/**
+ *
+ * @function enum_map_print_layout_attribute
+ * @brief Print the map of layout attributes
+ * @params {enum_map_layout_attribute_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_print_layout_attribute(enum_map_layout_attribute_t *map) {
+    DEBUG_ME;
+    printf("Enum map length: %zu\n", map->length);
+    if (map->length == 0) {
+        printf("Enum map is empty\n");
+        return;
+    }
+
+    for (size_t i = 0; i < map->length; i++) {
+        ast_layout_attribute_t *layout_attribute = map->data[i];
+
+        printf("[%zu] Key: %s, Value: ", i,
+               ast_layout_attribute_type_to_name(map->keys[i]));
+
+        if (layout_attribute != NULL) {
+            ast_layout_attribute_print(layout_attribute);
+        } else {
+            printf("NULL\n");
+        }
+    }
+}
+
+/**
+ *
+ * @function enum_map_destroy_layout_attribute
+ * @brief Destroy the map of layout attributes
+ * @params {enum_map_layout_attribute_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_destroy_layout_attribute(enum_map_layout_attribute_t *map) {
+    DEBUG_ME;
+    if (map != NULL && map->arena == NULL) {
+        for (size_t i = 0; i < map->length; i++) {
+            ast_layout_attribute_t *layout_attribute = map->data[i];
+
+            if (layout_attribute != NULL) {
+                ast_layout_attribute_destroy(layout_attribute);
+            }
+        }
+
+        enum_map_destroy(map);
+    }
+}
+
+/**
+ *
+ * @function enum_map_layout_attribute_has_any_sub_value
+ * @brief Check if the map has any sub value layout attribute
+ * @params {enum_map_layout_attribute_t*} map
+ * @returns {bool}
+ *
+ */
+bool enum_map_layout_attribute_has_any_sub_value(
+    enum_map_layout_attribute_t *map) {
+    DEBUG_ME;
+    if (map != NULL) {
+        for (size_t i = 0; i < map->length; i++) {
+            ast_layout_attribute_t *value = map->data[i];
+
+            if (value != NULL) {
+                if (ast_layout_attribute_has_any_sub_value(value)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ *
+ * @function enum_map_create_layout_style_state
+ * @brief Create a new map of layout style states by style state type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity
+ * @returns {enum_map_layout_style_state_t*}
+ *
+ */
+enum_map_layout_style_state_t *enum_map_create_layout_style_state(
+    salam_arena_t *arena, size_t capacity) {
+    DEBUG_ME;
+    enum_map_layout_style_state_t *map = enum_map_create(arena, capacity);
+
+    return map;
+}
+
+/**
+ *
+ * @function enum_map_print_layout_style_state
+ * @brief Print the map of layout style states
+ * @params {enum_map_layout_style_state_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_print_layout_style_state(enum_map_layout_style_state_t *map) {
+    DEBUG_ME;
+    printf("Enum map style states length: %zu\n", map->length);
+
+    if (map->length == 0) {
+        printf("Enum map style states is empty\n");
+        return;
+    }
+}
+
+/**
+ *
+ * @function enum_map_destroy_layout_style_state
+ * @brief Destroy the map of layout style states
+ * @params {enum_map_layout_style_state_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_destroy_layout_style_state(enum_map_layout_style_state_t *map) {
+    DEBUG_ME;
+    if (map != NULL && map->arena == NULL) {
+        for (size_t i = 0; i < map->length; i++) {
+            ast_layout_style_state_t *value = map->data[i];
+
+            if (value != NULL) {
+                value->destroy(value);
+            }
+        }
+
+        enum_map_destroy(map);
+    }
+}
+
+/**
+ *
+ * @function enum_map_layout_style_state_has_any_sub_value
+ * @brief Check if the map has any sub value layout attribute style state
+ * @params {enum_map_layout_style_state_t*} map
+ * @returns {bool}
+ *
+ */
+bool enum_map_layout_style_state_has_any_sub_value(
+    enum_map_layout_style_state_t *map) {
+    DEBUG_ME;
+    if (map != NULL) {
+        for (size_t i = 0; i < map->length; i++) {
+            ast_layout_style_state_t *value = map->data[i];
+
+            if (value != NULL) {
+                if (ast_layout_style_state_has_any_sub_value(value)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
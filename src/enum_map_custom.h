@@ -0,0 +1,99 @@
+#ifndef _ENUM_MAP_CUSTOM_H_
+#define _ENUM_MAP_CUSTOM_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "enum_map.h"
+#include "memory.h"
+
+#include "ast_layout.h"
+
+/**
+ *
+ * @function enum_map_create_layout_attribute
+ * @brief Create a new map of layout attributes by attribute type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity
+ * @returns {enum_map_layout_attribute_t*}
+ *
+ */
+enum_map_layout_attribute_t *enum_map_create_layout_attribute(
+    salam_arena_t *arena, size_t capacity);
+
+/**
+ *
+ * @function enum_map_print_layout_attribute
+ * @brief Print the map of layout attributes
+ * @params {enum_map_layout_attribute_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_print_layout_attribute(enum_map_layout_attribute_t *map);
+
+/**
+ *
+ * @function enum_map_destroy_layout_attribute
+ * @brief Destroy the map of layout attributes
+ * @params {enum_map_layout_attribute_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_destroy_layout_attribute(enum_map_layout_attribute_t *map);
+
+/**
+ *
+ * @function enum_map_layout_attribute_has_any_sub_value
+ * @brief Check if the map has any sub value layout attribute
+ * @params {enum_map_layout_attribute_t*} map
+ * @returns {bool}
+ *
+ */
+bool enum_map_layout_attribute_has_any_sub_value(
+    enum_map_layout_attribute_t *map);
+
+/**
+ *
+ * @function enum_map_create_layout_style_state
+ * @brief Create a new map of layout style states by style state type
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity
+ * @returns {enum_map_layout_style_state_t*}
+ *
+ */
+enum_map_layout_style_state_t *enum_map_create_layout_style_state(
+    salam_arena_t *arena, size_t capacity);
+
+/**
+ *
+ * @function enum_map_print_layout_style_state
+ * @brief Print the map of layout style states
+ * @params {enum_map_layout_style_state_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_print_layout_style_state(enum_map_layout_style_state_t *map);
+
+/**
+ *
+ * @function enum_map_destroy_layout_style_state
+ * @brief Destroy the map of layout style states
+ * @params {enum_map_layout_style_state_t*} map
+ * @returns {void}
+ *
+ */
+void enum_map_destroy_layout_style_state(enum_map_layout_style_state_t *map);
+
+/**
+ *
+ * @function enum_map_layout_style_state_has_any_sub_value
+ * @brief Check if the map has any sub value layout attribute style state
+ * @params {enum_map_layout_style_state_t*} map
+ * @returns {bool}
+ *
+ */
+bool enum_map_layout_style_state_has_any_sub_value(
+    enum_map_layout_style_state_t *map);
+
+#endif
@@ -1,3 +1,13 @@
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#define _XOPEN_SOURCE 700
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "file.h"
 
 /**
@@ -100,6 +110,33 @@ bool file_writes(const char *path, const char *content) {
     return true;
 }
 
+/**
+ *
+ * @function file_writes_binary
+ * @brief Writing binary content to a file
+ * @params {const char*} path - Path of file
+ * @params {const char*} content - Content of file, can contain NUL bytes
+ * @params {size_t} size - Size of the content in bytes
+ * @returns {bool}
+ *
+ */
+bool file_writes_binary(const char *path, const char *content, size_t size) {
+    DEBUG_ME;
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        printf("Failed to write file %s\n", path);
+        panic("");
+
+        return false;
+    }
+
+    bool written = fwrite(content, 1, size, file) == size;
+
+    fclose(file);
+
+    return written;
+}
+
 /**
  *
  * @function file_exists
@@ -340,6 +377,24 @@ char *file_get_absolute(const char *path) {
     return resolved_path;
 }
 
+/**
+ *
+ * @function file_get_real
+ * @brief Resolve the canonical absolute path of an existing file, following
+ * symbolic links and relative to the working directory
+ * @params {const char*} path - Path of file
+ * @returns {char*} - Canonical path, or NULL if the file does not exist
+ *
+ */
+char *file_get_real(const char *path) {
+    DEBUG_ME;
+#ifdef _WIN32
+    return _fullpath(NULL, path, 0);
+#else
+    return realpath(path, NULL);
+#endif
+}
+
 /**
  *
  * @function file_get_capacity
@@ -425,3 +480,100 @@ bool file_appends_wchar(const char *path, const wchar_t wc) {
 
     return file_appends(path, error_message);
 }
+
+/**
+ *
+ * @function file_map
+ * @brief Mapping a file into memory read-only, the pages are read on demand
+ * and the kernel is told they are read sequentially. Empty files and files
+ * that cannot be mapped are read into the heap instead
+ * @params {const char*} path - Path of file
+ * @returns {file_map_t*} - Mapped file, data is not NUL-terminated
+ *
+ */
+file_map_t *file_map(const char *path) {
+    DEBUG_ME;
+    file_map_t *map = memory_allocate(sizeof(file_map_t));
+    map->data = NULL;
+    map->size = 0;
+    map->mapped = false;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER size;
+
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping =
+                CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+            if (mapping != NULL) {
+                map->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                map->size = (size_t)size.QuadPart;
+
+                // The view keeps the file open
+                CloseHandle(mapping);
+            }
+        }
+
+        CloseHandle(file);
+    }
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd != -1) {
+        struct stat st;
+
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *data =
+                mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data != MAP_FAILED) {
+                posix_madvise(data, (size_t)st.st_size,
+                              POSIX_MADV_SEQUENTIAL);
+
+                map->data = data;
+                map->size = (size_t)st.st_size;
+            }
+        }
+
+        // The mapping keeps the file open
+        close(fd);
+    }
+#endif
+
+    if (map->data != NULL) {
+        map->mapped = true;
+    } else {
+        map->data = file_reads_binary(path, &map->size);
+    }
+
+    return map;
+}
+
+/**
+ *
+ * @function file_unmap
+ * @brief Unmapping a file mapped by file_map
+ * @params {file_map_t*} map - Mapped file
+ * @returns {void}
+ *
+ */
+void file_unmap(file_map_t *map) {
+    DEBUG_ME;
+    if (map == NULL) {
+        return;
+    }
+
+    if (map->mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(map->data);
+#else
+        munmap((void *)map->data, map->size);
+#endif
+    } else {
+        memory_destroy((void *)map->data);
+    }
+
+    memory_destroy(map);
+}
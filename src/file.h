@@ -15,6 +15,12 @@
 #include "memory.h"
 #include "string_buffer.h"
 
+typedef struct {
+    const char *data;  // not NUL-terminated when mapped
+    size_t size;
+    bool mapped;  // false if data is a heap copy (empty or unmappable file)
+} file_map_t;
+
 /**
  *
  * @function file_reads
@@ -37,6 +43,18 @@ char *file_reads(const char *path, size_t *size);
  */
 bool file_writes(const char *path, const char *content);
 
+/**
+ *
+ * @function file_writes_binary
+ * @brief Writing binary content to a file
+ * @params {const char*} path - Path of file
+ * @params {const char*} content - Content of file, can contain NUL bytes
+ * @params {size_t} size - Size of the content in bytes
+ * @returns {bool}
+ *
+ */
+bool file_writes_binary(const char *path, const char *content, size_t size);
+
 /**
  *
  * @function file_appends
@@ -130,6 +148,17 @@ char *file_get_directory(const char *path);
  */
 char *file_get_absolute(const char *path);
 
+/**
+ *
+ * @function file_get_real
+ * @brief Resolve the canonical absolute path of an existing file, following
+ * symbolic links and relative to the working directory
+ * @params {const char*} path - Path of file
+ * @returns {char*} - Canonical path, or NULL if the file does not exist
+ *
+ */
+char *file_get_real(const char *path);
+
 /**
  *
  * @function file_get_capacity
@@ -182,4 +211,26 @@ bool file_appends_wchar(const char *path, const wchar_t wc);
  */
 char *file_reads_binary(const char *path, size_t *size);
 
+/**
+ *
+ * @function file_map
+ * @brief Mapping a file into memory read-only, the pages are read on demand
+ * and the kernel is told they are read sequentially. Empty files and files
+ * that cannot be mapped are read into the heap instead
+ * @params {const char*} path - Path of file
+ * @returns {file_map_t*} - Mapped file, data is not NUL-terminated
+ *
+ */
+file_map_t *file_map(const char *path);
+
+/**
+ *
+ * @function file_unmap
+ * @brief Unmapping a file mapped by file_map
+ * @params {file_map_t*} map - Mapped file
+ * @returns {void}
+ *
+ */
+void file_unmap(file_map_t *map);
+
 #endif
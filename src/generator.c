@@ -16,6 +16,7 @@ generator_t *generator_create(ast_t *ast) {
 
     generator_t *generator = memory_allocate(sizeof(generator_t));
     generator->ast = ast;
+    generator->head = string_create(1024);
     generator->html = string_create(4096);
     generator->css = string_create(4096);
     generator->media_css = string_create(512);
@@ -25,6 +26,10 @@ generator_t *generator_create(ast_t *ast) {
 
     generator->inlineCSS = false;
     generator->inlineJS = false;
+    generator->atomicCSS = false;
+    generator->minify = false;
+
+    generator->repeat_limit = GENERATOR_REPEAT_LIMIT;
 
     // generator->inlineCSS = true;
     // generator->inlineJS = true;
@@ -33,6 +38,17 @@ generator_t *generator_create(ast_t *ast) {
 
     generator_identifier_init(generator->identifier);
 
+    generator->styles = hashmap_create(64);
+    generator->media = hashmap_create(16);
+    generator->media_blocks = array_create(sizeof(char *), 8);
+
+    for (size_t i = 0; i < GENERATOR_STYLE_STATES; i++) {
+        generator->groups[i].rules = hashmap_create(16);
+        generator->groups[i].order = array_create(sizeof(char *), 8);
+    }
+
+    generator->includes = generator_includes_create();
+
     return generator;
 }
 
@@ -47,6 +63,10 @@ generator_t *generator_create(ast_t *ast) {
 void generator_destroy(generator_t *generator) {
     DEBUG_ME;
     if (generator != NULL) {
+        if (generator->head != NULL) {
+            string_destroy(generator->head);
+        }
+
         if (generator->html != NULL) {
             string_destroy(generator->html);
         }
@@ -71,6 +91,37 @@ void generator_destroy(generator_t *generator) {
             generator_identifier_destroy(generator->identifier);
         }
 
+        if (generator->styles != NULL) {
+            hashmap_destroy(generator->styles);
+        }
+
+        // The @media blocks are owned by the array, the map only finds them
+        if (generator->media_blocks != NULL) {
+            for (size_t i = 0; i < generator->media_blocks->length; i++) {
+                generator_code_layout_media_destroy(
+                    array_get(generator->media_blocks, i));
+            }
+
+            hashmap_destroy_custom(generator->media, NULL);
+            array_destroy(generator->media_blocks);
+        }
+
+        // The rules are owned by the arrays, the maps only find them
+        for (size_t i = 0; i < GENERATOR_STYLE_STATES; i++) {
+            generator_group_t *group = &generator->groups[i];
+
+            for (size_t j = 0; j < group->order->length; j++) {
+                generator_code_layout_rule_destroy(array_get(group->order, j));
+            }
+
+            hashmap_destroy_custom(group->rules, NULL);
+            array_destroy(group->order);
+        }
+
+        if (generator->includes != NULL) {
+            generator_includes_destroy(generator->includes);
+        }
+
         memory_destroy(generator);
     }
 }
@@ -89,30 +140,37 @@ void generator_debug(generator_t *generator) {
         printf("generator is NULL\n");
         return;
     } else {
+        printf("generator->head: ");
+        if (generator->head != NULL) {
+            string_print(generator->head);
+        } else {
+            printf("NULL\n");
+        }
+
         printf("generator->html: ");
         if (generator->html != NULL) {
-            generator->html->print(generator->html);
+            string_print(generator->html);
         } else {
             printf("NULL\n");
         }
 
         printf("generator->media_css: ");
         if (generator->media_css != NULL) {
-            generator->media_css->print(generator->media_css);
+            string_print(generator->media_css);
         } else {
             printf("NULL\n");
         }
 
         printf("generator->css: ");
         if (generator->css != NULL) {
-            generator->css->print(generator->css);
+            string_print(generator->css);
         } else {
             printf("NULL\n");
         }
 
         printf("generator->js: ");
         if (generator->js != NULL) {
-            generator->js->print(generator->js);
+            string_print(generator->js);
         } else {
             printf("NULL\n");
         }
@@ -139,7 +197,7 @@ void generator_save(generator_t *generator, const char *html_output,
             string_append(html_output_file, generator->output_dir);
             string_append_str(html_output_file, html_output);
 
-            file_writes(html_output_file->data, generator->html->data);
+            generator_save_html(generator, html_output_file->data);
 
             string_destroy(html_output_file);
         }
@@ -167,6 +225,67 @@ void generator_save(generator_t *generator, const char *html_output,
     }
 }
 
+/**
+ *
+ * @function generator_write_html
+ * @brief Write the generated HTML document to a file
+ * @params {generator_t*} generator - Generator
+ * @params {FILE*} file - File, e.g. stdout
+ * @returns {bool}
+ *
+ */
+bool generator_write_html(generator_t *generator, FILE *file) {
+    DEBUG_ME;
+    // The head and the body are written as they are, without joining them
+    return fwrite(generator->head->data, 1, generator->head->length, file) ==
+               generator->head->length &&
+           fwrite(generator->html->data, 1, generator->html->length, file) ==
+               generator->html->length;
+}
+
+/**
+ *
+ * @function generator_save_html
+ * @brief Save the generated HTML document to a path
+ * @params {generator_t*} generator - Generator
+ * @params {const char*} path - Path of the file
+ * @returns {bool}
+ *
+ */
+bool generator_save_html(generator_t *generator, const char *path) {
+    DEBUG_ME;
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        printf("Failed to write file %s\n", path);
+        panic("");
+
+        return false;
+    }
+
+    bool written = generator_write_html(generator, file);
+
+    fclose(file);
+
+    return written;
+}
+
+/**
+ *
+ * @function generator_code_newline
+ * @brief Append a new line, which is only there to be readable, so nothing in
+ * the minify mode
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} code - Output the new line is appended to
+ * @returns {void}
+ *
+ */
+void generator_code_newline(generator_t *generator, string_t *code) {
+    DEBUG_ME;
+    if (generator->minify == false) {
+        string_append_char(code, '\n');
+    }
+}
+
 /**
  *
  * @function generator_code_node
@@ -197,7 +316,7 @@ string_t *generator_code_node(generator_t *generator, ast_node_t *node) {
             if (block_code != NULL) {
                 string_append(code, block_code);
 
-                block_code->destroy(block_code);
+                string_destroy(block_code);
             }
         } break;
 
@@ -208,7 +327,7 @@ string_t *generator_code_node(generator_t *generator, ast_node_t *node) {
             if (function_code != NULL) {
                 string_append(code, function_code);
 
-                function_code->destroy(function_code);
+                string_destroy(function_code);
             }
         } break;
 
@@ -220,7 +339,7 @@ string_t *generator_code_node(generator_t *generator, ast_node_t *node) {
             if (if_code != NULL) {
                 string_append(code, if_code);
 
-                if_code->destroy(if_code);
+                string_destroy(if_code);
             }
         } break;
 
@@ -231,7 +350,7 @@ string_t *generator_code_node(generator_t *generator, ast_node_t *node) {
             if (return_code != NULL) {
                 string_append(code, return_code);
 
-                return_code->destroy(return_code);
+                string_destroy(return_code);
             }
         } break;
 
@@ -242,7 +361,7 @@ string_t *generator_code_node(generator_t *generator, ast_node_t *node) {
             if (print_code != NULL) {
                 string_append(code, print_code);
 
-                print_code->destroy(print_code);
+                string_destroy(print_code);
             }
         } break;
     }
@@ -356,80 +475,84 @@ string_t *generator_code_value(generator_t *generator, ast_value_t *value) {
     DEBUG_ME;
     string_t *code = string_create(1024);
 
-    if (generator) {
-    }
-
     if (value == NULL) {
         error_generator(2, "Value is NULL in value statement");
 
         return code;
     }
 
-    if (value->type != NULL) {
-        switch (value->type->kind) {
-            case AST_TYPE_KIND_VOID:
-                string_append_str(code, "VOID");
+    switch (value->type.kind) {
+        case AST_TYPE_KIND_VOID:
+            string_append_str(code, "VOID");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_INT:
-                string_append_str(code, int2string(value->data.int_value));
+        case AST_TYPE_KIND_INT:
+            string_append_str(code, int2string(value->data.int_value));
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_FLOAT:
-                string_append_str(code, float2string(value->data.float_value));
+        case AST_TYPE_KIND_FLOAT: {
+            char *number = float2string(value->data.float_value);
 
-                return code;
+            // Infinity and NaN are written as they are
+            if (generator->minify == true &&
+                strspn(number, "-0123456789.") == strlen(number)) {
+                generator_minify_number(code, number, strlen(number));
+            } else {
+                string_append_str(code, number);
+            }
+
+            return code;
+        }
 
-            case AST_TYPE_KIND_CHAR:
-                string_append_char(code, value->data.char_value);
+        case AST_TYPE_KIND_CHAR:
+            string_append_char(code, value->data.char_value);
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_NULL:
-                string_append_str(code, "NULL");
+        case AST_TYPE_KIND_NULL:
+            string_append_str(code, "NULL");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_STRING:
-                string_append_char(code, '"');
-                string_append_str(code, value->data.string_value);
-                string_append_char(code, '"');
+        case AST_TYPE_KIND_STRING:
+            string_append_char(code, '"');
+            string_append_str(code, value->data.string_value);
+            string_append_char(code, '"');
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_BOOL:
-                string_append_str(code,
-                                  value->data.bool_value ? "true" : "false");
+        case AST_TYPE_KIND_BOOL:
+            string_append_str(code,
+                              value->data.bool_value ? "true" : "false");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_STRUCT:
-                string_append_str(code, "STRUCT");
+        case AST_TYPE_KIND_STRUCT:
+            string_append_str(code, "STRUCT");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_ENUM:
-                string_append_str(code, "ENUM");
+        case AST_TYPE_KIND_ENUM:
+            string_append_str(code, "ENUM");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_POINTER:
-                string_append_str(code, "POINTER");
+        case AST_TYPE_KIND_POINTER:
+            string_append_str(code, "POINTER");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_ARRAY:
-                string_append_str(code, "ARRAY");
+        case AST_TYPE_KIND_ARRAY:
+            string_append_str(code, "ARRAY");
 
-                return code;
+            return code;
 
-            case AST_TYPE_KIND_FUNCTION:
-                string_append_str(code, "FUNCTION");
+        case AST_TYPE_KIND_FUNCTION:
+            string_append_str(code, "FUNCTION");
 
-                return code;
-        }
+            return code;
     }
 
     string_append_str(code, "unknown value");
@@ -461,10 +584,11 @@ string_t *generator_code_values(generator_t *generator, array_t *values) {
                     string_append(code, value_code);
 
                     if (i != values->length - 1) {
-                        string_append_str(code, ", ");
+                        string_append_str(code,
+                                          generator->minify ? "," : ", ");
                     }
 
-                    value_code->destroy(value_code);
+                    string_destroy(value_code);
                 }
             }
         }
@@ -503,9 +627,9 @@ string_t *generator_code_print(generator_t *generator, ast_print_t *print) {
     string_append(code, values_code);
     string_append_char(code, ')');
     string_append_char(code, ';');
-    string_append_char(code, '\n');
+    generator_code_newline(generator, code);
 
-    values_code->destroy(values_code);
+    string_destroy(values_code);
 
     return code;
 }
@@ -529,7 +653,7 @@ string_t *generator_code_return(generator_t *generator, ast_return_t *returns) {
 
     if (returns->values->length == 0) {
         string_append_str(code, "return;");
-        string_append_char(code, '\n');
+        generator_code_newline(generator, code);
     } else {
         string_t *values_code =
             generator_code_values(generator, returns->values);
@@ -545,9 +669,9 @@ string_t *generator_code_return(generator_t *generator, ast_return_t *returns) {
         string_append(code, values_code);
         string_append_char(code, ')');
         string_append_char(code, ';');
-        string_append_char(code, '\n');
+        generator_code_newline(generator, code);
 
-        values_code->destroy(values_code);
+        string_destroy(values_code);
     }
 
     return code;
@@ -574,12 +698,12 @@ string_t *generator_code_if(generator_t *generator, ast_if_t *ifclause) {
             error_generator(2, "Error generating code for if clause condition");
         }
 
-        string_append_str(code, "if (");
+        string_append_str(code, generator->minify ? "if(" : "if (");
         string_append(code, condition_code);
-        string_append_str(code, ") ");
+        string_append_str(code, generator->minify ? ")" : ") ");
 
         if (condition_code != NULL) {
-            condition_code->destroy(condition_code);
+            string_destroy(condition_code);
         }
     }
 
@@ -588,7 +712,7 @@ string_t *generator_code_if(generator_t *generator, ast_if_t *ifclause) {
     if (block_code != NULL) {
         string_append(code, block_code);
 
-        block_code->destroy(block_code);
+        string_destroy(block_code);
     }
 
     if (ifclause->else_blocks != NULL) {
@@ -607,7 +731,7 @@ string_t *generator_code_if(generator_t *generator, ast_if_t *ifclause) {
 
                     string_append(code, else_if_code);
 
-                    else_if_code->destroy(else_if_code);
+                    string_destroy(else_if_code);
                 }
             }
         }
@@ -630,7 +754,7 @@ string_t *generator_code_block(generator_t *generator, ast_block_t *block) {
     string_t *code = string_create(1024);
 
     string_append_char(code, '{');
-    string_append_char(code, '\n');
+    generator_code_newline(generator, code);
 
     if (block != NULL) {
         for (size_t i = 0; i < block->children->length; i++) {
@@ -642,14 +766,14 @@ string_t *generator_code_block(generator_t *generator, ast_block_t *block) {
                 if (node_code != NULL) {
                     string_append(code, node_code);
 
-                    node_code->destroy(node_code);
+                    string_destroy(node_code);
                 }
             }
         }
     }
 
     string_append_char(code, '}');
-    string_append_char(code, '\n');
+    generator_code_newline(generator, code);
 
     return code;
 }
@@ -675,7 +799,7 @@ string_t *generator_code_function(generator_t *generator,
 
     string_t *code_block = generator_code_block(generator, function->block);
     string_append(code, code_block);
-    code_block->destroy(code_block);
+    string_destroy(code_block);
 
     return code;
 }
@@ -704,7 +828,7 @@ void generator_code_functions(generator_t *generator) {
                 if (function_code != NULL) {
                     string_append(generator->js, function_code);
 
-                    function_code->destroy(function_code);
+                    string_destroy(function_code);
                 }
             }
         }
@@ -2,19 +2,52 @@
 #define _GENERATOR_H_
 
 #include <stddef.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "ast.h"
 #include "file.h"
 #include "generator_identifier.h"
+#include "generator_include.h"
+#include "generator_minify.h"
+#include "hashmap.h"
 #include "memory.h"
 #include "string_buffer.h"
 #include "validator.h"
 
+// Default of the highest 'repeat' attribute value, see generator_t
+#define GENERATOR_REPEAT_LIMIT 1000
+
+// @media block of the rules of one media query
+typedef struct generator_media_t {
+    const char *query;  // interned
+    string_t *rules;
+    size_t index;  // position in the @media blocks
+} generator_media_t;
+
+// Number of style states, see ast_layout_attribute_style_state_type.h
+#define GENERATOR_STYLE_STATES (AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR + 1)
+
+// Style state of the rules without one, never a state of a layout block
+#define GENERATOR_STYLE_STATE_NONE AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR
+
+// Rule of the classes in one style state with the same declarations
+typedef struct generator_rule_t {
+    const char *declarations;  // interned
+    string_t *selectors;
+} generator_rule_t;
+
+// Rules of one style state, grouped by their declarations
+typedef struct generator_group_t {
+    hashmap_t *rules;  // last rule (generator_rule_t*) by declarations
+    array_t *order;  // rules, in the order they are written
+} generator_group_t;
+
 typedef struct generator_t {
     ast_t *ast;
 
-    string_t *html;
+    string_t *head;  // the document before the body, see generator_code_layout
+    string_t *html;  // the body, every layout node is appended to it once
     string_t *css;
     string_t *media_css;
     string_t *js;
@@ -23,8 +56,18 @@ typedef struct generator_t {
 
     bool inlineCSS;
     bool inlineJS;
+    bool atomicCSS;  // one shared class per CSS declaration
+    bool minify;  // no optional whitespace, shorter CSS and attributes
+
+    size_t repeat_limit;  // highest 'repeat' attribute value
 
     generator_identifier_t *identifier;
+    hashmap_t *styles;  // class by the CSS rules generated for it
+    hashmap_t *media;  // last @media block (generator_media_t*) by media query
+    array_t *media_blocks;  // @media blocks, in the order they are written
+    generator_group_t groups[GENERATOR_STYLE_STATES];  // rules by style state
+
+    struct generator_includes_t *includes;
 } generator_t;
 
 /**
@@ -68,6 +111,40 @@ void generator_debug(generator_t *generator);
 void generator_save(generator_t *generator, const char *html_output,
                     const char *css_output, const char *js_output);
 
+/**
+ *
+ * @function generator_write_html
+ * @brief Write the generated HTML document to a file
+ * @params {generator_t*} generator - Generator
+ * @params {FILE*} file - File, e.g. stdout
+ * @returns {bool}
+ *
+ */
+bool generator_write_html(generator_t *generator, FILE *file);
+
+/**
+ *
+ * @function generator_save_html
+ * @brief Save the generated HTML document to a path
+ * @params {generator_t*} generator - Generator
+ * @params {const char*} path - Path of the file
+ * @returns {bool}
+ *
+ */
+bool generator_save_html(generator_t *generator, const char *path);
+
+/**
+ *
+ * @function generator_code_newline
+ * @brief Append a new line, which is only there to be readable, so nothing in
+ * the minify mode
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} code - Output the new line is appended to
+ * @returns {void}
+ *
+ */
+void generator_code_newline(generator_t *generator, string_t *code);
+
 /**
  *
  * @function generator_code_functions
@@ -192,13 +269,13 @@ char *generator_code_layout_node_type(ast_layout_node_type_t type);
  *
  * @function generator_code_layout_style
  * @brief Generate the CSS code for the layout block
- * @params {hashmap_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
  * @params {ast_layout_block_t*} block - Layout block
  * @params {size_t*} css_attributes_length - CSS attributes length
  * @returns {string_t*}
  *
  */
-string_t *generator_code_layout_style(hashmap_layout_attribute_t *styles,
+string_t *generator_code_layout_style(enum_map_layout_attribute_t *styles,
                                       ast_layout_block_t *block,
                                       size_t *css_attributes_length);
 
@@ -0,0 +1,192 @@
+#include "generator_include.h"
+
+/**
+ *
+ * @function generator_includes_create
+ * @brief Create an empty include cache
+ * @returns {generator_includes_t*}
+ *
+ */
+generator_includes_t *generator_includes_create(void) {
+    DEBUG_ME;
+    generator_includes_t *includes =
+        memory_allocate(sizeof(generator_includes_t));
+
+    includes->files = hashmap_create(16);
+    includes->dependencies = array_create(sizeof(char *), 8);
+
+    return includes;
+}
+
+/**
+ *
+ * @function generator_includes_destroy
+ * @brief Destroy an include cache and every file in it
+ * @params {generator_includes_t*} includes - Include cache
+ * @returns {void}
+ *
+ */
+void generator_includes_destroy(generator_includes_t *includes) {
+    DEBUG_ME;
+    if (includes != NULL) {
+        hashmap_destroy_custom(includes->files, generator_include_destroy);
+
+        // The paths are interned, only the array is freed
+        array_destroy(includes->dependencies);
+
+        memory_destroy(includes);
+    }
+}
+
+/**
+ *
+ * @function generator_includes_get
+ * @brief Get an included file, parsing it on first use or when it changed on
+ * disk since (by modification time and size)
+ * @params {generator_includes_t*} includes - Include cache
+ * @params {const char*} path - Path of the file, as written in the layout
+ * @returns {generator_include_t*}
+ *
+ */
+generator_include_t *generator_includes_get(generator_includes_t *includes,
+                                            const char *path) {
+    DEBUG_ME;
+    char *resolved = file_get_real(path);
+    struct stat st;
+
+    if (resolved == NULL || stat(resolved, &st) != 0) {
+        error_generator(1, "Include file '%s' does not exist", path);
+    }
+
+    // The same file reached by two different paths is one entry
+    const char *real_path = salam_intern(resolved);
+
+    memory_destroy(resolved);
+
+    generator_include_t *include = hashmap_get(includes->files, real_path);
+
+    if (include == NULL) {
+        array_push(includes->dependencies, (void *)real_path);
+    } else if (include->active) {
+        error_generator(
+            1, "Include file '%s' includes itself, directly or through others",
+            path);
+    } else if (include->modified == st.st_mtime &&
+               include->size == (long)st.st_size) {
+        return include;
+    }
+
+    include = generator_include_create(path, real_path, &st);
+
+    // Replaces and destroys the stale entry of a file changed on disk
+    hashmap_put_custom(includes->files, real_path, include,
+                       generator_include_destroy);
+
+    return include;
+}
+
+/**
+ *
+ * @function generator_includes_dependencies
+ * @brief Write the included files as a make rule, for build systems
+ * @params {generator_includes_t*} includes - Include cache
+ * @params {const char*} target - Target of the rule
+ * @returns {string_t*}
+ *
+ */
+string_t *generator_includes_dependencies(generator_includes_t *includes,
+                                          const char *target) {
+    DEBUG_ME;
+    string_t *rule = string_create(256);
+
+    string_append_str(rule, target);
+    string_append_char(rule, ':');
+
+    for (size_t i = 0; i < includes->dependencies->length; i++) {
+        const char *path = array_get(includes->dependencies, i);
+
+        string_append_str(rule, " \\\n ");
+
+        // make splits prerequisites on spaces
+        for (const char *c = path; *c != '\0'; c++) {
+            if (*c == ' ') {
+                string_append_char(rule, '\\');
+            }
+
+            string_append_char(rule, *c);
+        }
+    }
+
+    string_append_char(rule, '\n');
+
+    return rule;
+}
+
+/**
+ *
+ * @function generator_include_create
+ * @brief Parse and validate an included file, or load it if it is a
+ * precompiled AST
+ * @params {const char*} path - Path of the file, as written in the layout
+ * @params {const char*} real_path - Canonical path of the file, interned
+ * @params {struct stat*} st - Status of the file
+ * @returns {generator_include_t*}
+ *
+ */
+generator_include_t *generator_include_create(const char *path,
+                                              const char *real_path,
+                                              struct stat *st) {
+    DEBUG_ME;
+    generator_include_t *include = memory_allocate(sizeof(generator_include_t));
+
+    include->path = real_path;
+    include->modified = st->st_mtime;
+    include->size = (long)st->st_size;
+
+    include->content = file_map(real_path);
+    include->lexer = NULL;
+    include->arena = NULL;
+
+    include->active = false;
+
+    // A precompiled AST is loaded as is, without lexing and parsing it
+    if (ast_binary_is_path(path)) {
+        include->arena = salam_arena_create(0);
+        include->ast = ast_binary_load(include->arena, path,
+                                       include->content->data,
+                                       include->content->size);
+    } else {
+        include->lexer = lexer_create(path, include->content->data,
+                                      include->content->size);
+        include->ast = parser_parse(include->lexer);
+    }
+
+    if (include->ast->layout == NULL) {
+        error_generator(1, "Include file '%s' does not have a layout block",
+                        path);
+    }
+
+    return include;
+}
+
+/**
+ *
+ * @function generator_include_destroy
+ * @brief Destroy an included file and its AST
+ * @params {void*} value - Included file (generator_include_t*)
+ * @returns {void}
+ *
+ */
+void generator_include_destroy(void *value) {
+    DEBUG_ME;
+    generator_include_t *include = value;
+
+    if (include != NULL) {
+        ast_destroy(include->ast);
+        lexer_destroy(include->lexer);
+        salam_arena_destroy(include->arena);
+        file_unmap(include->content);
+
+        memory_destroy(include);
+    }
+}
@@ -0,0 +1,110 @@
+#ifndef _GENERATOR_INCLUDE_H_
+#define _GENERATOR_INCLUDE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "array.h"
+#include "ast.h"
+#include "ast_binary.h"
+#include "base.h"
+#include "file.h"
+#include "hashmap.h"
+#include "intern.h"
+#include "lexer.h"
+#include "memory.h"
+#include "parser.h"
+#include "string_buffer.h"
+
+// A file included by a layout, parsed and validated once however many times
+// it is included
+typedef struct generator_include_t {
+    const char *path;  // canonical path, interned
+    time_t modified;
+    long size;
+
+    file_map_t *content;
+    lexer_t *lexer;  // owns the AST, NULL for a precompiled AST
+    salam_arena_t *arena;  // owns the AST of a precompiled AST
+    ast_t *ast;
+
+    bool active;  // true while its layout is generated, to catch cycles
+} generator_include_t;
+
+typedef struct generator_includes_t {
+    hashmap_t *files;  // generator_include_t by canonical path
+    array_t *dependencies;  // canonical paths, in the order first included
+} generator_includes_t;
+
+/**
+ *
+ * @function generator_includes_create
+ * @brief Create an empty include cache
+ * @returns {generator_includes_t*}
+ *
+ */
+generator_includes_t *generator_includes_create(void);
+
+/**
+ *
+ * @function generator_includes_destroy
+ * @brief Destroy an include cache and every file in it
+ * @params {generator_includes_t*} includes - Include cache
+ * @returns {void}
+ *
+ */
+void generator_includes_destroy(generator_includes_t *includes);
+
+/**
+ *
+ * @function generator_includes_get
+ * @brief Get an included file, parsing it on first use or when it changed on
+ * disk since (by modification time and size)
+ * @params {generator_includes_t*} includes - Include cache
+ * @params {const char*} path - Path of the file, as written in the layout
+ * @returns {generator_include_t*}
+ *
+ */
+generator_include_t *generator_includes_get(generator_includes_t *includes,
+                                            const char *path);
+
+/**
+ *
+ * @function generator_includes_dependencies
+ * @brief Write the included files as a make rule, for build systems
+ * @params {generator_includes_t*} includes - Include cache
+ * @params {const char*} target - Target of the rule
+ * @returns {string_t*}
+ *
+ */
+string_t *generator_includes_dependencies(generator_includes_t *includes,
+                                          const char *target);
+
+/**
+ *
+ * @function generator_include_create
+ * @brief Parse and validate an included file, or load it if it is a
+ * precompiled AST
+ * @params {const char*} path - Path of the file, as written in the layout
+ * @params {const char*} real_path - Canonical path of the file, interned
+ * @params {struct stat*} st - Status of the file
+ * @returns {generator_include_t*}
+ *
+ */
+generator_include_t *generator_include_create(const char *path,
+                                              const char *real_path,
+                                              struct stat *st);
+
+/**
+ *
+ * @function generator_include_destroy
+ * @brief Destroy an included file and its AST
+ * @params {void*} value - Included file (generator_include_t*)
+ * @returns {void}
+ *
+ */
+void generator_include_destroy(void *value);
+
+#endif
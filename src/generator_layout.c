@@ -6,20 +6,46 @@
  * @brief Generate the HTML code for the layout block item
  * @params {generator_t*} generator - Generator
  * @params {ast_layout_node_t*} node - Node
- * @returns {string_t*}
+ * @params {string_t*} html - Output the HTML code is appended to
+ * @returns {void}
  *
  */
-string_t *generator_code_layout_block_item(generator_t *generator,
-                                           ast_layout_node_t *node) {
-    string_t *layout_block_str = string_create(1024);
-    string_t *node_attrs_str =
-        generator_code_layout_attributes(generator, node->block);
+void generator_code_layout_block_item(generator_t *generator,
+                                      ast_layout_node_t *node, string_t *html) {
+    size_t start = html->length;
     char *node_name = generator_code_layout_node_type(node->type);
 
-    hashmap_t *attributes = node->block->attributes;
+    string_append_char(html, '<');
+    string_append_str(html, node_name);
+
+    // Written in place and cut again if the node has no attributes
+    size_t attributes_start = html->length;
+
+    string_append_char(html, ' ');
+    generator_code_layout_attributes(generator, node->block, html);
+
+    if (node->type == AST_LAYOUT_TYPE_INPUT &&
+        node->block->text_content != NULL) {
+        if (generator->minify == false ||
+            html->data[html->length - 1] != ' ') {
+            string_append_char(html, ' ');
+        }
+
+        string_append_str(html, "value=");
+        generator_code_layout_attribute_value(
+            generator, html, node->block->text_content,
+            true);  // TODO: we need to bypass inner \"
+    }
+
+    if (html->length == attributes_start + 1) {
+        string_truncate(html, attributes_start);
+    }
+
+    enum_map_layout_attribute_t *attributes = node->block->attributes;
 
     size_t repeat_value_sizet = 1;
-    ast_layout_attribute_t *repeat = hashmap_get(attributes, "repeat");
+    ast_layout_attribute_t *repeat =
+        enum_map_get(attributes, AST_LAYOUT_ATTRIBUTE_TYPE_REPEAT);
     ast_value_t *repeat_value = NULL;
 
     if (repeat != NULL && repeat->values->length > 1) {
@@ -27,14 +53,18 @@ string_t *generator_code_layout_block_item(generator_t *generator,
     } else if (repeat != NULL && repeat->values->length == 1) {
         repeat_value = array_get(repeat->values, 0);
 
-        if (repeat_value->type->kind == AST_TYPE_KIND_STRING) {
-            if (string_is_integer(repeat_value->data.string_value) == false) {
+        if (repeat_value->type.kind == AST_TYPE_KIND_STRING) {
+            number_scan_t scan;
+
+            if (!number_scan_string(repeat_value->data.string_value,
+                                    NUMBER_SCAN_SIGN, &scan) ||
+                scan.kind != NUMBER_KIND_INTEGER) {
                 error_generator(
                     1, "The 'repeat' attribute must be an integer value");
             } else {
-                repeat_value_sizet = atoi(repeat_value->data.string_value);
+                repeat_value_sizet = scan.integer;
             }
-        } else if (repeat_value->type->kind == AST_TYPE_KIND_INT) {
+        } else if (repeat_value->type.kind == AST_TYPE_KIND_INT) {
             repeat_value_sizet = repeat_value->data.int_value;
         } else {
             error_generator(1,
@@ -45,13 +75,18 @@ string_t *generator_code_layout_block_item(generator_t *generator,
     if (repeat_value_sizet < 1) {
         error_generator(1,
                         "The 'repeat' attribute value must be greater than 0");
-    } else if (repeat_value_sizet > 1000) {
+    } else if (repeat_value_sizet > generator->repeat_limit) {
         error_generator(
-            1, "The 'repeat' attribute value must be less or equal to 1000");
+            1, "The 'repeat' attribute value must be less or equal to %zu",
+            generator->repeat_limit);
     }
 
     if (node->type == AST_LAYOUT_TYPE_INCLUDE) {
-        ast_layout_attribute_t *src = hashmap_get(attributes, "src");
+        // An include has no tag of its own, only the CSS of its attributes
+        string_truncate(html, start);
+
+        ast_layout_attribute_t *src =
+            enum_map_get(attributes, AST_LAYOUT_ATTRIBUTE_TYPE_SRC);
         ast_value_t *src_value = NULL;
 
         if (src == NULL) {
@@ -62,7 +97,7 @@ string_t *generator_code_layout_block_item(generator_t *generator,
         }
 
         src_value = array_get(src->values, 0);
-        if (src_value->type->kind != AST_TYPE_KIND_STRING) {
+        if (src_value->type.kind != AST_TYPE_KIND_STRING) {
             error_generator(1, "Include node 'src' attribute must be a string");
         }
 
@@ -72,119 +107,62 @@ string_t *generator_code_layout_block_item(generator_t *generator,
             error_generator(1, "Include file '%s' does not exist", path);
         }
 
-        size_t size = 0;
-        char *content = file_reads_binary(path, &size);
-        lexer_t *lexer = lexer_create(path, content);
-        lexer_lex(lexer);
-
-        // lexer_save(lexer, "include-tokens.txt");
+        generator_include_t *include =
+            generator_includes_get(generator->includes, path);
+        ast_layout_block_t *block = include->ast->layout->block;
 
-        ast_t *ast = parser_parse(lexer);
+        include->active = true;
 
-        if (ast->layout == NULL) {
-            error_generator(1, "Include file '%s' does not have a layout block",
-                            path);
+        if (block->text_content != NULL) {
+            string_append_str(html, block->text_content);
         }
-        // else if (ast->layout->block->children->length == 0)
-        // {
-        // 	error_generator(1, "Include file '%s' layout block does not have
-        // any children", path);
-        // }
-        else {
-            for (size_t i = 1; i <= repeat_value_sizet; i++) {
-                if (ast->layout->block->text_content != NULL) {
-                    string_append_str(layout_block_str,
-                                      ast->layout->block->text_content);
-                }
 
-                string_t *block_code = generator_code_layout_block(
-                    generator, ast->layout->block->children);
+        generator_code_layout_block(generator, block->children, html);
 
-                string_append(layout_block_str, block_code);
+        include->active = false;
+    } else {
+        string_append_char(html, '>');
 
-                string_destroy(block_code);
-            }
-        }
+        if (node->block->children->length > 0 ||
+            (node->block->text_content != NULL &&
+             node->type != AST_LAYOUT_TYPE_INPUT)) {
+            bool has_content = false;
 
-        ast_destroy(ast);
-        lexer_destroy(lexer);
-        memory_destroy(content);
-    } else {
-        for (size_t i = 1; i <= repeat_value_sizet; i++) {
-            string_append_char(layout_block_str, '<');
-            string_append_str(layout_block_str, node_name);
-
-            if (node->type == AST_LAYOUT_TYPE_INPUT &&
-                node->block->text_content != NULL) {
-                string_append_str(node_attrs_str, " value=\"");
-                string_append_str(
-                    node_attrs_str,
-                    node->block
-                        ->text_content);  // TODO: we need to bypass inner \"
-                string_append_str(node_attrs_str, "\"");
-            }
+            if (node->block->text_content != NULL) {
+                if (node->block->children->length == 0 &&
+                    strchr(node->block->text_content, '\n') == NULL) {
+                    string_append_str(html, node->block->text_content);
+                } else {
+                    generator_code_newline(generator, html);
+                    string_append_str(html, node->block->text_content);
+                    generator_code_newline(generator, html);
 
-            if (node_attrs_str->length > 0) {
-                string_append_char(layout_block_str, ' ');
-                string_append(layout_block_str, node_attrs_str);
+                    has_content = true;
+                }
             }
 
-            string_append_str(layout_block_str, ">");
-
-            if (node->block->children->length > 0 ||
-                (node->block->text_content != NULL &&
-                 node->type != AST_LAYOUT_TYPE_INPUT)) {
-                bool has_content = false;
-
-                if (node->block->text_content != NULL) {
-                    if (node->block->children->length == 0 &&
-                        strchr(node->block->text_content, '\n') == NULL) {
-                        string_append_str(layout_block_str,
-                                          node->block->text_content);
-                    } else {
-                        string_append_char(layout_block_str, '\n');
-                        string_append_str(layout_block_str,
-                                          node->block->text_content);
-                        string_append_char(layout_block_str, '\n');
-
-                        has_content = true;
-                    }
+            if (node->block->children->length > 0) {
+                if (has_content == false) {
+                    generator_code_newline(generator, html);
                 }
 
-                if (node->block->children->length > 0) {
-                    string_t *layout_block_children =
-                        generator_code_layout_block(generator,
-                                                    node->block->children);
-
-                    if (has_content == false) {
-                        string_append_char(layout_block_str, '\n');
-                    }
-
-                    if (layout_block_children->length > 0) {
-                        string_append(layout_block_str, layout_block_children);
-                    }
-
-                    if (layout_block_children != NULL) {
-                        layout_block_children->destroy(layout_block_children);
-                    }
-                }
+                generator_code_layout_block(generator, node->block->children,
+                                            html);
             }
+        }
 
-            if (is_layout_node_a_single_tag(node->type) == false) {
-                string_append_str(layout_block_str, "</");
-                string_append_str(layout_block_str, node_name);
-                string_append_str(layout_block_str, ">\n");
-            } else {
-                string_append_char(layout_block_str, '\n');
-            }
+        if (is_layout_node_a_single_tag(node->type) == false) {
+            string_append_str(html, "</");
+            string_append_str(html, node_name);
+            string_append_char(html, '>');
         }
-    }
 
-    if (node_attrs_str != NULL) {
-        node_attrs_str->destroy(node_attrs_str);
+        generator_code_newline(generator, html);
     }
 
-    return layout_block_str;
+    // Every copy is the same, so the node is generated once and its output
+    // is copied by doubling instead of generating the subtree again
+    string_repeat(html, start, repeat_value_sizet);
 }
 
 /**
@@ -193,24 +171,17 @@ string_t *generator_code_layout_block_item(generator_t *generator,
  * @brief Generate the HTML code for the layout block
  * @params {generator_t*} generator - Generator
  * @params {array_t*} children - Children
- * @returns {string_t*}
+ * @params {string_t*} html - Output the HTML code is appended to
+ * @returns {void}
  *
  */
-string_t *generator_code_layout_block(generator_t *generator,
-                                      array_t *children) {
+void generator_code_layout_block(generator_t *generator, array_t *children,
+                                 string_t *html) {
     DEBUG_ME;
-    string_t *html = string_create(1024);
-
     for (size_t i = 0; i < children->length; i++) {
-        ast_layout_node_t *node = array_get(children, i);
-        string_t *node_html = generator_code_layout_block_item(generator, node);
-
-        string_append(html, node_html);
-
-        string_destroy(node_html);
+        generator_code_layout_block_item(generator, array_get(children, i),
+                                         html);
     }
-
-    return html;
 }
 
 /**
@@ -218,7 +189,7 @@ string_t *generator_code_layout_block(generator_t *generator,
  * @function generator_code_layout_body
  * @params {generator_t*} generator - Generator
  * @params {ast_layout_block_t*} layout_block - Layout block
- * @params {string_t*} body - Body
+ * @params {string_t*} body - Output the body is appended to
  * @returns {void}
  *
  */
@@ -230,61 +201,55 @@ void generator_code_layout_body(generator_t *generator,
         validate_layout_mainbody(layout_block);
     }
 
-    string_t *body_tag = string_create(1024);
-    string_t *body_content = string_create(1024);
+    string_append_str(body, "<body");
+
+    size_t attributes_start = body->length;
 
-    string_append_str(body_tag, "<body");
-    string_t *body_attrs =
-        generator_code_layout_attributes(generator, layout_block);
-    if (body_attrs->length > 0) {
-        string_append_char(body_tag, ' ');
+    string_append_char(body, ' ');
+    generator_code_layout_attributes(generator, layout_block, body);
+
+    if (body->length == attributes_start + 1) {
+        string_truncate(body, attributes_start);
     }
-    string_append(body_tag, body_attrs);
-    body_attrs->destroy(body_attrs);
-    string_append_str(body_tag, ">");
+
+    string_append_str(body, ">");
 
     char *body_text_content = layout_block->text_content;
-    size_t body_text_content_length =
-        body_text_content != NULL ? strlen(body_text_content) : 0;
 
-    string_t *body_child =
-        generator_code_layout_block(generator, layout_block->children);
-    if (body_child->length > 0 || body_text_content_length > 0) {
-        string_append_char(body_tag, '\n');
-    }
+    // The new lines around the text content are only kept if the children
+    // generate anything, which is only known after
+    size_t content_start = body->length;
 
-    // text content
-    if (body_text_content != NULL && body_text_content_length > 0) {
-        string_append_str(body_content, body_text_content);
-    }
+    generator_code_newline(generator, body);
 
-    // node content
-    if (body_child->length > 0 && body_text_content != NULL &&
-        body_text_content_length > 0) {
-        string_append_char(body_content, '\n');
-    }
-    if (body_child->length > 0) {
-        string_append(body_content, body_child);
+    if (body_text_content != NULL && body_text_content[0] != '\0') {
+        string_append_str(body, body_text_content);
+
+        content_start = body->length;
+
+        generator_code_newline(generator, body);
     }
 
-    if (body_child != NULL) body_child->destroy(body_child);
+    size_t children_start = body->length;
 
-    string_append(body_tag, body_content);
+    generator_code_layout_block(generator, layout_block->children, body);
 
-    string_set(body, body_tag);
-    body_tag->destroy(body_tag);
-    body_content->destroy(body_content);
+    if (body->length == children_start) {
+        string_truncate(body, content_start);
+    }
 }
 
 /**
  *
  * @function generator_code_head_item
+ * @params {generator_t*} generator - Generator
  * @params {ast_layout_attribute_t*} attribute - Attribute
  * @params {string_t*} head - Head
  * @returns {void}
  *
  */
-void generator_code_head_item(ast_layout_attribute_t *attribute,
+void generator_code_head_item(generator_t *generator,
+                              ast_layout_attribute_t *attribute,
                               string_t *head) {
     DEBUG_ME;
     if (head == NULL) {
@@ -300,61 +265,76 @@ void generator_code_head_item(ast_layout_attribute_t *attribute,
             string_append_str(head, "<title>");
             string_append_str(head, value);
             string_append_str(head, "</title>");
-            string_append_char(head, '\n');
+            generator_code_newline(generator, head);
             break;
 
         case AST_LAYOUT_ATTRIBUTE_TYPE_AUTHOR:
             value = array_value_stringify(attribute->values, ", ");
 
-            string_append_str(head, "<meta name=\"author\" content=\"");
-            string_append_str(head, value);
-            string_append_str(head, "\">");
-            string_append_char(head, '\n');
+            string_append_str(head, "<meta name=");
+            generator_code_layout_attribute_value(generator, head, "author",
+                                                  true);
+            string_append_str(head, " content=");
+            generator_code_layout_attribute_value(generator, head, value, true);
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
             break;
 
         case AST_LAYOUT_ATTRIBUTE_TYPE_DESCRIPTION:
             value = array_value_stringify(attribute->values, ", ");
 
-            string_append_str(head, "<meta name=\"description\" content=\"");
-            string_append_str(head, value);
-            string_append_str(head, "\">");
-            string_append_char(head, '\n');
+            string_append_str(head, "<meta name=");
+            generator_code_layout_attribute_value(generator, head,
+                                                  "description", true);
+            string_append_str(head, " content=");
+            generator_code_layout_attribute_value(generator, head, value, true);
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
             break;
 
         case AST_LAYOUT_ATTRIBUTE_TYPE_KEYWORDS:
             value = array_value_stringify(attribute->values, ", ");
 
-            string_append_str(head, "<meta name=\"keywords\" content=\"");
-            string_append_str(head, value);
-            string_append_str(head, "\">");
-            string_append_char(head, '\n');
+            string_append_str(head, "<meta name=");
+            generator_code_layout_attribute_value(generator, head, "keywords",
+                                                  true);
+            string_append_str(head, " content=");
+            generator_code_layout_attribute_value(generator, head, value, true);
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
             break;
 
         case AST_LAYOUT_ATTRIBUTE_TYPE_CHARSET:
             value = array_value_stringify(attribute->values, ", ");
 
-            string_append_str(head, "<meta charset=\"");
-            string_append_str(head, value);
-            string_append_str(head, "\">");
-            string_append_char(head, '\n');
+            string_append_str(head, "<meta charset=");
+            generator_code_layout_attribute_value(generator, head, value, true);
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
             break;
 
         case AST_LAYOUT_ATTRIBUTE_TYPE_VIEWPORT:
             value = array_value_stringify(attribute->values, ", ");
 
-            string_append_str(head, "<meta name=\"viewport\" content=\"");
-            string_append_str(head, value);
-            string_append_str(head, "\">");
-            string_append_char(head, '\n');
+            string_append_str(head, "<meta name=");
+            generator_code_layout_attribute_value(generator, head, "viewport",
+                                                  true);
+            string_append_str(head, " content=");
+            generator_code_layout_attribute_value(generator, head, value, true);
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
             break;
 
         case AST_LAYOUT_ATTRIBUTE_TYPE_REFRESH:
             value = array_value_stringify(attribute->values, ", ");
 
-            string_append_str(head, "<meta http-equiv=\"refresh\" content=\"");
-            string_append_str(head, value);
-            string_append_str(head, "\">");
-            string_append_char(head, '\n');
+            string_append_str(head, "<meta http-equiv=");
+            generator_code_layout_attribute_value(generator, head, "refresh",
+                                                  true);
+            string_append_str(head, " content=");
+            generator_code_layout_attribute_value(generator, head, value, true);
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
             break;
 
         default:
@@ -394,45 +374,35 @@ void generator_code_head_meta_children(generator_t *generator,
 
             if (node->type == AST_LAYOUT_TYPE_FONT) {
                 string_append_str(generator->css, "@font-face{");
-                hashmap_t *attributes =
-                    cast(hashmap_t *, node_block->attributes);
+                enum_map_layout_attribute_t *attributes =
+                    node_block->attributes;
 
                 size_t attributes_length = attributes->length;
-                size_t attributes_append_length = 0;
-
-                size_t attributes_capacity = attributes->capacity;
 
-                for (size_t i = 0; i < attributes_capacity; i++) {
-                    hashmap_entry_t *entry = attributes->data[i];
+                for (size_t i = 0; i < attributes_length; i++) {
+                    ast_layout_attribute_t *attribute = attributes->data[i];
 
-                    while (entry) {
-                        ast_layout_attribute_t *attribute =
-                            cast(ast_layout_attribute_t *, entry->value);
-
-                        if (attribute->final_key == NULL) {
-                            attribute->final_key = string_strdup(entry->key);
-                        }
-
-                        string_append_str(
-                            generator->css,
-                            attribute->final_key);  // TODO: Why name lowercase
-                                                    // entry->key?
-                        string_append_char(generator->css, ':');
-
-                        if (attribute->final_value == NULL) {
-                            attribute->final_value =
-                                array_value_stringify(attribute->values, ", ");
-                        }
+                    if (attribute->final_key == NULL) {
+                        ast_layout_attribute_set_final_key(
+                            attribute,
+                            ast_layout_attribute_type_to_name(attribute->type));
+                    }
 
-                        string_append_str(generator->css,
-                                          attribute->final_value);
+                    string_append_str(
+                        generator->css,
+                        attribute->final_key);  // TODO: Why name lowercase
+                                                // entry->key?
+                    string_append_char(generator->css, ':');
+
+                    if (attribute->final_value == NULL) {
+                        attribute->final_value = array_value_stringify_arena(
+                            attribute->arena, attribute->values, ", ");
+                    }
 
-                        if (attributes_append_length != attributes_length - 1) {
-                            string_append_char(generator->css, ';');
-                        }
+                    string_append_str(generator->css, attribute->final_value);
 
-                        entry = cast(hashmap_entry_t *, entry->next);
-                        attributes_append_length++;
+                    if (i != attributes_length - 1) {
+                        string_append_char(generator->css, ';');
                     }
                 }
 
@@ -464,25 +434,17 @@ void generator_code_head(generator_t *generator, ast_layout_block_t *block,
     // size_t html_tags_length = 0;
 
     if (block->attributes != NULL) {
-        hashmap_t *attributes = cast(hashmap_t *, block->attributes);
-        size_t attribute_capacity = attributes->capacity;
-
-        for (size_t i = 0; i < attribute_capacity; i++) {
-            hashmap_entry_t *entry = attributes->data[i];
+        enum_map_layout_attribute_t *attributes = block->attributes;
+        size_t attributes_length = attributes->length;
 
-            while (entry) {
-                ast_layout_attribute_t *attribute =
-                    cast(ast_layout_attribute_t *, entry->value);
+        for (size_t i = 0; i < attributes_length; i++) {
+            ast_layout_attribute_t *attribute = attributes->data[i];
 
-                if (attribute->isStyle == true ||
-                    attribute->isContent == true) {
-                } else {
-                    generator_code_head_item(attribute, head);
-
-                    // html_tags_length++;
-                }
+            if (attribute->isStyle == true || attribute->isContent == true) {
+            } else {
+                generator_code_head_item(generator, attribute, head);
 
-                entry = cast(hashmap_entry_t *, entry->next);
+                // html_tags_length++;
             }
         }
     }
@@ -495,7 +457,8 @@ void generator_code_head(generator_t *generator, ast_layout_block_t *block,
 /**
  *
  * @function generator_code_layout
- * @brief Generate code for AST layout
+ * @brief Generate code for AST layout, the body into generator->html and then
+ * the document before it into generator->head, see generator_write_html
  * @params {generator_t*} generator - Generator
  * @returns {void}
  *
@@ -504,74 +467,87 @@ void generator_code_layout(generator_t *generator) {
     DEBUG_ME;
     if (generator->ast->layout != NULL) {
         if (generator->ast->layout->block != NULL) {
-            string_t *head = string_create(1024);
-            string_t *body = string_create(1024);
-            string_t *html = string_create(1024);
+            string_t *head = generator->head;
+            string_t *html = generator->html;
 
-            // Process the layout block
+            // Process the layout block, this generates the CSS which decides
+            // the head, so the head is generated after it
             generator_code_layout_body(generator, generator->ast->layout->block,
-                                       body);
+                                       html);
 
-            // Process the head block
-            generator_code_head(generator, generator->ast->layout->block, head);
+            generator_code_layout_group_css(generator);
+            generator_code_layout_media_css(generator);
+
+            if (generator->js != NULL && generator->js->length > 0) {
+                if (generator->inlineJS == true) {
+                    string_append_str(html, "<script>");
+                    generator_code_newline(generator, html);
+                    string_append(html, generator->js);
+                    string_append_str(html, "</script>");
+                } else {
+                    string_append_str(html, generator->minify
+                                                ? "<script src=script.js>"
+                                                : "<script src=\"script.js\">");
+                    string_append_str(html, "</script>");
+                }
+
+                generator_code_newline(generator, html);
+            }
 
-            // Generate the HTML code
-            string_append_str(html, "<!doctype html>\n");
-            string_append_str(html, "<html");
+            string_append_str(html, "</body>");
+            generator_code_newline(generator, html);
+            string_append_str(html, "</html>");
+
+            // Generate the HTML code before the body
+            string_append_str(head, "<!doctype html>");
+            generator_code_newline(generator, head);
+            string_append_str(head, "<html");
 
-            generator_code_layout_html(generator->ast->layout->block, html);
+            generator_code_layout_html(generator, generator->ast->layout->block,
+                                       head);
 
-            string_append_str(html, ">\n");
+            string_append_char(head, '>');
+            generator_code_newline(generator, head);
 
-            string_append_str(html, "<head>\n");
-            string_append_str(html, "<meta charset=\"UTF-8\">\n");
+            string_append_str(head, "<head>");
+            generator_code_newline(generator, head);
+            string_append_str(head, generator->minify
+                                        ? "<meta charset=UTF-8>"
+                                        : "<meta charset=\"UTF-8\">");
+            generator_code_newline(generator, head);
 
-            string_append(html, head);
+            // Process the head block
+            generator_code_head(generator, generator->ast->layout->block, head);
 
             if ((generator->css != NULL && generator->css->length > 0) ||
                 (generator->media_css != NULL &&
                  generator->media_css->length > 0)) {
                 if (generator->inlineCSS == true) {
-                    string_append_str(html, "<style>\n");
+                    string_append_str(head, "<style>");
+                    generator_code_newline(generator, head);
                     if (generator->css != NULL && generator->css->length > 0) {
-                        string_append(html, generator->css);
-                        string_append_char(html, '\n');
+                        string_append(head, generator->css);
+                        generator_code_newline(generator, head);
                     }
                     if (generator->media_css != NULL &&
                         generator->media_css->length > 0) {
-                        string_append(html, generator->media_css);
-                        string_append_char(html, '\n');
+                        string_append(head, generator->media_css);
+                        generator_code_newline(generator, head);
                     }
-                    string_append_str(html, "</style>\n");
+                    string_append_str(head, "</style>");
+                } else if (generator->minify == true) {
+                    string_append_str(head,
+                                      "<link rel=stylesheet href=style.css>");
                 } else {
                     string_append_str(
-                        html, "<link rel=\"stylesheet\" href=\"style.css\">\n");
+                        head, "<link rel=\"stylesheet\" href=\"style.css\">");
                 }
-            }
-
-            string_append_str(html, "</head>\n");
-
-            string_append(html, body);
 
-            if (generator->js != NULL && generator->js->length > 0) {
-                if (generator->inlineJS == true) {
-                    string_append_str(html, "<script>\n");
-                    string_append(html, generator->js);
-                    string_append_str(html, "</script>\n");
-                } else {
-                    string_append_str(html,
-                                      "<script src=\"script.js\"></script>\n");
-                }
+                generator_code_newline(generator, head);
             }
 
-            string_append_str(html, "</body>\n");
-            string_append_str(html, "</html>");
-
-            string_set(generator->html, html);
-
-            string_destroy(head);
-            string_destroy(body);
-            string_destroy(html);
+            string_append_str(head, "</head>");
+            generator_code_newline(generator, head);
         }
     }
 }
@@ -580,19 +556,21 @@ void generator_code_layout(generator_t *generator) {
  *
  * @function generator_code_layout_html
  * @brief Generate the HTML code for the layout block
+ * @params {generator_t*} generator - Generator
  * @params {ast_layout_block_t*} layout_block - Layout block
  * @params {string_t*} html - HTML string
  * @returns {void}
  *
  */
-void generator_code_layout_html(ast_layout_block_t *layout_block,
+void generator_code_layout_html(generator_t *generator,
+                                ast_layout_block_t *layout_block,
                                 string_t *html) {
     DEBUG_ME;
     // LANG
     ast_layout_attribute_t *html_lang =
-        hashmap_get(cast(hashmap_t *, layout_block->attributes), "lang");
+        enum_map_get(layout_block->attributes, AST_LAYOUT_ATTRIBUTE_TYPE_LANG);
     char *html_lang_value = NULL;
-    string_append_str(html, " lang=\"");
+    string_append_str(html, generator->minify ? " lang=" : " lang=\"");
     if (html_lang != NULL) {
         char *values = array_value_stringify(html_lang->values, ", ");
         html_lang_value = string_lower_str(values);
@@ -618,13 +596,15 @@ void generator_code_layout_html(ast_layout_block_t *layout_block,
 
         error_generator(2, "Invalid value for lang attribute in layout block!");
     }
-    string_append_str(html, "\"");
+    if (generator->minify == false) {
+        string_append_char(html, '\"');
+    }
 
     // DIR
     ast_layout_attribute_t *html_dir =
-        hashmap_get(cast(hashmap_t *, layout_block->attributes), "dir");
+        enum_map_get(layout_block->attributes, AST_LAYOUT_ATTRIBUTE_TYPE_DIR);
     char *html_dir_value = NULL;
-    string_append_str(html, " dir=\"");
+    string_append_str(html, generator->minify ? " dir=" : " dir=\"");
     if (html_dir != NULL) {
         char *values = array_value_stringify(html_dir->values, ", ");
         html_dir_value = string_lower_str(values);
@@ -649,7 +629,9 @@ void generator_code_layout_html(ast_layout_block_t *layout_block,
 
         error_generator(2, "Invalid value for dir attribute in layout block!");
     }
-    string_append_str(html, "\"");
+    if (generator->minify == false) {
+        string_append_char(html, '\"');
+    }
 
     if (html_lang_value != NULL) {
         memory_destroy(html_lang_value);
@@ -665,75 +647,66 @@ void generator_code_layout_html(ast_layout_block_t *layout_block,
  * @brief Generate the HTML code for the layout block attributes
  * @params {generator_t} generator - Generator
  * @params {ast_layout_block_t*} block - Layout block
- * @returns {string_t*}
+ * @params {string_t*} html - Output the HTML attributes are appended to
+ * @returns {void}
  *
  */
-string_t *generator_code_layout_attributes(generator_t *generator,
-                                           ast_layout_block_t *block) {
+void generator_code_layout_attributes(generator_t *generator,
+                                      ast_layout_block_t *block,
+                                      string_t *html) {
     DEBUG_ME;
+    size_t html_start = html->length;
     size_t html_attributes_length = 0;
     size_t css_attributes_length = 0;
 
-    string_t *html_attributes = string_create(1024);
     string_t *css_attributes = string_create(1024);
 
     if (block != NULL) {
         if (block->attributes != NULL) {
-            hashmap_t *attributes = cast(hashmap_t *, block->attributes);
-            size_t attributes_capacity = attributes->capacity;
-
-            for (size_t i = 0; i < attributes_capacity; i++) {
-                hashmap_entry_t *entry = attributes->data[i];
-
-                while (entry) {
-                    ast_layout_attribute_t *attribute =
-                        cast(ast_layout_attribute_t *, entry->value);
-                    if (attribute == NULL) {
-                        entry = cast(hashmap_entry_t *, entry->next);
-                        continue;
+            enum_map_layout_attribute_t *attributes = block->attributes;
+            size_t attributes_length = attributes->length;
+
+            for (size_t i = 0; i < attributes_length; i++) {
+                ast_layout_attribute_t *attribute = attributes->data[i];
+                if (attribute == NULL) {
+                    continue;
+                }
+
+                if (attribute->ignoreMe == true ||
+                    attribute->isContent == true ||
+                    attribute->isStyle == true) {
+                } else {
+                    if (attribute->final_value == NULL) {
+                        attribute->final_value = array_value_stringify_arena(
+                            attribute->arena, attribute->values, ", ");
+                    }
+
+                    size_t attribute_value_length =
+                        attribute->final_value == NULL
+                            ? 0
+                            : strlen(attribute->final_value);
+
+                    if (html_attributes_length != 0) {
+                        string_append_char(html, ' ');
                     }
 
-                    if (attribute->ignoreMe == true ||
-                        attribute->isContent == true ||
-                        attribute->isStyle == true) {
-                    } else {
-                        if (attribute->final_value == NULL) {
-                            attribute->final_value =
-                                array_value_stringify(attribute->values, ", ");
-                        }
-
-                        size_t attribute_value_length =
-                            attribute->final_value == NULL
-                                ? 0
-                                : strlen(attribute->final_value);
-
-                        if (html_attributes_length != 0) {
-                            string_append_char(html_attributes, ' ');
-                        }
-
-                        if (attribute->final_key == NULL) {
-                            attribute->final_key = string_strdup(entry->key);
-                        }
-
-                        string_append_str(
-                            html_attributes,
-                            attribute->final_key);  // TODO: Why name lowercase
-                                                    // entry->key?
-                        string_append_str(html_attributes, "=");
-
-                        if (attribute_value_length > 1) {
-                            string_append_str(html_attributes, "\"");
-                        }
-                        string_append_str(html_attributes,
-                                          attribute->final_value);
-                        if (attribute_value_length > 1) {
-                            string_append_str(html_attributes, "\"");
-                        }
-
-                        html_attributes_length++;
+                    if (attribute->final_key == NULL) {
+                        ast_layout_attribute_set_final_key(
+                            attribute,
+                            ast_layout_attribute_type_to_name(attribute->type));
                     }
 
-                    entry = cast(hashmap_entry_t *, entry->next);
+                    string_append_str(
+                        html,
+                        attribute->final_key);  // TODO: Why name lowercase
+                                                // entry->key?
+                    string_append_str(html, "=");
+
+                    generator_code_layout_attribute_value(
+                        generator, html, attribute->final_value,
+                        attribute_value_length > 1);
+
+                    html_attributes_length++;
                 }
             }
         }
@@ -744,56 +717,552 @@ string_t *generator_code_layout_attributes(generator_t *generator,
         string_destroy(this_style);
 
         // New styles
-        size_t styles_new_capacity = block->styles->new->capacity;
+        size_t styles_new_length = block->styles->new->length;
 
-        for (size_t i = 0; i < styles_new_capacity; i++) {
-            hashmap_entry_t *entry = block->styles->new->data[i];
-
-            while (entry) {
-                ast_layout_attribute_t *attribute =
-                    cast(ast_layout_attribute_t *, entry->value);
-                if (attribute == NULL) {
-                } else if (attribute->isStyle == false ||
-                           attribute->ignoreMe == true) {
-                } else {
-                    if (css_attributes_length != 0) {
-                        string_append_char(css_attributes, ';');
-                    }
-                    string_append_str(css_attributes, attribute->final_key);
-                    string_append_str(css_attributes, ":");
-                    string_append_str(css_attributes, attribute->final_value);
-
-                    css_attributes_length++;
+        for (size_t i = 0; i < styles_new_length; i++) {
+            ast_layout_attribute_t *attribute = block->styles->new->data[i];
+            if (attribute == NULL) {
+            } else if (attribute->isStyle == false ||
+                       attribute->ignoreMe == true) {
+            } else {
+                if (css_attributes_length != 0) {
+                    string_append_char(css_attributes, ';');
                 }
+                string_append_str(css_attributes, attribute->final_key);
+                string_append_str(css_attributes, ":");
+                string_append_str(css_attributes, attribute->final_value);
 
-                entry = cast(hashmap_entry_t *, entry->next);
+                css_attributes_length++;
             }
         }
     }
 
     bool has_substate = false;
 
-    if (hashmap_has_any_sub_value_layout_attribute_style_state(block->states) ==
-        true) {
+    if (enum_map_layout_style_state_has_any_sub_value(block->states) == true) {
         has_substate = true;
     }
 
-    bool first_load = true;
+    size_t media_queries_length = 0;
 
-    if (block->tag != NULL) {
-        first_load = false;
+    for (size_t i = 0; i < block->meta_children->length; i++) {
+        ast_layout_node_t *node = block->meta_children->data[i];
+
+        if (node->type == AST_LAYOUT_TYPE_MEDIA) {
+            media_queries_length++;
+        }
     }
 
+    bool inline_style = generator->inlineCSS == true &&
+                        generator->atomicCSS == false &&
+                        media_queries_length == 0 && has_substate == false;
+
     if ((block->meta_children != NULL && block->meta_children->length > 0) ||
         block->styles->normal->length > 0 || block->styles->new->length > 0 ||
         has_substate == true) {
-        if (block->tag == NULL) {
-            block->tag = generator_identifier_get(
-                generator->identifier);  // We will free its memory in the
-                                         // block_layout_destroy function
+        // The classes of the atomic mode are written in the order they are
+        // first used, not in the order of the declarations of the block.
+        // Blocks with declarations which override each other get a class
+        if (block->tag == NULL && generator->atomicCSS == true &&
+            generator_code_layout_atomic_overlaps(block) == false) {
+            generator_code_layout_atomic(generator, block);
+        } else if (block->tag == NULL) {
+            generator_code_layout_rules(generator, block, css_attributes,
+                                        inline_style);
         }
     }
 
+    if (((media_queries_length > 0 || css_attributes_length > 0) &&
+         css_attributes->length > 0) ||
+        has_substate == true ||
+        (generator->atomicCSS == true && block->tag != NULL)) {
+        if (html_attributes_length > 0 && html->length > html_start) {
+            string_append_char(html, ' ');
+        }
+
+        if (css_attributes->length > 0 && inline_style == true) {
+            string_t *style = string_create(css_attributes->length + 1);
+
+            if (generator->minify == true) {
+                generator_minify_css(style, css_attributes->data);
+            } else {
+                string_append(style, css_attributes);
+            }
+
+            string_append_str(html, "style=");
+            generator_code_layout_attribute_value(generator, html, style->data,
+                                                  true);
+
+            string_destroy(style);
+
+            html_attributes_length++;
+        }
+
+        if (block->tag != NULL) {
+            // The space before the style is already there without a style
+            if (html_attributes_length > 0 &&
+                (generator->minify == false ||
+                 html->data[html->length - 1] != ' ')) {
+                string_append_char(html, ' ');
+            }
+
+            size_t tag_length = strlen(block->tag);
+
+            // string_append_str(html, "id=");
+            string_append_str(html, "class=");
+            generator_code_layout_attribute_value(generator, html, block->tag,
+                                                  tag_length > 1);
+            html_attributes_length++;
+        }
+    }
+
+    if (css_attributes != NULL) {
+        string_destroy(css_attributes);
+    }
+}
+
+/**
+ *
+ * @function generator_code_layout_attribute_value
+ * @brief Generate the HTML code for an attribute value, in the minify mode
+ * quoted only if it has to be
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} html - Output the value is appended to
+ * @params {const char*} value - Value
+ * @params {bool} quote - Whether the value is quoted outside the minify mode
+ * @returns {void}
+ *
+ */
+void generator_code_layout_attribute_value(generator_t *generator,
+                                           string_t *html, const char *value,
+                                           bool quote) {
+    DEBUG_ME;
+    if (generator->minify == true) {
+        quote = generator_minify_is_attribute_safe(value) == false;
+    }
+
+    if (quote == true) {
+        string_append_char(html, '\"');
+    }
+
+    string_append_str(html, value);
+
+    if (quote == true) {
+        string_append_char(html, '\"');
+    }
+}
+
+/**
+ *
+ * @function generator_code_layout_rules
+ * @brief Give the layout block a class and generate its CSS rules, states and
+ * media queries. Blocks styled the same share one class and one set of rules,
+ * unless they have global rules
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @params {string_t*} css_attributes - Declarations of the block
+ * @params {bool} inline_style - Whether the declarations are inlined instead
+ * @returns {void}
+ *
+ */
+void generator_code_layout_rules(generator_t *generator,
+                                 ast_layout_block_t *block,
+                                 string_t *css_attributes, bool inline_style) {
+    DEBUG_ME;
+    string_t *rules = string_create(1024);
+    string_t *media_rules = string_create(256);
+
+    // The rules are generated for a placeholder class first, so the rules of
+    // blocks styled the same are the same text
+    ast_layout_block_set_tag(block, GENERATOR_STYLE_TAG);
+
+    if (css_attributes->length > 0 && inline_style == false) {
+        string_append_char(rules, STYLE_STYLE_LINKING);
+        string_append_str(rules, block->tag);
+        string_append_char(rules, '{');
+        string_append(rules, css_attributes);
+        string_append_char(rules, '}');
+    }
+
+    string_t *states[GENERATOR_STYLE_STATES] = {NULL};
+
+    if (enum_map_layout_style_state_has_any_sub_value(block->states) == true) {
+        string_t *pseudo_elements =
+            generator_code_layout_pseudo_elements(generator, block, states);
+
+        if (pseudo_elements != NULL) {
+            string_append(rules, pseudo_elements);
+            string_destroy(pseudo_elements);
+        }
+    }
+
+    generator_code_layout_media(generator, block, media_rules);
+
+    string_t *signature = string_create(1024);
+
+    string_append(signature, css_attributes);
+    string_append_char(signature, '\n');
+    string_append(signature, rules);
+    string_append_char(signature, '\n');
+    string_append(signature, media_rules);
+
+    bool created = false;
+    const char *tag = generator_code_layout_class(
+        generator, signature,
+        states[AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_GLOBAL] == NULL, &created);
+
+    // The rules are kept by declarations and the media rules by media query,
+    // to group the same rules of different classes
+    if (created == true) {
+        if (css_attributes->length > 0 && inline_style == false) {
+            generator_code_layout_group(generator, GENERATOR_STYLE_STATE_NONE,
+                                        tag, css_attributes);
+        }
+
+        for (size_t i = 0; i < GENERATOR_STYLE_STATES; i++) {
+            if (states[i] != NULL) {
+                generator_code_layout_group(generator, i, tag, states[i]);
+            }
+        }
+
+        generator_code_layout_media_add(generator, block, tag);
+    }
+
+    for (size_t i = 0; i < GENERATOR_STYLE_STATES; i++) {
+        if (states[i] != NULL) {
+            string_destroy(states[i]);
+        }
+    }
+
+    ast_layout_block_set_tag(block, tag);
+
+    string_destroy(signature);
+    string_destroy(media_rules);
+    string_destroy(rules);
+}
+
+/**
+ *
+ * @function generator_code_layout_class
+ * @brief Get the class of some CSS rules by everything they are generated
+ * from, a new class the first time they are seen. The caller adds the rules
+ * of a new class
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} signature - Everything the rules are generated from
+ * @params {bool} share - Whether the class is shared by the same rules, a
+ * class with global rules is not: its rules must come after the global rules
+ * of the ancestors of its block
+ * @params {bool*} created - Set to whether the class is new
+ * @returns {const char*} - Class, owned by the generator
+ *
+ */
+const char *generator_code_layout_class(generator_t *generator,
+                                        string_t *signature, bool share,
+                                        bool *created) {
+    DEBUG_ME;
+    char *tag =
+        share == true ? hashmap_get(generator->styles, signature->data) : NULL;
+
+    *created = tag == NULL;
+
+    if (tag == NULL) {
+        tag = generator_identifier_get(generator->identifier);
+
+        // A class which is not shared is kept by its own name, which is never
+        // a signature
+        hashmap_put(generator->styles, share == true ? signature->data : tag,
+                    tag);
+    }
+
+    return tag;
+}
+
+/**
+ *
+ * @function generator_code_layout_atomic
+ * @brief Give the layout block one class per declaration, for the atomic CSS
+ * mode. Each declaration, by its state and media query, is generated once and
+ * its class is shared by every block that has it
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @returns {void}
+ *
+ */
+void generator_code_layout_atomic(generator_t *generator,
+                                  ast_layout_block_t *block) {
+    DEBUG_ME;
+    string_t *classes = string_create(256);
+
+    generator_code_layout_atomic_styles(generator, block, block->styles->normal,
+                                        GENERATOR_STYLE_STATE_NONE, NULL,
+                                        classes);
+    generator_code_layout_atomic_styles(generator, NULL, block->styles->new,
+                                        GENERATOR_STYLE_STATE_NONE, NULL,
+                                        classes);
+
+    for (size_t i = 0; i < block->states->length; i++) {
+        ast_layout_style_state_t *pseudo_element = block->states->data[i];
+        ast_layout_attribute_style_state_type type = block->states->keys[i];
+
+        if (pseudo_element->normal == NULL ||
+            type == AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR) {
+            continue;
+        }
+
+        generator_code_layout_atomic_styles(generator, block,
+                                            pseudo_element->normal, type, NULL,
+                                            classes);
+    }
+
+    string_t *media = string_create(128);
+
+    for (size_t i = 0; i < block->meta_children->length; i++) {
+        ast_layout_node_t *node = block->meta_children->data[i];
+
+        if (node->type != AST_LAYOUT_TYPE_MEDIA) {
+            continue;
+        }
+
+        string_truncate(media, 0);
+        generator_code_layout_media_query(generator, node->block, media);
+
+        generator_code_layout_atomic_styles(
+            generator, node->block, node->block->styles->normal,
+            GENERATOR_STYLE_STATE_NONE, media, classes);
+        generator_code_layout_atomic_styles(
+            generator, NULL, node->block->styles->new,
+            GENERATOR_STYLE_STATE_NONE, media, classes);
+    }
+
+    if (classes->length > 0) {
+        ast_layout_block_set_tag(block, classes->data);
+    }
+
+    string_destroy(media);
+    string_destroy(classes);
+}
+
+/**
+ *
+ * @function generator_code_layout_atomic_styles
+ * @brief Append the classes of some styles for the atomic CSS mode
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Block the styles are normalized
+ * against, or NULL if they are already (new styles)
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {ast_layout_attribute_style_state_type} state - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @params {string_t*} media - Media query, or NULL
+ * @params {string_t*} classes - Output the classes are appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_atomic_styles(
+    generator_t *generator, ast_layout_block_t *block,
+    enum_map_layout_attribute_t *styles,
+    ast_layout_attribute_style_state_type state, string_t *media,
+    string_t *classes) {
+    DEBUG_ME;
+    string_t *declaration = string_create(128);
+    string_t *signature = string_create(256);
+
+    for (size_t i = 0; i < styles->length; i++) {
+        ast_layout_attribute_t *attribute = styles->data[i];
+
+        if (attribute == NULL) {
+            continue;
+        }
+
+        if (block != NULL) {
+            generator_code_layout_style_value(block->styles->normal,
+                                              block->styles->new, attribute);
+        }
+
+        if (attribute->isStyle == false || attribute->ignoreMe == true) {
+            continue;
+        }
+
+        if (attribute->final_key == NULL) {
+            ast_layout_attribute_set_final_key(attribute, attribute->key);
+        }
+
+        if (attribute->final_value == NULL) {
+            attribute->final_value = array_value_stringify_arena(
+                attribute->arena, attribute->values, ", ");
+        }
+
+        string_truncate(declaration, 0);
+        string_append_str(declaration, attribute->final_key);
+        string_append_char(declaration, ':');
+        string_append_str(declaration, attribute->final_value);
+
+        // The rule for the placeholder class, in its media query, is the
+        // signature of the declaration
+        string_truncate(signature, 0);
+
+        if (media != NULL) {
+            string_append(signature, media);
+        }
+
+        generator_code_layout_selector(signature, GENERATOR_STYLE_TAG, state);
+        string_append_char(signature, '{');
+        string_append(signature, declaration);
+        string_append_char(signature, '}');
+
+        bool created = false;
+        const char *tag = generator_code_layout_class(
+            generator, signature,
+            state != AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_GLOBAL, &created);
+
+        if (created == true && media == NULL) {
+            generator_code_layout_group(generator, state, tag, declaration);
+        } else if (created == true) {
+            // Blocks with declarations of the same property in two media
+            // queries have a class, the order of the queries does not matter
+            generator_media_t *rules =
+                generator_code_layout_media_get(generator, media, 0);
+
+            generator_code_layout_selector(rules->rules, tag, state);
+            string_append_char(rules->rules, '{');
+            generator_code_layout_declarations(generator, rules->rules,
+                                               declaration->data);
+            string_append_char(rules->rules, '}');
+        }
+
+        if (classes->length > 0) {
+            string_append_char(classes, ' ');
+        }
+
+        string_append_str(classes, tag);
+    }
+
+    string_destroy(signature);
+    string_destroy(declaration);
+}
+
+/**
+ *
+ * @function generator_code_layout_atomic_overlaps
+ * @brief Whether declarations of the layout block in one state, or in its
+ * media queries, override each other, so they need the order they are
+ * written in
+ * @params {ast_layout_block_t*} block - Layout block
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_atomic_overlaps(ast_layout_block_t *block) {
+    DEBUG_ME;
+    array_t *properties = array_create(sizeof(char *), 16);
+
+    bool overlaps =
+        generator_code_layout_atomic_styles_overlap(
+            block, block->styles->normal, properties) == true ||
+        generator_code_layout_atomic_styles_overlap(NULL, block->styles->new,
+                                                    properties) == true;
+
+    for (size_t i = 0; overlaps == false && i < block->states->length; i++) {
+        ast_layout_style_state_t *pseudo_element = block->states->data[i];
+        ast_layout_attribute_style_state_type type = block->states->keys[i];
+
+        if (pseudo_element->normal == NULL ||
+            type == AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR) {
+            continue;
+        }
+
+        properties->length = 0;
+        overlaps = generator_code_layout_atomic_styles_overlap(
+            block, pseudo_element->normal, properties);
+    }
+
+    // The media queries of the block are in the order it has them only with
+    // a class, see generator_code_layout_media_css
+    properties->length = 0;
+
+    for (size_t i = 0; overlaps == false && i < block->meta_children->length;
+         i++) {
+        ast_layout_node_t *node = block->meta_children->data[i];
+
+        if (node->type != AST_LAYOUT_TYPE_MEDIA) {
+            continue;
+        }
+
+        overlaps = generator_code_layout_atomic_styles_overlap(
+                       node->block, node->block->styles->normal,
+                       properties) == true ||
+                   generator_code_layout_atomic_styles_overlap(
+                       NULL, node->block->styles->new, properties) == true;
+    }
+
+    array_destroy(properties);
+
+    return overlaps;
+}
+
+/**
+ *
+ * @function generator_code_layout_atomic_styles_overlap
+ * @brief Add the properties of some styles to the properties of one state or
+ * of the media queries, and tell whether one overlaps a property already there
+ * @params {ast_layout_block_t*} block - Block the styles are normalized
+ * against, or NULL if they are already (new styles)
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {array_t*} properties - Properties of the state or media queries
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_atomic_styles_overlap(
+    ast_layout_block_t *block, enum_map_layout_attribute_t *styles,
+    array_t *properties) {
+    DEBUG_ME;
+    for (size_t i = 0; i < styles->length; i++) {
+        ast_layout_attribute_t *attribute = styles->data[i];
+
+        if (attribute == NULL) {
+            continue;
+        }
+
+        if (block != NULL) {
+            generator_code_layout_style_value(block->styles->normal,
+                                              block->styles->new, attribute);
+        }
+
+        if (attribute->isStyle == false || attribute->ignoreMe == true) {
+            continue;
+        }
+
+        if (attribute->final_key == NULL) {
+            ast_layout_attribute_set_final_key(attribute, attribute->key);
+        }
+
+        for (size_t j = 0; j < properties->length; j++) {
+            if (generator_code_layout_property_overlaps(
+                    array_get(properties, j), attribute->final_key) == true) {
+                return true;
+            }
+        }
+
+        array_push(properties, (void *)attribute->final_key);
+    }
+
+    return false;
+}
+
+/**
+ *
+ * @function generator_code_layout_media
+ * @brief Generate the CSS code for the media queries of the layout block
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @params {string_t*} css - Output the media queries are appended to
+ * @returns {size_t} - Number of media queries
+ *
+ */
+size_t generator_code_layout_media(generator_t *generator,
+                                   ast_layout_block_t *block, string_t *css) {
+    DEBUG_ME;
+    if (generator) {
+    }
+
     size_t media_queries_length = 0;
     size_t meta_children_length = block->meta_children->length;
 
@@ -805,285 +1274,387 @@ string_t *generator_code_layout_attributes(generator_t *generator,
             if (node->type != AST_LAYOUT_TYPE_MEDIA) {
                 continue;
             }
-            ast_layout_attribute_t *media_max_width =
-                hashmap_get(node_block->attributes, "responsive_max_width");
-            ast_layout_attribute_t *media_min_width =
-                hashmap_get(node_block->attributes, "responsive_min_width");
-            ast_layout_attribute_t *media_max_height =
-                hashmap_get(node_block->attributes, "responsive_max_height");
-            ast_layout_attribute_t *media_min_height =
-                hashmap_get(node_block->attributes, "responsive_min_height");
-
-            string_append_str(
-                generator->media_css,
-                "@media only screen and (");  // NOTE: WE HAVE TO HAVE A SPACE
-                                              // AFTER `AND`
-
-            size_t conditions = 0;
-            size_t media_queries_styles_length = 0;
-
-            if (media_max_width != NULL) {
-                if (media_max_width->values->length > 1) {
-                    error_generator(2,
-                                    "The responsive_max_width attribute can "
-                                    "only have one value!");
-
-                    return NULL;
-                } else if (validate_style_value_size(node_block->styles->normal,
-                                                     node_block->styles->new,
-                                                     media_max_width, NULL,
-                                                     NULL) == false) {
-                    error_generator(2,
-                                    "Invalid value for responsive_max_width "
-                                    "attribute in layout block!");
-
-                    return NULL;
-                }
+            generator_code_layout_media_query(generator, node_block, css);
 
-                if (conditions > 0) {
-                    string_append_str(generator->media_css, " and ");
-                }
+            string_append_char(css, '{');
+            string_append_char(css, STYLE_STYLE_LINKING);
+            string_append_str(css, block->tag);
+            string_append_char(css, '{');
 
-                string_append_str(generator->media_css, "max-width: ");
-                string_append_str(generator->media_css,
-                                  media_max_width->final_value);
+            generator_code_layout_media_styles(generator, node_block, css);
 
-                conditions++;
-            }
-
-            if (media_min_width != NULL) {
-                if (media_min_width->values->length > 1) {
-                    error_generator(2,
-                                    "The responsive_max_width attribute can "
-                                    "only have one value!");
-
-                    return NULL;
-                } else if (validate_style_value_size(node_block->styles->normal,
-                                                     node_block->styles->new,
-                                                     media_min_width, NULL,
-                                                     NULL) == false) {
-                    error_generator(2,
-                                    "Invalid value for responsive_max_width "
-                                    "attribute in layout block!");
-
-                    return NULL;
-                } else if (conditions > 0) {
-                    string_append_str(generator->media_css, " and ");
-                }
+            string_append_char(css, '}');
+            string_append_char(css, '}');
 
-                string_append_str(generator->media_css, "min-width: ");
-                string_append_str(generator->media_css,
-                                  media_min_width->final_value);
+            media_queries_length++;
+        }
+    }
 
-                conditions++;
-            }
+    return media_queries_length;
+}
 
-            if (media_max_height != NULL) {
-                if (media_max_height->values->length > 1) {
-                    error_generator(2,
-                                    "The responsive_max_width attribute can "
-                                    "only have one value!");
-
-                    return NULL;
-                } else if (validate_style_value_size(node_block->styles->normal,
-                                                     node_block->styles->new,
-                                                     media_max_height, NULL,
-                                                     NULL) == false) {
-                    error_generator(2,
-                                    "Invalid value for responsive_max_width "
-                                    "attribute in layout block!");
-
-                    return NULL;
-                } else if (conditions > 0) {
-                    string_append_str(generator->media_css, " and ");
-                }
+/**
+ *
+ * @function generator_code_layout_media_query
+ * @brief Generate the CSS media query of a media block, without its rules
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} node_block - Media block
+ * @params {string_t*} css - Output the media query is appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_query(generator_t *generator,
+                                       ast_layout_block_t *node_block,
+                                       string_t *css) {
+    DEBUG_ME;
+    if (generator) {
+    }
 
-                string_append_str(generator->media_css, "max-height: ");
-                string_append_str(generator->media_css,
-                                  media_max_height->final_value);
+    ast_layout_attribute_t *media_max_width =
+        enum_map_get(node_block->attributes,
+                     AST_LAYOUT_ATTRIBUTE_TYPE_RESPONSIVE_MAX_WIDTH);
+    ast_layout_attribute_t *media_min_width =
+        enum_map_get(node_block->attributes,
+                     AST_LAYOUT_ATTRIBUTE_TYPE_RESPONSIVE_MIN_WIDTH);
+    ast_layout_attribute_t *media_max_height =
+        enum_map_get(node_block->attributes,
+                     AST_LAYOUT_ATTRIBUTE_TYPE_RESPONSIVE_MAX_HEIGHT);
+    ast_layout_attribute_t *media_min_height =
+        enum_map_get(node_block->attributes,
+                     AST_LAYOUT_ATTRIBUTE_TYPE_RESPONSIVE_MIN_HEIGHT);
+
+    string_append_str(
+        css,
+        "@media only screen and (");  // NOTE: WE HAVE TO HAVE A SPACE
+                                      // AFTER `AND`
+
+    size_t conditions = 0;
+
+    if (media_max_width != NULL) {
+        if (media_max_width->values->length > 1) {
+            error_generator(2,
+                            "The responsive_max_width attribute can "
+                            "only have one value!");
+
+            return;
+        } else if (validate_style_value_size(node_block->styles->normal,
+                                             node_block->styles->new,
+                                             media_max_width, NULL,
+                                             NULL) == false) {
+            error_generator(2,
+                            "Invalid value for responsive_max_width "
+                            "attribute in layout block!");
+
+            return;
+        }
 
-                conditions++;
-            }
+        if (conditions > 0) {
+            string_append_str(css, " and ");
+        }
 
-            if (media_min_height != NULL) {
-                if (media_min_height->values->length > 1) {
-                    error_generator(2,
-                                    "The responsive_max_width attribute can "
-                                    "only have one value!");
-
-                    return NULL;
-                } else if (validate_style_value_size(node_block->styles->normal,
-                                                     node_block->styles->new,
-                                                     media_min_height, NULL,
-                                                     NULL) == false) {
-                    error_generator(2,
-                                    "Invalid value for responsive_max_width "
-                                    "attribute in layout block!");
-
-                    return NULL;
-                } else if (conditions > 0) {
-                    string_append_str(generator->media_css, " and ");
-                }
+        string_append_str(css, "max-width: ");
+        string_append_str(css, media_max_width->final_value);
 
-                string_append_str(generator->media_css, "min-height: ");
-                string_append_str(generator->media_css,
-                                  media_min_height->final_value);
+        conditions++;
+    }
 
-                conditions++;
-            }
+    if (media_min_width != NULL) {
+        if (media_min_width->values->length > 1) {
+            error_generator(2,
+                            "The responsive_max_width attribute can "
+                            "only have one value!");
+
+            return;
+        } else if (validate_style_value_size(node_block->styles->normal,
+                                             node_block->styles->new,
+                                             media_min_width, NULL,
+                                             NULL) == false) {
+            error_generator(2,
+                            "Invalid value for responsive_max_width "
+                            "attribute in layout block!");
+
+            return;
+        } else if (conditions > 0) {
+            string_append_str(css, " and ");
+        }
 
-            string_append_char(generator->media_css, ')');
-            string_append_char(generator->media_css, '{');
-            string_append_char(generator->media_css, STYLE_STYLE_LINKING);
-            string_append_str(generator->media_css, block->tag);
-            string_append_char(generator->media_css, '{');
-
-            // Media styles
-            size_t styles_normal_capacity =
-                node_block->styles->normal->capacity;
-            for (size_t i = 0; i < styles_normal_capacity; i++) {
-                hashmap_entry_t *entry = node_block->styles->normal->data[i];
-
-                while (entry) {
-                    ast_layout_attribute_t *attribute =
-                        cast(ast_layout_attribute_t *, entry->value);
-
-                    generator_code_layout_style_value(
-                        node_block->styles->normal, node_block->styles->new,
-                        attribute);
-
-                    if (attribute == NULL) {
-                    } else if (attribute->isStyle == false ||
-                               attribute->ignoreMe == true) {
-                    } else {
-                        if (media_queries_styles_length != 0) {
-                            string_append_char(generator->media_css, ';');
-                        }
-
-                        if (attribute->final_key == NULL) {
-                            attribute->final_key =
-                                string_strdup(attribute->key);
-                        }
-
-                        string_append_str(generator->media_css,
-                                          attribute->final_key);
-                        string_append_str(generator->media_css, ":");
-
-                        if (attribute->final_value == NULL) {
-                            attribute->final_value =
-                                array_value_stringify(attribute->values, ", ");
-                        }
-
-                        string_append_str(generator->media_css,
-                                          attribute->final_value);
-
-                        media_queries_styles_length++;
-                    }
+        string_append_str(css, "min-width: ");
+        string_append_str(css, media_min_width->final_value);
 
-                    entry = cast(hashmap_entry_t *, entry->next);
-                }
-            }
+        conditions++;
+    }
 
-            // Media new styles
-            size_t styles_new_capacity = node_block->styles->new->capacity;
-
-            for (size_t i = 0; i < styles_new_capacity; i++) {
-                hashmap_entry_t *entry = node_block->styles->new->data[i];
-
-                while (entry) {
-                    ast_layout_attribute_t *attribute =
-                        cast(ast_layout_attribute_t *, entry->value);
-                    if (attribute == NULL) {
-                    } else if (attribute->isStyle == false ||
-                               attribute->ignoreMe == true) {
-                    } else {
-                        if (media_queries_styles_length != 0) {
-                            string_append_char(generator->media_css, ';');
-                        }
-
-                        string_append_str(generator->media_css,
-                                          attribute->final_key);
-                        string_append_str(generator->media_css, ":");
-                        string_append_str(generator->media_css,
-                                          attribute->final_value);
-
-                        media_queries_styles_length++;
-                    }
+    if (media_max_height != NULL) {
+        if (media_max_height->values->length > 1) {
+            error_generator(2,
+                            "The responsive_max_width attribute can "
+                            "only have one value!");
+
+            return;
+        } else if (validate_style_value_size(node_block->styles->normal,
+                                             node_block->styles->new,
+                                             media_max_height, NULL,
+                                             NULL) == false) {
+            error_generator(2,
+                            "Invalid value for responsive_max_width "
+                            "attribute in layout block!");
+
+            return;
+        } else if (conditions > 0) {
+            string_append_str(css, " and ");
+        }
 
-                    entry = cast(hashmap_entry_t *, entry->next);
-                }
-            }
+        string_append_str(css, "max-height: ");
+        string_append_str(css, media_max_height->final_value);
 
-            string_append_char(generator->media_css, '}');
-            string_append_char(generator->media_css, '}');
+        conditions++;
+    }
 
-            media_queries_length++;
+    if (media_min_height != NULL) {
+        if (media_min_height->values->length > 1) {
+            error_generator(2,
+                            "The responsive_max_width attribute can "
+                            "only have one value!");
+
+            return;
+        } else if (validate_style_value_size(node_block->styles->normal,
+                                             node_block->styles->new,
+                                             media_min_height, NULL,
+                                             NULL) == false) {
+            error_generator(2,
+                            "Invalid value for responsive_max_width "
+                            "attribute in layout block!");
+
+            return;
+        } else if (conditions > 0) {
+            string_append_str(css, " and ");
         }
+
+        string_append_str(css, "min-height: ");
+        string_append_str(css, media_min_height->final_value);
+
+        conditions++;
     }
 
-    if (((media_queries_length > 0 || css_attributes_length > 0) &&
-         css_attributes->length > 0) ||
-        has_substate == true) {
-        if (html_attributes_length > 0 && html_attributes->length > 0) {
-            string_append_char(html_attributes, ' ');
-        }
+    string_append_char(css, ')');
+}
 
-        if (css_attributes->length > 0) {
-            if (generator->inlineCSS == true &&
-                (media_queries_length == 0 && has_substate == false)) {
-                string_append_str(html_attributes, "style=\"");
-                string_append(html_attributes, css_attributes);
-                string_append_str(html_attributes, "\"");
+/**
+ *
+ * @function generator_code_layout_media_styles
+ * @brief Generate the CSS declarations of a media block
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} node_block - Media block
+ * @params {string_t*} css - Output the declarations are appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_styles(generator_t *generator,
+                                        ast_layout_block_t *node_block,
+                                        string_t *css) {
+    DEBUG_ME;
+    if (generator) {
+    }
 
-                html_attributes_length++;
-            } else {
-                if (first_load) {
-                    string_append_char(generator->css, STYLE_STYLE_LINKING);
-                    string_append_str(generator->css, block->tag);
-                    string_append_char(generator->css, '{');
-                    string_append(generator->css, css_attributes);
-                    string_append_char(generator->css, '}');
-                }
+    size_t media_queries_styles_length = 0;
+
+    // Media styles
+    size_t styles_normal_length = node_block->styles->normal->length;
+    for (size_t i = 0; i < styles_normal_length; i++) {
+        ast_layout_attribute_t *attribute = node_block->styles->normal->data[i];
+
+        generator_code_layout_style_value(node_block->styles->normal,
+                                          node_block->styles->new, attribute);
+
+        if (attribute == NULL) {
+        } else if (attribute->isStyle == false ||
+                   attribute->ignoreMe == true) {
+        } else {
+            if (media_queries_styles_length != 0) {
+                string_append_char(css, ';');
             }
-        }
 
-        if (block->tag != NULL) {
-            if (html_attributes_length > 0) {
-                string_append_char(html_attributes, ' ');
+            if (attribute->final_key == NULL) {
+                ast_layout_attribute_set_final_key(attribute, attribute->key);
             }
 
-            size_t tag_length = strlen(block->tag);
+            string_append_str(css, attribute->final_key);
+            string_append_str(css, ":");
 
-            // string_append_str(html_attributes, "id=");
-            string_append_str(html_attributes, "class=");
-            if (tag_length > 1) {
-                string_append_char(html_attributes, '\"');
+            if (attribute->final_value == NULL) {
+                attribute->final_value = array_value_stringify_arena(
+                    attribute->arena, attribute->values, ", ");
             }
 
-            string_append_str(html_attributes, block->tag);
+            string_append_str(css, attribute->final_value);
 
-            if (tag_length > 1) {
-                string_append_char(html_attributes, '\"');
-            }
-            html_attributes_length++;
+            media_queries_styles_length++;
         }
+    }
 
-        if (has_substate == true && first_load == true) {
-            string_t *pseudo_elements = generator_code_layout_pseudo_elements(
-                generator, block, &css_attributes_length);
+    // Media new styles
+    size_t styles_new_length = node_block->styles->new->length;
 
-            if (pseudo_elements != NULL) {
-                string_append(generator->css, pseudo_elements);
-                string_destroy(pseudo_elements);
+    for (size_t i = 0; i < styles_new_length; i++) {
+        ast_layout_attribute_t *attribute = node_block->styles->new->data[i];
+        if (attribute == NULL) {
+        } else if (attribute->isStyle == false ||
+                   attribute->ignoreMe == true) {
+        } else {
+            if (media_queries_styles_length != 0) {
+                string_append_char(css, ';');
             }
+
+            string_append_str(css, attribute->final_key);
+            string_append_str(css, ":");
+            string_append_str(css, attribute->final_value);
+
+            media_queries_styles_length++;
         }
     }
+}
 
-    if (css_attributes != NULL) {
-        css_attributes->destroy(css_attributes);
+/**
+ *
+ * @function generator_code_layout_media_add
+ * @brief Add the media queries of the layout block, for its class, to the
+ * rules of the media queries
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @params {const char*} tag - Class of the block
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_add(generator_t *generator,
+                                     ast_layout_block_t *block,
+                                     const char *tag) {
+    DEBUG_ME;
+    string_t *query = string_create(128);
+    string_t *declarations = string_create(256);
+    size_t after = 0;
+
+    for (size_t i = 0; i < block->meta_children->length; i++) {
+        ast_layout_node_t *node = block->meta_children->data[i];
+
+        if (node->type != AST_LAYOUT_TYPE_MEDIA) {
+            continue;
+        }
+
+        string_truncate(query, 0);
+        generator_code_layout_media_query(generator, node->block, query);
+
+        generator_media_t *media =
+            generator_code_layout_media_get(generator, query, after);
+
+        after = media->index;
+
+        string_truncate(declarations, 0);
+        generator_code_layout_media_styles(generator, node->block,
+                                           declarations);
+
+        string_append_char(media->rules, STYLE_STYLE_LINKING);
+        string_append_str(media->rules, tag);
+        string_append_char(media->rules, '{');
+        generator_code_layout_declarations(generator, media->rules,
+                                           declarations->data);
+        string_append_char(media->rules, '}');
+    }
+
+    string_destroy(declarations);
+    string_destroy(query);
+}
+
+/**
+ *
+ * @function generator_code_layout_media_get
+ * @brief Get the @media block of a media query the rules of a class are
+ * added to, the last one of the query if it is not before a block the class
+ * already has rules in, else a new one
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} query - Media query
+ * @params {size_t} after - Index of the last @media block of the class, 0 if
+ * it has none
+ * @returns {generator_media_t*}
+ *
+ */
+generator_media_t *generator_code_layout_media_get(generator_t *generator,
+                                                   string_t *query,
+                                                   size_t after) {
+    DEBUG_ME;
+    generator_media_t *media = hashmap_get(generator->media, query->data);
+
+    if (media == NULL || media->index < after) {
+        media = memory_allocate(sizeof(generator_media_t));
+        media->query = salam_intern(query->data);
+        media->rules = string_create(256);
+        media->index = generator->media_blocks->length;
+
+        array_push(generator->media_blocks, media);
+        hashmap_put_custom(generator->media, query->data, media, NULL);
+    }
+
+    return media;
+}
+
+/**
+ *
+ * @function generator_code_layout_media_css
+ * @brief Generate the CSS code of the media queries. The rules of the same
+ * media query are merged into one @media block as long as this keeps the
+ * order of the media queries of each class: a class with rules in the
+ * queries A then B has them in an @media block of A before one of B, so B
+ * still wins where both match. A query is written in another @media block
+ * when its last one is before a query the class already has
+ * @params {generator_t*} generator - Generator
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_css(generator_t *generator) {
+    DEBUG_ME;
+    string_truncate(generator->media_css, 0);
+
+    for (size_t i = 0; i < generator->media_blocks->length; i++) {
+        generator_media_t *media = array_get(generator->media_blocks, i);
+
+        string_append_str(generator->media_css, media->query);
+        string_append_char(generator->media_css, '{');
+        string_append(generator->media_css, media->rules);
+        string_append_char(generator->media_css, '}');
     }
+}
 
-    return html_attributes;
+/**
+ *
+ * @function generator_code_layout_media_destroy
+ * @brief Destroy an @media block, its media query is interned and kept
+ * @params {generator_media_t*} media - @media block
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_destroy(generator_media_t *media) {
+    DEBUG_ME;
+    string_destroy(media->rules);
+    memory_destroy(media);
+}
+
+/**
+ *
+ * @function generator_code_layout_declarations
+ * @brief Generate the CSS code for declarations, minified in the minify mode
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} css - Output the declarations are appended to
+ * @params {const char*} declarations - Declarations
+ * @returns {void}
+ *
+ */
+void generator_code_layout_declarations(generator_t *generator, string_t *css,
+                                        const char *declarations) {
+    DEBUG_ME;
+    if (generator->minify == true) {
+        generator_minify_css(css, declarations);
+    } else {
+        string_append_str(css, declarations);
+    }
 }
 
 /**
@@ -11,23 +11,29 @@
 #include "generator_layout_style.h"
 #include "memory.h"
 #include "string_buffer.h"
+
+// Class the rules of a layout block are generated for before the block gets
+// its class, see generator_code_layout_rules
+#define GENERATOR_STYLE_TAG "\x1A"
+
 /**
  *
  * @function generator_code_layout_block
  * @brief Generate the HTML code for the layout block
  * @params {generator_t*} generator - Generator
  * @params {array_t*} children - Children
- * @returns {string_t*}
+ * @params {string_t*} html - Output the HTML code is appended to
+ * @returns {void}
  *
  */
-string_t *generator_code_layout_block(generator_t *generator,
-                                      array_t *children);
+void generator_code_layout_block(generator_t *generator, array_t *children,
+                                 string_t *html);
 /**
  *
  * @function generator_code_layout_body
  * @params {generator_t*} generator - Generator
  * @params {ast_layout_block_t*} layout_block - Layout block
- * @params {string_t*} body - Body
+ * @params {string_t*} body - Output the body is appended to
  * @returns {void}
  *
  */
@@ -38,12 +44,14 @@ void generator_code_layout_body(generator_t *generator,
 /**
  *
  * @function generator_code_head_item
+ * @params {generator_t*} generator - Generator
  * @params {ast_layout_attribute_t*} attribute - Attribute
  * @params {string_t*} head - Head
  * @returns {void}
  *
  */
-void generator_code_head_item(ast_layout_attribute_t *attribute,
+void generator_code_head_item(generator_t *generator,
+                              ast_layout_attribute_t *attribute,
                               string_t *head);
 /**
  *
@@ -60,7 +68,8 @@ void generator_code_head(generator_t *generator, ast_layout_block_t *block,
 /**
  *
  * @function generator_code_layout
- * @brief Generate the HTML code for the layout block
+ * @brief Generate code for AST layout, the body into generator->html and then
+ * the document before it into generator->head, see generator_write_html
  * @params {generator_t*} generator - Generator
  * @returns {void}
  *
@@ -70,13 +79,13 @@ void generator_code_layout(generator_t *generator);
  *
  * @function generator_code_layout_styles
  * @brief Generate the CSS code for the layout block
- * @params {hashmap_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
  * @params {ast_layout_block_t*} block - Layout block
  * @params {size_t*} css_attributes_length - CSS attributes length
  * @returns {string_t*}
  *
  */
-string_t *generator_code_layout_styles(hashmap_layout_attribute_t *styles,
+string_t *generator_code_layout_styles(enum_map_layout_attribute_t *styles,
                                        ast_layout_block_t *block,
                                        size_t *css_attributes_length);
 
@@ -84,12 +93,14 @@ string_t *generator_code_layout_styles(hashmap_layout_attribute_t *styles,
  *
  * @function generator_code_layout_html
  * @brief Generate the HTML code for the layout block
+ * @params {generator_t*} generator - Generator
  * @params {ast_layout_block_t*} layout_block - Layout block
  * @params {string_t*} html - HTML string
  * @returns {void}
  *
  */
-void generator_code_layout_html(ast_layout_block_t *layout_block,
+void generator_code_layout_html(generator_t *generator,
+                                ast_layout_block_t *layout_block,
                                 string_t *html);
 /**
  *
@@ -97,11 +108,29 @@ void generator_code_layout_html(ast_layout_block_t *layout_block,
  * @brief Generate the HTML code for the layout block attributes
  * @params {generator_t} generator - Generator
  * @params {ast_layout_block_t*} block - Layout block
- * @returns {string_t*}
+ * @params {string_t*} html - Output the HTML attributes are appended to
+ * @returns {void}
  *
  */
-string_t *generator_code_layout_attributes(generator_t *generator,
-                                           ast_layout_block_t *block);
+void generator_code_layout_attributes(generator_t *generator,
+                                      ast_layout_block_t *block,
+                                      string_t *html);
+
+/**
+ *
+ * @function generator_code_layout_attribute_value
+ * @brief Generate the HTML code for an attribute value, in the minify mode
+ * quoted only if it has to be
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} html - Output the value is appended to
+ * @params {const char*} value - Value
+ * @params {bool} quote - Whether the value is quoted outside the minify mode
+ * @returns {void}
+ *
+ */
+void generator_code_layout_attribute_value(generator_t *generator,
+                                           string_t *html, const char *value,
+                                           bool quote);
 /**
  *
  * @function generator_code_head_meta_children
@@ -131,10 +160,221 @@ char *generator_code_layout_attribute_name(ast_layout_attribute_type_t type);
  * @brief Generate the HTML code for the layout block item
  * @params {generator_t*} generator - Generator
  * @params {ast_layout_node_t*} node - Node
- * @returns {string_t*}
+ * @params {string_t*} html - Output the HTML code is appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_block_item(generator_t *generator,
+                                      ast_layout_node_t *node, string_t *html);
+
+/**
+ *
+ * @function generator_code_layout_rules
+ * @brief Give the layout block a class and generate its CSS rules, states and
+ * media queries. Blocks styled the same share one class and one set of rules,
+ * unless they have global rules
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @params {string_t*} css_attributes - Declarations of the block
+ * @params {bool} inline_style - Whether the declarations are inlined instead
+ * @returns {void}
+ *
+ */
+void generator_code_layout_rules(generator_t *generator,
+                                 ast_layout_block_t *block,
+                                 string_t *css_attributes, bool inline_style);
+
+/**
+ *
+ * @function generator_code_layout_class
+ * @brief Get the class of some CSS rules by everything they are generated
+ * from, a new class the first time they are seen. The caller adds the rules
+ * of a new class
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} signature - Everything the rules are generated from
+ * @params {bool} share - Whether the class is shared by the same rules, a
+ * class with global rules is not: its rules must come after the global rules
+ * of the ancestors of its block
+ * @params {bool*} created - Set to whether the class is new
+ * @returns {const char*} - Class, owned by the generator
+ *
+ */
+const char *generator_code_layout_class(generator_t *generator,
+                                        string_t *signature, bool share,
+                                        bool *created);
+
+/**
+ *
+ * @function generator_code_layout_atomic
+ * @brief Give the layout block one class per declaration, for the atomic CSS
+ * mode. Each declaration, by its state and media query, is generated once and
+ * its class is shared by every block that has it
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @returns {void}
+ *
+ */
+void generator_code_layout_atomic(generator_t *generator,
+                                  ast_layout_block_t *block);
+
+/**
+ *
+ * @function generator_code_layout_atomic_styles
+ * @brief Append the classes of some styles for the atomic CSS mode
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Block the styles are normalized
+ * against, or NULL if they are already (new styles)
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {ast_layout_attribute_style_state_type} state - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @params {string_t*} media - Media query, or NULL
+ * @params {string_t*} classes - Output the classes are appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_atomic_styles(
+    generator_t *generator, ast_layout_block_t *block,
+    enum_map_layout_attribute_t *styles,
+    ast_layout_attribute_style_state_type state, string_t *media,
+    string_t *classes);
+
+/**
+ *
+ * @function generator_code_layout_atomic_overlaps
+ * @brief Whether declarations of the layout block in one state, or in its
+ * media queries, override each other, so they need the order they are
+ * written in
+ * @params {ast_layout_block_t*} block - Layout block
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_atomic_overlaps(ast_layout_block_t *block);
+
+/**
+ *
+ * @function generator_code_layout_atomic_styles_overlap
+ * @brief Add the properties of some styles to the properties of one state or
+ * of the media queries, and tell whether one overlaps a property already there
+ * @params {ast_layout_block_t*} block - Block the styles are normalized
+ * against, or NULL if they are already (new styles)
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {array_t*} properties - Properties of the state or media queries
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_atomic_styles_overlap(
+    ast_layout_block_t *block, enum_map_layout_attribute_t *styles,
+    array_t *properties);
+
+/**
+ *
+ * @function generator_code_layout_media
+ * @brief Generate the CSS code for the media queries of the layout block
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @params {string_t*} css - Output the media queries are appended to
+ * @returns {size_t} - Number of media queries
+ *
+ */
+size_t generator_code_layout_media(generator_t *generator,
+                                   ast_layout_block_t *block, string_t *css);
+
+/**
+ *
+ * @function generator_code_layout_media_query
+ * @brief Generate the CSS media query of a media block, without its rules
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} node_block - Media block
+ * @params {string_t*} css - Output the media query is appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_query(generator_t *generator,
+                                       ast_layout_block_t *node_block,
+                                       string_t *css);
+
+/**
+ *
+ * @function generator_code_layout_media_styles
+ * @brief Generate the CSS declarations of a media block
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} node_block - Media block
+ * @params {string_t*} css - Output the declarations are appended to
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_styles(generator_t *generator,
+                                        ast_layout_block_t *node_block,
+                                        string_t *css);
+
+/**
+ *
+ * @function generator_code_layout_media_add
+ * @brief Add the media queries of the layout block, for its class, to the
+ * rules of the media queries
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_block_t*} block - Layout block
+ * @params {const char*} tag - Class of the block
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_add(generator_t *generator,
+                                     ast_layout_block_t *block,
+                                     const char *tag);
+
+/**
+ *
+ * @function generator_code_layout_media_get
+ * @brief Get the @media block of a media query the rules of a class are
+ * added to, the last one of the query if it is not before a block the class
+ * already has rules in, else a new one
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} query - Media query
+ * @params {size_t} after - Index of the last @media block of the class, 0 if
+ * it has none
+ * @returns {generator_media_t*}
+ *
+ */
+generator_media_t *generator_code_layout_media_get(generator_t *generator,
+                                                   string_t *query,
+                                                   size_t after);
+
+/**
+ *
+ * @function generator_code_layout_media_css
+ * @brief Generate the CSS code of the media queries. The rules of the same
+ * media query are merged into one @media block as long as this keeps the
+ * order of the media queries of each class: a class with rules in the
+ * queries A then B has them in an @media block of A before one of B, so B
+ * still wins where both match. A query is written in another @media block
+ * when its last one is before a query the class already has
+ * @params {generator_t*} generator - Generator
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_css(generator_t *generator);
+
+/**
+ *
+ * @function generator_code_layout_media_destroy
+ * @brief Destroy an @media block, its media query is interned and kept
+ * @params {generator_media_t*} media - @media block
+ * @returns {void}
+ *
+ */
+void generator_code_layout_media_destroy(generator_media_t *media);
+
+/**
+ *
+ * @function generator_code_layout_declarations
+ * @brief Generate the CSS code for declarations, minified in the minify mode
+ * @params {generator_t*} generator - Generator
+ * @params {string_t*} css - Output the declarations are appended to
+ * @params {const char*} declarations - Declarations
+ * @returns {void}
  *
  */
-string_t *generator_code_layout_block_item(generator_t *generator,
-                                           ast_layout_node_t *node);
+void generator_code_layout_declarations(generator_t *generator, string_t *css,
+                                        const char *declarations);
 
 #endif
@@ -1,17 +1,141 @@
 #include "generator_layout_style.h"
+
+/**
+ *
+ * @variable generator_style_states_order
+ * @brief Style states in the order their grouped rules are written. An
+ * element in two states gets the declarations of the later one, so this
+ * order decides the cascade between the states of a class:
+ * - the global state first, the own rules of the descendants override it
+ * - the rules without a state, every state overrides them
+ * - the states of where an element is in the document
+ * - the interactive states in the usual link, visited, focus within, hover,
+ *   focus, focus visible, active order, a pressed link is styled as active
+ * - the states of form controls last, so a disabled or invalid control keeps
+ *   its style while it is hovered or focused
+ * @type {ast_layout_attribute_style_state_type[]}
+ *
+ */
+const ast_layout_attribute_style_state_type generator_style_states_order[] = {
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_GLOBAL,
+    GENERATOR_STYLE_STATE_NONE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ROOT,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_TARGET,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_FIRST_CHILD,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_LAST_CHILD,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ONLY_CHILD,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_FIRST_OF_TYPE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_LAST_OF_TYPE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ONLY_OF_TYPE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_NTH_CHILD,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_NTH_LAST_CHILD,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_NTH_OF_TYPE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_NTH_LAST_OF_TYPE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_EMPTY,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_LINK,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_VISITED,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_FOCUS_WITHIN,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_HOVER,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_FOCUS,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_FOCUS_VISIBLE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ACTIVE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_PLACEHOLDER_SHOWN,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_BLANK,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_REQUIRED,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_OPTIONAL,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_IN_RANGE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_OUT_OF_RANGE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_VALID,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_INVALID,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_READ_WRITE,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_READ_ONLY,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_CHECKED,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ENABLED,
+    AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_DISABLED,
+};
+
+_Static_assert(sizeof(generator_style_states_order) /
+                       sizeof(generator_style_states_order[0]) ==
+                   GENERATOR_STYLE_STATES,
+               "generator_style_states_order must list every style state");
+
+/**
+ *
+ * @variable generator_style_shorthands
+ * @brief Shorthand properties and the properties they set, by the words of
+ * their names: border sets every property with the words of border-color
+ * (border-top-color, border-inline-start-color), see
+ * generator_code_layout_property_words
+ * @type {const char*[][2]}
+ *
+ */
+const char *generator_style_shorthands[][2] = {
+    {"background-position", "background-position"},
+    {"border", "border-color"},
+    {"border", "border-image"},
+    {"border", "border-style"},
+    {"border", "border-width"},
+    {"border-radius", "border-radius"},
+    {"columns", "column-count"},
+    {"columns", "column-width"},
+    {"contain-intrinsic-size", "contain-intrinsic-height"},
+    {"contain-intrinsic-size", "contain-intrinsic-size"},
+    {"contain-intrinsic-size", "contain-intrinsic-width"},
+    {"container", "container"},
+    {"flex", "flex-basis"},
+    {"flex", "flex-grow"},
+    {"flex", "flex-shrink"},
+    {"flex-flow", "flex-direction"},
+    {"flex-flow", "flex-wrap"},
+    {"grid", "grid-auto"},
+    {"grid", "grid-template"},
+    {"grid-area", "grid-column"},
+    {"grid-area", "grid-row"},
+    {"grid-column", "grid-column"},
+    {"grid-row", "grid-row"},
+    {"grid-template", "grid-template"},
+    {"list-style", "list-style"},
+    {"margin", "margin"},
+    {"overflow", "overflow-block"},
+    {"overflow", "overflow-inline"},
+    {"overflow", "overflow-x"},
+    {"overflow", "overflow-y"},
+    {"padding", "padding"},
+    {"padding-block", "padding-block"},
+    {"padding-inline", "padding-inline"},
+    {"page-break-after", "break-after"},
+    {"page-break-before", "break-before"},
+    {"page-break-inside", "break-inside"},
+    {"place-content", "align-content"},
+    {"place-content", "justify-content"},
+    {"place-items", "align-items"},
+    {"place-items", "justify-items"},
+    {"place-self", "align-self"},
+    {"place-self", "justify-self"},
+    {"scroll-margin", "scroll-margin"},
+    {"scroll-margin-block", "scroll-margin-block"},
+    {"scroll-margin-inline", "scroll-margin-inline"},
+    {"scroll-padding", "scroll-padding"},
+    {"scroll-padding-block", "scroll-padding-block"},
+    {"scroll-padding-inline", "scroll-padding-inline"},
+    {"text-align", "text-align-last"},
+    {"text-decoration", "text-decoration"},
+    {"transition", "transition"},
+};
 /**
  *
  * @function generator_code_layout_pseudo_elements
  * @brief Generate the CSS code for the layout block pseudo elements
  * @params {generator_t*} generator - Generator
  * @params {ast_layout_block_t*} block - Layout block
- * @params {size_t*} css_attributes_length - CSS attributes length
+ * @params {string_t**} declarations - Declarations of each state by state type,
+ * owned by the caller (can be NULL)
  * @returns {string_t*}
  *
  */
 string_t *generator_code_layout_pseudo_elements(generator_t *generator,
                                                 ast_layout_block_t *block,
-                                                size_t *css_attributes_length) {
+                                                string_t **declarations) {
     DEBUG_ME;
     if (generator) {
     }
@@ -20,57 +144,34 @@ string_t *generator_code_layout_pseudo_elements(generator_t *generator,
         if (block->states != NULL) {
             string_t *css = string_create(1024);
 
-            size_t states_capacity = block->states->capacity;
-
-            for (size_t i = 0; i < states_capacity; i++) {
-                hashmap_entry_t *entry = block->states->data[i];
-
-                while (entry) {
-                    hashmap_entry_t *next =
-                        cast(hashmap_entry_t *, entry->next);
-
-                    ast_layout_style_state_t *pseudo_element = entry->value;
-
-                    if (pseudo_element->normal != NULL) {
-                        string_t *pseudo_element_styles =
-                            generator_code_layout_styles(pseudo_element->normal,
-                                                         block,
-                                                         css_attributes_length);
-                        ast_layout_attribute_style_state_type type =
-                            generator_code_layout_attribute_style_state_enduser_name_to_type(
-                                entry->key);
-
-                        if (pseudo_element_styles->length > 0 &&
-                            type !=
-                                AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR) {
-                            string_append_char(css, STYLE_STYLE_LINKING);
-                            string_append_str(css, block->tag);
-
-                            if (type !=
-                                AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_GLOBAL) {
-                                string_append_char(css, ':');
-                            } else {
-                                string_append_char(css, ' ');
-                            }
-
-                            string_append_str(
-                                css,
-                                generator_code_layout_attribute_style_state_type_to_generated_name(
-                                    type));
-
-                            string_append_char(css, '{');
-                            string_append(css, pseudo_element_styles);
-                            string_append_char(css, '}');
-
-                            if (css_attributes_length != NULL) {
-                                (*css_attributes_length)++;
-                            }
-                        }
+            size_t states_length = block->states->length;
+
+            for (size_t i = 0; i < states_length; i++) {
+                ast_layout_style_state_t *pseudo_element =
+                    block->states->data[i];
+
+                if (pseudo_element->normal != NULL) {
+                    string_t *pseudo_element_styles =
+                        generator_code_layout_styles(pseudo_element->normal,
+                                                     block, NULL);
+                    ast_layout_attribute_style_state_type type =
+                        block->states->keys[i];
+
+                    if (pseudo_element_styles->length > 0 &&
+                        type != AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR) {
+                        generator_code_layout_selector(css, block->tag, type);
 
-                        string_destroy(pseudo_element_styles);
+                        string_append_char(css, '{');
+                        string_append(css, pseudo_element_styles);
+                        string_append_char(css, '}');
+
+                        if (declarations != NULL) {
+                            declarations[type] = pseudo_element_styles;
+                            continue;
+                        }
                     }
 
-                    entry = next;
+                    string_destroy(pseudo_element_styles);
                 }
             }
 
@@ -81,17 +182,276 @@ string_t *generator_code_layout_pseudo_elements(generator_t *generator,
     return NULL;
 }
 
+/**
+ *
+ * @function generator_code_layout_property_overlaps
+ * @brief Whether two CSS properties can set the same value, so the one
+ * written later wins: the same property, a shorthand and a property it sets
+ * (margin and margin-top), or a logical and a physical property of one family
+ * (padding-inline-start and padding-right, either side as the direction of
+ * the text is not known here)
+ * @params {const char*} a - Property
+ * @params {const char*} b - Property
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_overlaps(const char *a, const char *b) {
+    DEBUG_ME;
+    if (strcmp(a, b) == 0) {
+        return true;
+    }
+
+    size_t shorthands_length = sizeof(generator_style_shorthands) /
+                               sizeof(generator_style_shorthands[0]);
+
+    for (size_t i = 0; i < shorthands_length; i++) {
+        const char *shorthand = generator_style_shorthands[i][0];
+        const char *words = generator_style_shorthands[i][1];
+
+        if ((strcmp(a, shorthand) == 0 &&
+             generator_code_layout_property_words(b, words) == true) ||
+            (strcmp(b, shorthand) == 0 &&
+             generator_code_layout_property_words(a, words) == true)) {
+            return true;
+        }
+    }
+
+    size_t family_length = strcspn(a, "-");
+
+    if (family_length != strcspn(b, "-") ||
+        strncmp(a, b, family_length) != 0) {
+        return false;
+    }
+
+    return (generator_code_layout_property_logical(a) == true &&
+            generator_code_layout_property_physical(b) == true) ||
+           (generator_code_layout_property_logical(b) == true &&
+            generator_code_layout_property_physical(a) == true);
+}
+
+/**
+ *
+ * @function generator_code_layout_property_logical
+ * @brief Whether a CSS property is a logical property, which sets a physical
+ * property by the direction of the text
+ * @params {const char*} name - Property
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_logical(const char *name) {
+    DEBUG_ME;
+    return generator_code_layout_property_words(name, "inline") == true ||
+           generator_code_layout_property_words(name, "block") == true ||
+           generator_code_layout_property_words(name, "start") == true ||
+           generator_code_layout_property_words(name, "end") == true;
+}
+
+/**
+ *
+ * @function generator_code_layout_property_physical
+ * @brief Whether a CSS property is a property of a physical side
+ * @params {const char*} name - Property
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_physical(const char *name) {
+    DEBUG_ME;
+    return generator_code_layout_property_words(name, "top") == true ||
+           generator_code_layout_property_words(name, "right") == true ||
+           generator_code_layout_property_words(name, "bottom") == true ||
+           generator_code_layout_property_words(name, "left") == true;
+}
+
+/**
+ *
+ * @function generator_code_layout_property_words
+ * @brief Whether a CSS property has the words of another name, in the same
+ * order (border-top-left-radius has the words of border-radius)
+ * @params {const char*} name - Property
+ * @params {const char*} words - Words separated by dashes
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_words(const char *name,
+                                          const char *words) {
+    DEBUG_ME;
+    while (*words != '\0') {
+        size_t word_length = strcspn(words, "-");
+        bool found = false;
+
+        while (found == false && *name != '\0') {
+            size_t name_word_length = strcspn(name, "-");
+
+            found = name_word_length == word_length &&
+                    strncmp(name, words, word_length) == 0;
+
+            name += name_word_length;
+            name += *name == '-' ? 1 : 0;
+        }
+
+        if (found == false) {
+            return false;
+        }
+
+        words += word_length;
+        words += *words == '-' ? 1 : 0;
+    }
+
+    return true;
+}
+
+/**
+ *
+ * @function generator_code_layout_selector
+ * @brief Generate the CSS selector of a class in a style state
+ * @params {string_t*} css - Output the selector is appended to
+ * @params {const char*} tag - Class
+ * @params {ast_layout_attribute_style_state_type} type - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @returns {void}
+ *
+ */
+void generator_code_layout_selector(
+    string_t *css, const char *tag,
+    ast_layout_attribute_style_state_type type) {
+    DEBUG_ME;
+    string_append_char(css, STYLE_STYLE_LINKING);
+    string_append_str(css, tag);
+
+    if (type == GENERATOR_STYLE_STATE_NONE) {
+        return;
+    } else if (type != AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_GLOBAL) {
+        string_append_char(css, ':');
+    } else {
+        string_append_char(css, ' ');
+    }
+
+    string_append_str(
+        css,
+        generator_code_layout_attribute_style_state_type_to_generated_name(
+            type));
+}
+
+/**
+ *
+ * @function generator_code_layout_group
+ * @brief Add the rule of a class in a style state to the rules grouped by
+ * their declarations, classes with the same declarations share one rule.
+ * Global rules are only grouped with the global rule just before them
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_attribute_style_state_type} type - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @params {const char*} tag - Class
+ * @params {string_t*} declarations - Declarations of the rule
+ * @returns {void}
+ *
+ */
+void generator_code_layout_group(generator_t *generator,
+                                 ast_layout_attribute_style_state_type type,
+                                 const char *tag, string_t *declarations) {
+    DEBUG_ME;
+    generator_group_t *group = &generator->groups[type];
+
+    // Minified first, so declarations which only differ in how they are
+    // written share one rule too
+    string_t *key = string_create(declarations->length + 1);
+
+    generator_code_layout_declarations(generator, key, declarations->data);
+
+    generator_rule_t *rule = hashmap_get(group->rules, key->data);
+
+    // A global rule applies to the descendants, where the global rules of
+    // their nearer ancestors come later and override it. It is only grouped
+    // with the rule just before it, so the global rules keep their order
+    if (rule != NULL && type == AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_GLOBAL &&
+        rule != array_get(group->order, group->order->length - 1)) {
+        rule = NULL;
+    }
+
+    if (rule == NULL) {
+        rule = memory_allocate(sizeof(generator_rule_t));
+        rule->declarations = salam_intern(key->data);
+        rule->selectors = string_create(64);
+
+        array_push(group->order, rule);
+        hashmap_put_custom(group->rules, key->data, rule, NULL);
+    } else {
+        string_append_char(rule->selectors, ',');
+    }
+
+    generator_code_layout_selector(rule->selectors, tag, type);
+
+    string_destroy(key);
+}
+
+/**
+ *
+ * @function generator_code_layout_group_css
+ * @brief Generate the CSS code of the grouped rules, state by state in the
+ * order of generator_style_states_order
+ * @params {generator_t*} generator - Generator
+ * @returns {void}
+ *
+ */
+void generator_code_layout_group_css(generator_t *generator) {
+    DEBUG_ME;
+    for (size_t i = 0; i < GENERATOR_STYLE_STATES; i++) {
+        generator_code_layout_group_write(generator,
+                                          generator_style_states_order[i]);
+    }
+}
+
+/**
+ *
+ * @function generator_code_layout_group_write
+ * @brief Generate the CSS code of the grouped rules of a style state, in the
+ * order they are added
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_attribute_style_state_type} type - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @returns {void}
+ *
+ */
+void generator_code_layout_group_write(
+    generator_t *generator, ast_layout_attribute_style_state_type type) {
+    DEBUG_ME;
+    generator_group_t *group = &generator->groups[type];
+
+    for (size_t i = 0; i < group->order->length; i++) {
+        generator_rule_t *rule = array_get(group->order, i);
+
+        string_append(generator->css, rule->selectors);
+        string_append_char(generator->css, '{');
+        string_append_str(generator->css, rule->declarations);
+        string_append_char(generator->css, '}');
+    }
+}
+
+/**
+ *
+ * @function generator_code_layout_rule_destroy
+ * @brief Destroy a grouped rule, its declarations are interned and kept
+ * @params {generator_rule_t*} rule - Rule
+ * @returns {void}
+ *
+ */
+void generator_code_layout_rule_destroy(generator_rule_t *rule) {
+    DEBUG_ME;
+    string_destroy(rule->selectors);
+    memory_destroy(rule);
+}
+
 /**
  *
  * @function generator_code_layout_style
  * @brief Generate the CSS code for the layout block
- * @params {hashmap_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
  * @params {ast_layout_block_t*} block - Layout block
  * @params {size_t*} css_attributes_length - CSS attributes length
  * @returns {string_t*}
  *
  */
-string_t *generator_code_layout_styles(hashmap_layout_attribute_t *styles,
+string_t *generator_code_layout_styles(enum_map_layout_attribute_t *styles,
                                        ast_layout_block_t *block,
                                        size_t *css_attributes_length) {
     DEBUG_ME;
@@ -99,45 +459,38 @@ string_t *generator_code_layout_styles(hashmap_layout_attribute_t *styles,
     string_t *code = string_create(1024);
 
     if (styles != NULL) {
-        size_t styles_capacity = styles->capacity;
-        for (size_t i = 0; i < styles_capacity; i++) {
-            hashmap_entry_t *entry = styles->data[i];
-
-            while (entry) {
-                ast_layout_attribute_t *attribute = entry->value;
-
-                generator_code_layout_style_value(
-                    block->styles->normal, block->styles->new, attribute);
-
-                if (attribute->isStyle == false ||
-                    attribute->ignoreMe == true) {
-                } else {
-                    if (attribute->final_value == NULL) {
-                        error_generator(
-                            2,
-                            "Something went wrong with the style value for "
-                            "'%s' attribute in '%s' element!",
-                            attribute->final_key,
-                            ast_layout_node_type_to_enduser_name(
-                                block->parent_node_type));
-                    }
-
-                    if (css_attributes_length_local != 0) {
-                        string_append_char(code, ';');
-                    }
+        size_t styles_length = styles->length;
+        for (size_t i = 0; i < styles_length; i++) {
+            ast_layout_attribute_t *attribute = styles->data[i];
+
+            generator_code_layout_style_value(block->styles->normal,
+                                              block->styles->new, attribute);
+
+            if (attribute->isStyle == false || attribute->ignoreMe == true) {
+            } else {
+                if (attribute->final_value == NULL) {
+                    error_generator(
+                        2,
+                        "Something went wrong with the style value for "
+                        "'%s' attribute in '%s' element!",
+                        attribute->final_key,
+                        ast_layout_node_type_to_enduser_name(
+                            block->parent_node_type));
+                }
 
-                    string_append_str(code, attribute->final_key);
-                    string_append_str(code, ":");
-                    string_append_str(code, attribute->final_value);
+                if (css_attributes_length_local != 0) {
+                    string_append_char(code, ';');
+                }
 
-                    if (css_attributes_length != NULL) {
-                        (*css_attributes_length)++;
-                    }
+                string_append_str(code, attribute->final_key);
+                string_append_str(code, ":");
+                string_append_str(code, attribute->final_value);
 
-                    css_attributes_length_local++;
+                if (css_attributes_length != NULL) {
+                    (*css_attributes_length)++;
                 }
 
-                entry = cast(hashmap_entry_t *, entry->next);
+                css_attributes_length_local++;
             }
         }
     }
@@ -149,13 +502,14 @@ string_t *generator_code_layout_styles(hashmap_layout_attribute_t *styles,
  *
  * @function generator_code_layout_style_value
  * @brief Convert AST layout attribute values to CSS attribute values
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New Styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New Styles
  * @params {ast_layout_attribute_t*} attribute - Layout Attribute
  * @returns {void}
  *
  */
-void generator_code_layout_style_value(hashmap_t *styles, hashmap_t *new_styles,
+void generator_code_layout_style_value(enum_map_layout_attribute_t *styles,
+                                       enum_map_layout_attribute_t *new_styles,
                                        ast_layout_attribute_t *attribute) {
     DEBUG_ME;
     bool isValid = validate_style_value(styles, new_styles, attribute);
@@ -175,11 +529,12 @@ void generator_code_layout_style_value(hashmap_t *styles, hashmap_t *new_styles,
     }
 
     if (attribute->final_key == NULL) {
-        attribute->final_key = string_strdup(attribute->key);
+        ast_layout_attribute_set_final_key(attribute, attribute->key);
     }
 
     if (attribute->final_value == NULL) {
-        attribute->final_value = string_strdup(
+        ast_layout_attribute_set_final_value(
+            attribute,
             cast(ast_value_t *, attribute->values->data[0])->data.string_value);
     }
 }
@@ -288,21 +643,7 @@ char *generator_code_layout_attribute_style_state_type_to_name(
 ast_layout_attribute_style_state_type
 generator_code_layout_attribute_style_state_enduser_name_to_type(char *name) {
     DEBUG_ME;
-    if (name == NULL) {
-        return AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
-    }
-
-#undef ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE
-
-#define ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE(TYPE, NAME, NAME_LOWER,       \
-                                              ENDUSER_NAME, GENERATED_NAME) \
-    if (strcmp(name, ENDUSER_NAME) == 0) {                                  \
-        return TYPE;                                                        \
-    }
-
-#include "ast_layout_attribute_style_state_type.h"
-
-    return AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
+    return enduser_name_to_ast_layout_attribute_style_state_type(name);
 }
 
 /**
@@ -342,19 +683,5 @@ char *generator_code_layout_attribute_style_state_type_to_generated_name(
 ast_layout_attribute_style_state_type
 generator_code_layout_attribute_style_state_name_to_type(char *name) {
     DEBUG_ME;
-    if (name == NULL) {
-        return AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
-    }
-
-#undef ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE
-
-#define ADD_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE(TYPE, NAME, NAME_LOWER,       \
-                                              ENDUSER_NAME, GENERATED_NAME) \
-    if (strcmp(name, NAME) == 0) {                                          \
-        return TYPE;                                                        \
-    }
-
-#include "ast_layout_attribute_style_state_type.h"
-
-    return AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR;
+    return name_to_ast_layout_attribute_style_state_type(name);
 }
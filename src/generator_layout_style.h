@@ -11,17 +11,38 @@
 #include "memory.h"
 #include "string_buffer.h"
 
+/**
+ *
+ * @variable generator_style_states_order
+ * @brief Style states in the order their grouped rules are written
+ * @type {ast_layout_attribute_style_state_type[]}
+ *
+ */
+extern const ast_layout_attribute_style_state_type
+    generator_style_states_order[];
+
+/**
+ *
+ * @variable generator_style_shorthands
+ * @brief Shorthand properties and the properties they set, by the words of
+ * their names
+ * @type {const char*[][2]}
+ *
+ */
+extern const char *generator_style_shorthands[][2];
+
 /**
  *
  * @function generator_code_layout_style_value
  * @brief Convert AST layout attribute values to CSS attribute values
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New Styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New Styles
  * @params {ast_layout_attribute_t*} attribute - Layout Attribute
  * @returns {void}
  *
  */
-void generator_code_layout_style_value(hashmap_t *styles, hashmap_t *new_styles,
+void generator_code_layout_style_value(enum_map_layout_attribute_t *styles,
+                                       enum_map_layout_attribute_t *new_styles,
                                        ast_layout_attribute_t *attribute);
 
 /**
@@ -54,13 +75,130 @@ char *generator_code_layout_attribute_style_state_type_to_name(
  * @brief Generate the CSS code for the layout block pseudo elements
  * @params {generator_t*} generator - Generator
  * @params {ast_layout_block_t*} block - Layout block
- * @params {size_t*} css_attributes_length - CSS attributes length
+ * @params {string_t**} declarations - Declarations of each state by state type,
+ * owned by the caller (can be NULL)
  * @returns {string_t*}
  *
  */
 string_t *generator_code_layout_pseudo_elements(generator_t *generator,
                                                 ast_layout_block_t *block,
-                                                size_t *css_attributes_length);
+                                                string_t **declarations);
+
+/**
+ *
+ * @function generator_code_layout_selector
+ * @brief Generate the CSS selector of a class in a style state
+ * @params {string_t*} css - Output the selector is appended to
+ * @params {const char*} tag - Class
+ * @params {ast_layout_attribute_style_state_type} type - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @returns {void}
+ *
+ */
+void generator_code_layout_selector(
+    string_t *css, const char *tag, ast_layout_attribute_style_state_type type);
+
+/**
+ *
+ * @function generator_code_layout_group
+ * @brief Add the rule of a class in a style state to the rules grouped by
+ * their declarations, classes with the same declarations share one rule.
+ * Global rules are only grouped with the global rule just before them
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_attribute_style_state_type} type - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @params {const char*} tag - Class
+ * @params {string_t*} declarations - Declarations of the rule
+ * @returns {void}
+ *
+ */
+void generator_code_layout_group(generator_t *generator,
+                                 ast_layout_attribute_style_state_type type,
+                                 const char *tag, string_t *declarations);
+
+/**
+ *
+ * @function generator_code_layout_group_css
+ * @brief Generate the CSS code of the grouped rules, state by state in the
+ * order of generator_style_states_order
+ * @params {generator_t*} generator - Generator
+ * @returns {void}
+ *
+ */
+void generator_code_layout_group_css(generator_t *generator);
+
+/**
+ *
+ * @function generator_code_layout_group_write
+ * @brief Generate the CSS code of the grouped rules of a style state, in the
+ * order they are added
+ * @params {generator_t*} generator - Generator
+ * @params {ast_layout_attribute_style_state_type} type - Style state, or
+ * GENERATOR_STYLE_STATE_NONE
+ * @returns {void}
+ *
+ */
+void generator_code_layout_group_write(
+    generator_t *generator, ast_layout_attribute_style_state_type type);
+
+/**
+ *
+ * @function generator_code_layout_rule_destroy
+ * @brief Destroy a grouped rule, its declarations are interned and kept
+ * @params {generator_rule_t*} rule - Rule
+ * @returns {void}
+ *
+ */
+void generator_code_layout_rule_destroy(generator_rule_t *rule);
+
+/**
+ *
+ * @function generator_code_layout_property_overlaps
+ * @brief Whether two CSS properties can set the same value, so the one
+ * written later wins: the same property, a shorthand and a property it sets
+ * (margin and margin-top), or a logical and a physical property of one family
+ * (padding-inline-start and padding-right, either side as the direction of
+ * the text is not known here)
+ * @params {const char*} a - Property
+ * @params {const char*} b - Property
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_overlaps(const char *a, const char *b);
+
+/**
+ *
+ * @function generator_code_layout_property_logical
+ * @brief Whether a CSS property is a logical property, which sets a physical
+ * property by the direction of the text
+ * @params {const char*} name - Property
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_logical(const char *name);
+
+/**
+ *
+ * @function generator_code_layout_property_physical
+ * @brief Whether a CSS property is a property of a physical side
+ * @params {const char*} name - Property
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_physical(const char *name);
+
+/**
+ *
+ * @function generator_code_layout_property_words
+ * @brief Whether a CSS property has the words of another name, in the same
+ * order (border-top-left-radius has the words of border-radius)
+ * @params {const char*} name - Property
+ * @params {const char*} words - Words separated by dashes
+ * @returns {bool}
+ *
+ */
+bool generator_code_layout_property_words(const char *name,
+                                          const char *words);
 
 /**
  *
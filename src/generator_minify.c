@@ -0,0 +1,304 @@
+#include "generator_minify.h"
+
+/**
+ *
+ * @function generator_minify_number
+ * @brief Write a number in its shortest form, without a sign on zero, leading
+ * and trailing zeros or an empty fraction (e.g. "0.300000" becomes ".3")
+ * @params {string_t*} out - Output the number is appended to
+ * @params {const char*} number - Number, digits with an optional sign and dot
+ * @params {size_t} length - Length of the number in bytes
+ * @returns {bool} - Whether the number is zero
+ *
+ */
+bool generator_minify_number(string_t *out, const char *number, size_t length) {
+    DEBUG_ME;
+    size_t i = 0;
+    bool negative = false;
+
+    if (i < length && (number[i] == '-' || number[i] == '+')) {
+        negative = number[i] == '-';
+        i++;
+    }
+
+    size_t integer_start = i;
+
+    while (i < length && number[i] >= '0' && number[i] <= '9') {
+        i++;
+    }
+
+    size_t integer_end = i;
+    size_t fraction_start = i;
+    size_t fraction_end = i;
+
+    if (i < length && number[i] == '.') {
+        fraction_start = ++i;
+
+        while (i < length && number[i] >= '0' && number[i] <= '9') {
+            i++;
+        }
+
+        fraction_end = i;
+    }
+
+    while (integer_start < integer_end && number[integer_start] == '0') {
+        integer_start++;
+    }
+
+    while (fraction_end > fraction_start && number[fraction_end - 1] == '0') {
+        fraction_end--;
+    }
+
+    if (integer_start == integer_end && fraction_start == fraction_end) {
+        string_append_char(out, '0');
+
+        return true;
+    }
+
+    if (negative == true) {
+        string_append_char(out, '-');
+    }
+
+    for (size_t j = integer_start; j < integer_end; j++) {
+        string_append_char(out, number[j]);
+    }
+
+    if (fraction_start < fraction_end) {
+        string_append_char(out, '.');
+
+        for (size_t j = fraction_start; j < fraction_end; j++) {
+            string_append_char(out, number[j]);
+        }
+    }
+
+    return false;
+}
+
+/**
+ *
+ * @function generator_minify_css
+ * @brief Write CSS declarations without optional whitespace and redundant
+ * semicolons, with shortened numbers, hex colors and zero lengths
+ * @params {string_t*} out - Output the declarations are appended to
+ * @params {const char*} declarations - Declarations (e.g. "a:b;c:d")
+ * @returns {void}
+ *
+ */
+void generator_minify_css(string_t *out, const char *declarations) {
+    DEBUG_ME;
+    size_t start = out->length;
+    size_t depth = 0;
+    bool space = false;
+    const char *c = declarations;
+
+    while (*c != '\0') {
+        if (is_char_whitespace(*c)) {
+            space = true;
+            c++;
+
+            continue;
+        }
+
+        char last = out->length > start ? out->data[out->length - 1] : '\0';
+
+        // A space is only kept between two words, e.g. "1px solid"
+        if (space == true) {
+            space = false;
+
+            if (last != '\0' && strchr(":;,(/!", last) == NULL &&
+                strchr(":;,)/!", *c) == NULL) {
+                string_append_char(out, ' ');
+            }
+        }
+
+        if (*c == ';') {
+            if (last != '\0' && last != ';') {
+                string_append_char(out, ';');
+            }
+
+            c++;
+        } else if (*c == '"' || *c == '\'') {
+            char quote = *c;
+
+            string_append_char(out, *c++);
+
+            while (*c != '\0' && *c != quote) {
+                if (*c == '\\' && c[1] != '\0') {
+                    string_append_char(out, *c++);
+                }
+
+                string_append_char(out, *c++);
+            }
+
+            if (*c != '\0') {
+                string_append_char(out, *c++);
+            }
+        } else if (is_char_alnum(*c) || (unsigned char)*c >= 0x80 ||
+                   strchr("#.-+%_", *c) != NULL) {
+            const char *token = c;
+
+            while (is_char_alnum(*c) || (unsigned char)*c >= 0x80 ||
+                   (*c != '\0' && strchr("#.-+%_", *c) != NULL)) {
+                c++;
+            }
+
+            size_t length = (size_t)(c - token);
+
+            // A URL is written as is, it may look like numbers
+            if (length == 3 && strncmp(token, "url", 3) == 0 && *c == '(') {
+                while (*c != '\0' && *c != ')') {
+                    c++;
+                }
+
+                if (*c == ')') {
+                    c++;
+                }
+
+                for (const char *p = token; p < c; p++) {
+                    string_append_char(out, *p);
+                }
+
+                continue;
+            }
+
+            generator_minify_css_token(out, token, length, depth > 0);
+        } else {
+            if (*c == '(') {
+                depth++;
+            } else if (*c == ')' && depth > 0) {
+                depth--;
+            }
+
+            string_append_char(out, *c++);
+        }
+    }
+
+    if (out->length > start && out->data[out->length - 1] == ';') {
+        string_truncate(out, out->length - 1);
+    }
+}
+
+/**
+ *
+ * @function generator_minify_css_token
+ * @brief Write a token of a CSS value, shortened if it is a number, a length
+ * or a hex color
+ * @params {string_t*} out - Output the token is appended to
+ * @params {const char*} token - Token
+ * @params {size_t} length - Length of the token in bytes
+ * @params {bool} in_function - Whether the token is an argument of a function
+ * (e.g. calc), where a zero length keeps its unit
+ * @returns {void}
+ *
+ */
+void generator_minify_css_token(string_t *out, const char *token,
+                                size_t length, bool in_function) {
+    DEBUG_ME;
+    // Hex colors with pairs of the same digit, e.g. #aabbcc becomes #abc
+    if (token[0] == '#' && (length == 7 || length == 9)) {
+        bool pairs = true;
+
+        for (size_t i = 1; i < length; i += 2) {
+            if (isxdigit((unsigned char)token[i]) == 0 ||
+                tolower((unsigned char)token[i]) !=
+                    tolower((unsigned char)token[i + 1])) {
+                pairs = false;
+            }
+        }
+
+        if (pairs == true) {
+            string_append_char(out, '#');
+
+            for (size_t i = 1; i < length; i += 2) {
+                string_append_char(out, (char)tolower((unsigned char)token[i]));
+            }
+
+            return;
+        }
+    }
+
+    // Numbers, with a unit or not
+    size_t i = 0;
+    size_t digits = 0;
+    bool dot = false;
+
+    if (token[i] == '-' || token[i] == '+') {
+        i++;
+    }
+
+    while (i < length && ((token[i] >= '0' && token[i] <= '9') ||
+                          (token[i] == '.' && dot == false))) {
+        if (token[i] == '.') {
+            dot = true;
+        } else {
+            digits++;
+        }
+
+        i++;
+    }
+
+    size_t unit = i;
+
+    while (i < length && (is_char_alpha(token[i]) || token[i] == '%')) {
+        i++;
+    }
+
+    if (digits > 0 && i == length) {
+        bool zero = generator_minify_number(out, token, unit);
+
+        if (zero == false || in_function == true ||
+            generator_minify_is_length_unit(token + unit, length - unit) ==
+                false) {
+            for (size_t j = unit; j < length; j++) {
+                string_append_char(out, token[j]);
+            }
+        }
+
+        return;
+    }
+
+    for (size_t j = 0; j < length; j++) {
+        string_append_char(out, token[j]);
+    }
+}
+
+/**
+ *
+ * @function generator_minify_is_length_unit
+ * @brief Check if a CSS unit is a length unit, whose zero can drop the unit
+ * @params {const char*} unit - Unit
+ * @params {size_t} length - Length of the unit in bytes
+ * @returns {bool}
+ *
+ */
+bool generator_minify_is_length_unit(const char *unit, size_t length) {
+    DEBUG_ME;
+    const char *units[] = {"px", "em", "rem",  "ex", "ch", "vw", "vh",
+                           "vmin", "vmax", "cm", "mm", "in", "pt", "pc"};
+
+    for (size_t i = 0; i < sizeof(units) / sizeof(units[0]); i++) {
+        if (strlen(units[i]) == length &&
+            strncmp(units[i], unit, length) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ *
+ * @function generator_minify_is_attribute_safe
+ * @brief Check if an HTML attribute value can be written without quotes
+ * @params {const char*} value - Attribute value
+ * @returns {bool}
+ *
+ */
+bool generator_minify_is_attribute_safe(const char *value) {
+    DEBUG_ME;
+    if (value == NULL || value[0] == '\0') {
+        return false;
+    }
+
+    return strpbrk(value, " \t\n\r\f\"'`=<>") == NULL;
+}
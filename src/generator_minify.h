@@ -0,0 +1,73 @@
+#ifndef _GENERATOR_MINIFY_H_
+#define _GENERATOR_MINIFY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "base.h"
+#include "string_buffer.h"
+
+/**
+ *
+ * @function generator_minify_number
+ * @brief Write a number in its shortest form, without a sign on zero, leading
+ * and trailing zeros or an empty fraction (e.g. "0.300000" becomes ".3")
+ * @params {string_t*} out - Output the number is appended to
+ * @params {const char*} number - Number, digits with an optional sign and dot
+ * @params {size_t} length - Length of the number in bytes
+ * @returns {bool} - Whether the number is zero
+ *
+ */
+bool generator_minify_number(string_t *out, const char *number, size_t length);
+
+/**
+ *
+ * @function generator_minify_css
+ * @brief Write CSS declarations without optional whitespace and redundant
+ * semicolons, with shortened numbers, hex colors and zero lengths
+ * @params {string_t*} out - Output the declarations are appended to
+ * @params {const char*} declarations - Declarations (e.g. "a:b;c:d")
+ * @returns {void}
+ *
+ */
+void generator_minify_css(string_t *out, const char *declarations);
+
+/**
+ *
+ * @function generator_minify_css_token
+ * @brief Write a token of a CSS value, shortened if it is a number, a length
+ * or a hex color
+ * @params {string_t*} out - Output the token is appended to
+ * @params {const char*} token - Token
+ * @params {size_t} length - Length of the token in bytes
+ * @params {bool} in_function - Whether the token is an argument of a function
+ * (e.g. calc), where a zero length keeps its unit
+ * @returns {void}
+ *
+ */
+void generator_minify_css_token(string_t *out, const char *token,
+                                size_t length, bool in_function);
+
+/**
+ *
+ * @function generator_minify_is_length_unit
+ * @brief Check if a CSS unit is a length unit, whose zero can drop the unit
+ * @params {const char*} unit - Unit
+ * @params {size_t} length - Length of the unit in bytes
+ * @returns {bool}
+ *
+ */
+bool generator_minify_is_length_unit(const char *unit, size_t length);
+
+/**
+ *
+ * @function generator_minify_is_attribute_safe
+ * @brief Check if an HTML attribute value can be written without quotes
+ * @params {const char*} value - Attribute value
+ * @returns {bool}
+ *
+ */
+bool generator_minify_is_attribute_safe(const char *value);
+
+#endif
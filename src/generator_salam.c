@@ -160,32 +160,24 @@ void generator_salam_layout_attribute(string_t* salam,
  * @function generator_salam_layout_attributes
  * @brief Generate the Salam code for the attributes
  * @params {string_t*} salam - Buffer
- * @params {hashmap_t*} attributes - Attributes
+ * @params {enum_map_layout_attribute_t*} attributes - Attributes
  * @returns {void}
  *
  */
-void generator_salam_layout_attributes(string_t* salam, hashmap_t* attributes) {
+void generator_salam_layout_attributes(
+    string_t* salam, enum_map_layout_attribute_t* attributes) {
     DEBUG_ME;
     if (attributes != NULL) {
-        size_t attribute_capacity = attributes->capacity;
-
-        for (size_t i = 0; i < attribute_capacity; i++) {
-            hashmap_entry_t* entry = attributes->data[i];
-
-            while (entry) {
-                ast_layout_attribute_t* attribute =
-                    cast(ast_layout_attribute_t*, entry->value);
-
-                if (attribute->isStyle == true
-                    // ||
-                    // attribute->isContent == true ||
-                    // attribute->ignoreMe == true
-                ) {
-                } else {
-                    generator_salam_layout_attribute(salam, attribute);
-                }
-
-                entry = cast(hashmap_entry_t*, entry->next);
+        for (size_t i = 0; i < attributes->length; i++) {
+            ast_layout_attribute_t* attribute = attributes->data[i];
+
+            if (attribute->isStyle == true
+                // ||
+                // attribute->isContent == true ||
+                // attribute->ignoreMe == true
+            ) {
+            } else {
+                generator_salam_layout_attribute(salam, attribute);
             }
         }
     }
@@ -196,32 +188,23 @@ void generator_salam_layout_attributes(string_t* salam, hashmap_t* attributes) {
  * @function generator_salam_layout_attributes_styles
  * @brief Generate the Salam code for the attributes styles
  * @params {string_t*} salam - Buffer
- * @params {hashmap_t*} attributes - Attributes styles
+ * @params {enum_map_layout_attribute_t*} attributes - Attributes styles
  * @returns {void}
  *
  */
-void generator_salam_layout_attributes_styles(string_t* salam,
-                                              hashmap_t* attributes) {
+void generator_salam_layout_attributes_styles(
+    string_t* salam, enum_map_layout_attribute_t* attributes) {
     DEBUG_ME;
     if (attributes != NULL) {
-        size_t attribute_capacity = attributes->capacity;
-
-        for (size_t i = 0; i < attribute_capacity; i++) {
-            hashmap_entry_t* entry = attributes->data[i];
-
-            while (entry) {
-                ast_layout_attribute_t* attribute =
-                    cast(ast_layout_attribute_t*, entry->value);
-
-                if (attribute->isStyle == false || attribute->isContent == true
-                    // ||
-                    // attribute->ignoreMe == true
-                ) {
-                } else {
-                    generator_salam_layout_attribute(salam, attribute);
-                }
-
-                entry = cast(hashmap_entry_t*, entry->next);
+        for (size_t i = 0; i < attributes->length; i++) {
+            ast_layout_attribute_t* attribute = attributes->data[i];
+
+            if (attribute->isStyle == false || attribute->isContent == true
+                // ||
+                // attribute->ignoreMe == true
+            ) {
+            } else {
+                generator_salam_layout_attribute(salam, attribute);
             }
         }
     }
@@ -249,11 +232,12 @@ void generator_salam_layout_styles(string_t* salam,
  * @function generator_salam_layout_states
  * @brief Generate the Salam code for the states
  * @params {string_t*} salam - Buffer
- * @params {hashmap_t*} states - States
+ * @params {enum_map_layout_style_state_t*} states - States
  * @returns {void}
  *
  */
-void generator_salam_layout_states(string_t* salam, hashmap_t* states) {
+void generator_salam_layout_states(string_t* salam,
+                                   enum_map_layout_style_state_t* states) {
     DEBUG_ME;
     if (salam) {
     }
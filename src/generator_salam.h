@@ -53,18 +53,19 @@ void generator_salam_layout_attribute(string_t* salam,
  * @function generator_salam_layout_attributes
  * @brief Generate the Salam code for the attributes
  * @params {string_t*} salam - Buffer
- * @params {hashmap_t*} attributes - Attributes
+ * @params {enum_map_layout_attribute_t*} attributes - Attributes
  * @returns {void}
  *
  */
-void generator_salam_layout_attributes(string_t* salam, hashmap_t* attributes);
+void generator_salam_layout_attributes(
+    string_t* salam, enum_map_layout_attribute_t* attributes);
 
 /**
  *
  * @function generator_salam_layout_styles
  * @brief Generate the Salam code for the styles
  * @params {string_t*} salam - Buffer
- * @params {hashmap_t*} styles - Styles
+ * @params {ast_layout_style_state_t*} styles - Styles
  * @returns {void}
  *
  */
@@ -76,11 +77,12 @@ void generator_salam_layout_styles(string_t* salam,
  * @function generator_salam_layout_states
  * @brief Generate the Salam code for the states
  * @params {string_t*} buffer - Buffer
- * @params {hashmap_t*} states - States
+ * @params {enum_map_layout_style_state_t*} states - States
  * @returns {void}
  *
  */
-void generator_salam_layout_states(string_t* buffer, hashmap_t* states);
+void generator_salam_layout_states(string_t* buffer,
+                                   enum_map_layout_style_state_t* states);
 
 /**
  *
@@ -98,12 +100,12 @@ void generator_salam_ident(string_t* buffer, size_t ident);
  * @function generator_salam_layout_attributes_styles
  * @brief Generate the Salam code for the attributes styles
  * @params {string_t*} salam - Buffer
- * @params {hashmap_t*} attributes - Attributes styles
+ * @params {enum_map_layout_attribute_t*} attributes - Attributes styles
  * @returns {void}
  *
  */
-void generator_salam_layout_attributes_styles(string_t* salam,
-                                              hashmap_t* attributes);
+void generator_salam_layout_attributes_styles(
+    string_t* salam, enum_map_layout_attribute_t* attributes);
 
 /**
  *
@@ -30,15 +30,28 @@ unsigned long hash_function(const char *str) {
  */
 hashmap_t *hashmap_create(size_t capacity) {
     DEBUG_ME;
-    hashmap_t *map = memory_allocate(sizeof(hashmap_t));
+    return hashmap_create_arena(NULL, capacity);
+}
+
+/**
+ *
+ * @function hashmap_create_arena
+ * @brief Create a new hashmap in an arena, it grows in the arena and is
+ * released with it
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity
+ * @returns {hashmap_t*}
+ *
+ */
+hashmap_t *hashmap_create_arena(salam_arena_t *arena, size_t capacity) {
+    DEBUG_ME;
+    hashmap_t *map = salam_arena_allocate(arena, sizeof(hashmap_t));
 
     map->capacity = capacity;
     map->length = 0;
-    map->data = (hashmap_entry_t **)memory_callocate(map->capacity,
-                                                     sizeof(hashmap_entry_t *));
-
-    map->print = cast(void (*)(void *), hashmap_print);
-    map->destroy = cast(void (*)(void *), hashmap_destroy);
+    map->arena = arena;
+    map->data = (hashmap_entry_t **)salam_arena_callocate(
+        arena, map->capacity, sizeof(hashmap_entry_t *));
 
     return map;
 }
@@ -54,12 +67,20 @@ hashmap_t *hashmap_create(size_t capacity) {
  */
 void *hashmap_get(hashmap_t *map, const char *key) {
     DEBUG_ME;
+    // A key that was never interned cannot be in any hashmap
+    const char *interned =
+        salam_intern_find(salam_intern_global(), key, strlen(key));
+
+    if (interned == NULL) {
+        return NULL;
+    }
+
     unsigned long hash = hash_function(key);
     size_t index = hash % map->capacity;
     hashmap_entry_t *entry = map->data[index];
 
     while (entry != NULL) {
-        if (strcmp(entry->key, key) == 0) {
+        if (entry->key == interned) {
             return entry->value;
         }
 
@@ -80,12 +101,19 @@ void *hashmap_get(hashmap_t *map, const char *key) {
  */
 bool hashmap_has(hashmap_t *map, const char *key) {
     DEBUG_ME;
+    const char *interned =
+        salam_intern_find(salam_intern_global(), key, strlen(key));
+
+    if (interned == NULL) {
+        return false;
+    }
+
     unsigned long hash = hash_function(key);
     size_t index = hash % map->capacity;
     hashmap_entry_t *entry = map->data[index];
 
     while (entry != NULL) {
-        if (strcmp(entry->key, key) == 0) {
+        if (entry->key == interned) {
             return true;
         }
 
@@ -105,6 +133,13 @@ bool hashmap_has(hashmap_t *map, const char *key) {
  */
 void *hashmap_remove(hashmap_t *map, const char *key) {
     DEBUG_ME;
+    const char *interned =
+        salam_intern_find(salam_intern_global(), key, strlen(key));
+
+    if (interned == NULL) {
+        return NULL;
+    }
+
     unsigned long hash = hash_function(key);
 
     size_t index = hash % map->capacity;
@@ -112,7 +147,7 @@ void *hashmap_remove(hashmap_t *map, const char *key) {
     hashmap_entry_t *prev = NULL;
 
     while (entry != NULL) {
-        if (strcmp(entry->key, key) == 0) {
+        if (entry->key == interned) {
             if (prev == NULL) {
                 map->data[index] = cast(hashmap_entry_t *, entry->next);
             } else {
@@ -124,11 +159,7 @@ void *hashmap_remove(hashmap_t *map, const char *key) {
             // TODO: Do we need to destroy the value or not?
 
             if (entry != NULL) {
-                if (entry->key != NULL) {
-                    memory_destroy(entry->key);
-                }
-
-                memory_destroy(entry);
+                salam_arena_free(map->arena, entry);
             }
 
             map->length--;
@@ -185,14 +216,15 @@ void hashmap_put(hashmap_t *map, const char *key, void *value) {
 void hashmap_put_custom(hashmap_t *map, const char *key, void *value,
                         void (*free_fn)(void *)) {
     DEBUG_ME;
+    const char *interned = salam_intern(key);
     unsigned long hash = hash_function(key);
 
     size_t index = hash % map->capacity;
     hashmap_entry_t *entry = map->data[index];
 
     while (entry != NULL) {
-        if (strcmp(entry->key, key) == 0) {
-            if (free_fn != NULL) {
+        if (entry->key == interned) {
+            if (free_fn != NULL && map->arena == NULL) {
                 free_fn(entry->value);
             }
 
@@ -204,9 +236,10 @@ void hashmap_put_custom(hashmap_t *map, const char *key, void *value,
         entry = cast(hashmap_entry_t *, entry->next);
     }
 
-    hashmap_entry_t *new_entry = memory_allocate(sizeof(hashmap_entry_t));
+    hashmap_entry_t *new_entry =
+        salam_arena_allocate(map->arena, sizeof(hashmap_entry_t));
 
-    new_entry->key = string_strdup(key);
+    new_entry->key = interned;
     new_entry->value = value;
     new_entry->next = cast(struct hashmap_entry_t *, map->data[index]);
 
@@ -216,8 +249,8 @@ void hashmap_put_custom(hashmap_t *map, const char *key, void *value,
 
     if ((float)map->length / map->capacity >= 0.75) {
         size_t new_length = map->capacity * 2;
-        hashmap_entry_t **new_data = (hashmap_entry_t **)memory_callocate(
-            new_length, sizeof(hashmap_entry_t *));
+        hashmap_entry_t **new_data = (hashmap_entry_t **)salam_arena_callocate(
+            map->arena, new_length, sizeof(hashmap_entry_t *));
 
         size_t map_capacity = map->capacity;
 
@@ -237,7 +270,7 @@ void hashmap_put_custom(hashmap_t *map, const char *key, void *value,
         }
 
         if (map->data != NULL) {
-            memory_destroy(map->data);
+            salam_arena_free(map->arena, map->data);
         }
 
         map->data = new_data;
@@ -307,13 +340,15 @@ void hashmap_print(hashmap_t *map) {
  * @function hashmap_destroy_custom
  * @brief Free the hashmap memory
  * @params {hashmap_t*} map
- * @params {void (*free_fn)(void*)} free_fn
+ * @params {void (*free_fn)(void*)} free_fn - Frees each value, or NULL to keep
+ * them
  * @returns {void}
  *
  */
 void hashmap_destroy_custom(hashmap_t *map, void (*free_fn)(void *)) {
     DEBUG_ME;
-    if (map != NULL) {
+    // An arena hashmap and its values are released with the arena
+    if (map != NULL && map->arena == NULL) {
         if (map->data != NULL) {
             size_t map_capacity = map->capacity;
 
@@ -324,9 +359,9 @@ void hashmap_destroy_custom(hashmap_t *map, void (*free_fn)(void *)) {
                     hashmap_entry_t *next =
                         cast(hashmap_entry_t *, entry->next);
 
-                    memory_destroy(entry->key);
-
-                    free_fn(entry->value);
+                    if (free_fn != NULL) {
+                        free_fn(entry->value);
+                    }
 
                     memory_destroy(entry);
 
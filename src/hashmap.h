@@ -5,10 +5,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
+#include "intern.h"
+
 struct hashmap_t;
 
 typedef struct hashmap_entry {
-    char *key;
+    const char *key;  // interned, see salam_intern
     void *value;
     struct hashmap_entry_t *next;
 } hashmap_entry_t;
@@ -18,13 +21,12 @@ typedef struct hashmap_t {
     size_t capacity;
     size_t length;
 
-    void (*print)(void *node);
-    void (*destroy)(void *node);
+    // NULL if the hashmap is on the heap, the entries of an arena hashmap are
+    // in the arena and its values are expected to be as well
+    salam_arena_t *arena;
 } hashmap_t;
 
 typedef hashmap_t hashmap_array_t;
-typedef hashmap_t hashmap_layout_attribute_t;
-typedef hashmap_t hashmap_layout_attribute_state_style_t;
 
 #include "array.h"
 #include "array_custom.h"
@@ -50,6 +52,18 @@ unsigned long hash_function(const char *str);
  */
 hashmap_t *hashmap_create(size_t size);
 
+/**
+ *
+ * @function hashmap_create_arena
+ * @brief Create a new hashmap in an arena, it grows in the arena and is
+ * released with it
+ * @params {salam_arena_t*} arena - Arena (can be NULL for the heap)
+ * @params {size_t} capacity
+ * @returns {hashmap_t*}
+ *
+ */
+hashmap_t *hashmap_create_arena(salam_arena_t *arena, size_t capacity);
+
 /**
  *
  * @function hashmap_put
@@ -130,9 +144,11 @@ void hashmap_put_custom(hashmap_t *map, const char *key, void *value,
 
 /**
  *
- * @function hashmap_destroy
+ * @function hashmap_destroy_custom
  * @brief Free the hashmap memory
  * @params {hashmap_t*} map
+ * @params {void (*free_fn)(void*)} free_fn - Frees each value, or NULL to keep
+ * them
  * @returns {void}
  *
  */
@@ -0,0 +1,234 @@
+#include "intern.h"
+
+/**
+ *
+ * @variable salam_intern_table
+ * @brief Table of salam_intern_global, NULL until the first use
+ * @type {salam_intern_t*}
+ *
+ */
+salam_intern_t *salam_intern_table = NULL;
+
+/**
+ *
+ * @function salam_intern_create
+ * @brief Create an interning table
+ * @params {size_t} capacity - Slots, 0 for SALAM_INTERN_CAPACITY
+ * @returns {salam_intern_t*}
+ *
+ */
+salam_intern_t *salam_intern_create(size_t capacity) {
+    DEBUG_ME;
+    salam_intern_t *table = memory_allocate(sizeof(salam_intern_t));
+
+    table->arena = salam_arena_create(0);
+    table->capacity = capacity == 0 ? SALAM_INTERN_CAPACITY : capacity;
+    table->length = 0;
+
+    if ((table->capacity & (table->capacity - 1)) != 0) {
+        panic("Capacity of an interning table must be a power of two");
+    }
+
+    table->slots =
+        memory_callocate(table->capacity, sizeof(salam_intern_entry_t));
+
+    return table;
+}
+
+/**
+ *
+ * @function salam_intern_slot
+ * @brief Find the slot of a string, or the empty slot it would go to
+ * @params {const salam_intern_t*} table - Interning table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @params {uint32_t} hash - Hash of the string
+ * @returns {salam_intern_entry_t*}
+ *
+ */
+salam_intern_entry_t *salam_intern_slot(const salam_intern_t *table,
+                                        const char *value, size_t length,
+                                        uint32_t hash) {
+    DEBUG_ME;
+    size_t mask = table->capacity - 1;
+    size_t index = hash & mask;
+
+    // The table is never more than half full, so an empty slot is reached
+    while (table->slots[index].value != NULL) {
+        salam_intern_entry_t *entry = &table->slots[index];
+
+        if (entry->hash == hash && entry->length == length &&
+            memcmp(entry->value, value, length) == 0) {
+            return entry;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    return &table->slots[index];
+}
+
+/**
+ *
+ * @function salam_intern_grow
+ * @brief Double the slots of the table and move the strings to them
+ * @params {salam_intern_t*} table - Interning table
+ * @returns {void}
+ *
+ */
+void salam_intern_grow(salam_intern_t *table) {
+    DEBUG_ME;
+    salam_intern_entry_t *slots = table->slots;
+    size_t capacity = table->capacity;
+
+    table->capacity = capacity * 2;
+    table->slots =
+        memory_callocate(table->capacity, sizeof(salam_intern_entry_t));
+
+    for (size_t i = 0; i < capacity; i++) {
+        if (slots[i].value != NULL) {
+            size_t index = slots[i].hash & (table->capacity - 1);
+
+            while (table->slots[index].value != NULL) {
+                index = (index + 1) & (table->capacity - 1);
+            }
+
+            table->slots[index] = slots[i];
+        }
+    }
+
+    memory_destroy(slots);
+}
+
+/**
+ *
+ * @function salam_intern_find
+ * @brief Get the interned copy of a string without adding it
+ * @params {const salam_intern_t*} table - Interning table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {const char*} - NULL if the string is not interned
+ *
+ */
+const char *salam_intern_find(const salam_intern_t *table, const char *value,
+                              size_t length) {
+    DEBUG_ME;
+    return salam_intern_slot(table, value, length,
+                             name_table_hash(value, length))
+        ->value;
+}
+
+/**
+ *
+ * @function salam_intern_add
+ * @brief Get the interned copy of a string, adding it on first use
+ * @params {salam_intern_t*} table - Interning table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {const char*}
+ *
+ */
+const char *salam_intern_add(salam_intern_t *table, const char *value,
+                             size_t length) {
+    DEBUG_ME;
+    uint32_t hash = name_table_hash(value, length);
+    salam_intern_entry_t *entry =
+        salam_intern_slot(table, value, length, hash);
+
+    if (entry->value != NULL) {
+        return entry->value;
+    }
+
+    if ((table->length + 1) * 2 > table->capacity) {
+        salam_intern_grow(table);
+
+        entry = salam_intern_slot(table, value, length, hash);
+    }
+
+    entry->value = salam_arena_strndup(table->arena, value, length);
+    entry->hash = hash;
+    entry->length = (uint32_t)length;
+
+    table->length++;
+
+    return entry->value;
+}
+
+/**
+ *
+ * @function salam_intern_destroy
+ * @brief Free the table and all of its strings
+ * @params {salam_intern_t*} table - Interning table
+ * @returns {void}
+ *
+ */
+void salam_intern_destroy(salam_intern_t *table) {
+    DEBUG_ME;
+    if (table != NULL) {
+        salam_arena_destroy(table->arena);
+
+        memory_destroy(table->slots);
+        memory_destroy(table);
+    }
+}
+
+/**
+ *
+ * @function salam_intern_global
+ * @brief Get the table shared by the whole process, created on first use
+ * @returns {salam_intern_t*}
+ *
+ */
+salam_intern_t *salam_intern_global(void) {
+    DEBUG_ME;
+    if (salam_intern_table == NULL) {
+        salam_intern_table = salam_intern_create(0);
+    }
+
+    return salam_intern_table;
+}
+
+/**
+ *
+ * @function salam_intern
+ * @brief Intern a string in the global table
+ * @params {const char*} value - String (can be NULL)
+ * @returns {const char*} - NULL if value is NULL
+ *
+ */
+const char *salam_intern(const char *value) {
+    DEBUG_ME;
+    if (value == NULL) {
+        return NULL;
+    }
+
+    return salam_intern_add(salam_intern_global(), value, strlen(value));
+}
+
+/**
+ *
+ * @function salam_intern_n
+ * @brief Intern the first bytes of a string in the global table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {const char*}
+ *
+ */
+const char *salam_intern_n(const char *value, size_t length) {
+    DEBUG_ME;
+    return salam_intern_add(salam_intern_global(), value, length);
+}
+
+/**
+ *
+ * @function salam_intern_global_destroy
+ * @brief Free the global table, every string interned in it is invalid after
+ * @returns {void}
+ *
+ */
+void salam_intern_global_destroy(void) {
+    DEBUG_ME;
+    salam_intern_destroy(salam_intern_table);
+
+    salam_intern_table = NULL;
+}
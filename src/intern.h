@@ -0,0 +1,144 @@
+#ifndef _INTERN_H_
+#define _INTERN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "arena.h"
+#include "base.h"
+#include "log.h"
+#include "memory.h"
+#include "name_table.h"
+
+// Slots of a new table, must be a power of two
+#define SALAM_INTERN_CAPACITY 512
+
+typedef struct {
+    const char *value;  // NULL if the slot is empty
+    uint32_t hash;
+    uint32_t length;  // in bytes
+} salam_intern_entry_t;
+
+// A set of strings where every string is stored once: two interned strings
+// are equal if and only if their pointers are equal. The strings live until
+// the table is destroyed and must never be freed on their own
+typedef struct {
+    salam_arena_t *arena;  // owns the strings
+    salam_intern_entry_t *slots;  // open addressing with linear probing
+    size_t capacity;  // power of two
+    size_t length;
+} salam_intern_t;
+
+/**
+ *
+ * @function salam_intern_create
+ * @brief Create an interning table
+ * @params {size_t} capacity - Slots, 0 for SALAM_INTERN_CAPACITY
+ * @returns {salam_intern_t*}
+ *
+ */
+salam_intern_t *salam_intern_create(size_t capacity);
+
+/**
+ *
+ * @function salam_intern_slot
+ * @brief Find the slot of a string, or the empty slot it would go to
+ * @params {const salam_intern_t*} table - Interning table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @params {uint32_t} hash - Hash of the string
+ * @returns {salam_intern_entry_t*}
+ *
+ */
+salam_intern_entry_t *salam_intern_slot(const salam_intern_t *table,
+                                        const char *value, size_t length,
+                                        uint32_t hash);
+
+/**
+ *
+ * @function salam_intern_grow
+ * @brief Double the slots of the table and move the strings to them
+ * @params {salam_intern_t*} table - Interning table
+ * @returns {void}
+ *
+ */
+void salam_intern_grow(salam_intern_t *table);
+
+/**
+ *
+ * @function salam_intern_find
+ * @brief Get the interned copy of a string without adding it
+ * @params {const salam_intern_t*} table - Interning table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {const char*} - NULL if the string is not interned
+ *
+ */
+const char *salam_intern_find(const salam_intern_t *table, const char *value,
+                              size_t length);
+
+/**
+ *
+ * @function salam_intern_add
+ * @brief Get the interned copy of a string, adding it on first use
+ * @params {salam_intern_t*} table - Interning table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {const char*}
+ *
+ */
+const char *salam_intern_add(salam_intern_t *table, const char *value,
+                             size_t length);
+
+/**
+ *
+ * @function salam_intern_destroy
+ * @brief Free the table and all of its strings
+ * @params {salam_intern_t*} table - Interning table
+ * @returns {void}
+ *
+ */
+void salam_intern_destroy(salam_intern_t *table);
+
+/**
+ *
+ * @function salam_intern_global
+ * @brief Get the table shared by the whole process, created on first use
+ * @returns {salam_intern_t*}
+ *
+ */
+salam_intern_t *salam_intern_global(void);
+
+/**
+ *
+ * @function salam_intern
+ * @brief Intern a string in the global table
+ * @params {const char*} value - String (can be NULL)
+ * @returns {const char*} - NULL if value is NULL
+ *
+ */
+const char *salam_intern(const char *value);
+
+/**
+ *
+ * @function salam_intern_n
+ * @brief Intern the first bytes of a string in the global table
+ * @params {const char*} value - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length in bytes
+ * @returns {const char*}
+ *
+ */
+const char *salam_intern_n(const char *value, size_t length);
+
+/**
+ *
+ * @function salam_intern_global_destroy
+ * @brief Free the global table, every string interned in it is invalid after
+ * @returns {void}
+ *
+ */
+void salam_intern_global_destroy(void);
+
+#endif
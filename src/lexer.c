@@ -1,8 +1,15 @@
 #include "lexer.h"
 
-#define LEXER_CURRENT (lexer->source[lexer->index])
+// The source is not NUL-terminated, reading past its end gives '\0'
+#define LEXER_CURRENT                    \
+    (lexer->index < lexer->source_length \
+         ? lexer->source[lexer->index]   \
+         : '\0')
 #define LEXER_CURRENT_PREV (lexer->source[lexer->index - 1])
-#define LEXER_CURRENT_NEXT (lexer->source[lexer->index + 1])
+#define LEXER_CURRENT_NEXT                   \
+    (lexer->index + 1 < lexer->source_length \
+         ? lexer->source[lexer->index + 1]   \
+         : '\0')
 
 #define LEXER_NEXT lexer->index++
 #define LEXER_PREV lexer->index--
@@ -12,16 +19,8 @@
 
 #define LEXER_ZERO_COLUMN lexer->column = 0
 
-#define LEXER_CURRENT_UTF8 (utf8_decode(lexer->source, &lexer->index))
-#define LEXER_CURRENT_PREV_UTF8 (utf8_decode(lexer->source, &lexer->index - 1))
-#define LEXER_CURRENT_NEXT_UTF8 (utf8_decode(lexer->source, &lexer->index + 1))
-
-#define LEXER_NEXT_UTF8 \
-    lexer->index += utf8_char_length(lexer->source[lexer->index])
-#define LEXER_PREV_UTF8 \
-    lexer->index -= utf8_char_length(lexer->source[lexer->index])
-
-#define LEXER_PUSH_TOKEN(TOKEN) array_push(lexer->tokens, TOKEN)
+#define LEXER_PUSH_TOKEN(TYPE, START) \
+    lexer_push_token(lexer, TYPE, START, lexer->index)
 
 /**
  *
@@ -70,12 +69,14 @@ const keyword_t keywords[] = {
 #define ADD_CHAR_TOKEN(TOKEN_TYPE, TOKEN_NAME, TOKEN_VALUE, TOKEN_CHAR)
 #define ADD_KEYWORD(TOKEN_TYPE, TOKEN_NAME, TOKEN_VALUE, TOKEN_VALUE_LENGTH) \
     {.length = TOKEN_VALUE_LENGTH,                                           \
+     .size = sizeof(TOKEN_VALUE) - 1,                                        \
      .type = TOKEN_TYPE,                                                     \
      .name = TOKEN_NAME,                                                     \
      .keyword = TOKEN_VALUE},
 #define ADD_KEYWORD_REPEAT(TOKEN_TYPE, TOKEN_NAME, TOKEN_VALUE, \
                            TOKEN_VALUE_LENGTH)                  \
     {.length = TOKEN_VALUE_LENGTH,                              \
+     .size = sizeof(TOKEN_VALUE) - 1,                           \
      .type = TOKEN_TYPE,                                        \
      .name = TOKEN_NAME,                                        \
      .keyword = TOKEN_VALUE},
@@ -85,6 +86,30 @@ const keyword_t keywords[] = {
 #include "token.h"
 };
 
+#define KEYWORDS_LENGTH (sizeof(keywords) / sizeof(keywords[0]))
+
+// The slots are masked with KEYWORD_TABLE_SIZE - 1 and probed until an empty
+// one is found, which never happens in a full table. They hold index + 1 in
+// an unsigned char
+_Static_assert((KEYWORD_TABLE_SIZE & (KEYWORD_TABLE_SIZE - 1)) == 0,
+               "KEYWORD_TABLE_SIZE must be a power of two");
+_Static_assert(KEYWORD_TABLE_SIZE > KEYWORDS_LENGTH,
+               "KEYWORD_TABLE_SIZE must be larger than the number of keywords");
+_Static_assert(KEYWORD_TABLE_SIZE <= 256,
+               "keyword_table slots must fit in an unsigned char");
+
+/**
+ *
+ * @variable keyword_table
+ * @brief Open-addressing hash table of indexes into keywords (0 = empty slot,
+ * otherwise index + 1), built once from the same token.h entries
+ * @type {unsigned char[]}
+ *
+ */
+static unsigned char keyword_table[KEYWORD_TABLE_SIZE];
+
+static bool keyword_table_ready = false;
+
 /**
  *
  * @function is_english_digit
@@ -139,53 +164,10 @@ bool is_arabic_digit(wchar_t ch) {
  */
 bool string_is_percentage(const char *value, bool acceptSign) {
     DEBUG_ME;
-    size_t len = mbstowcs(NULL, value, 0);
-    if (len == (size_t)-1) {
-        return false;
-    }
-
-    wchar_t *wvalue = memory_allocate(sizeof(wchar_t) * (len + 1));
-    mbstowcs(wvalue, value, len + 1);
-
-    if (wvalue[0] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t start = 0;
-    if (acceptSign == true) {
-        if (wvalue[0] == L'+' || wvalue[0] == L'-') {
-            start = 1;
-        }
-    }
-
-    if (start == 1 && wvalue[1] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t len_wvalue = wcslen(wvalue);
-
-    if (wvalue[len_wvalue - 1] != L'%') {
-        memory_destroy(wvalue);
+    number_scan_t scan;
+    int flags = NUMBER_SCAN_PERCENT | (acceptSign ? NUMBER_SCAN_SIGN : 0);
 
-        return false;
-    }
-
-    for (size_t i = start; i < len_wvalue - 1; i++) {
-        if (!(is_english_digit(wvalue[i]) || is_persian_digit(wvalue[i]) ||
-              is_arabic_digit(wvalue[i]))) {
-            memory_destroy(wvalue);
-
-            return false;
-        }
-    }
-
-    memory_destroy(wvalue);
-
-    return true;
+    return number_scan_string(value, flags, &scan) && scan.has_percent;
 }
 
 /**
@@ -198,49 +180,10 @@ bool string_is_percentage(const char *value, bool acceptSign) {
  */
 bool string_is_integer(const char *value) {
     DEBUG_ME;
-    size_t len = mbstowcs(NULL, value, 0);
-    if (len == (size_t)-1) {
-        return false;
-    }
-
-    wchar_t *wvalue = memory_allocate(sizeof(wchar_t) * (len + 1));
-    mbstowcs(wvalue, value, len + 1);
-
-    if (wvalue[0] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t start = 0;
-    if (wvalue[0] == L'+' || wvalue[0] == L'-') {
-        start = 1;
-    }
-
-    if (start == 1 && wvalue[1] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t i;
-
-    for (i = start; wvalue[i] != L'\0'; i++) {
-        if (!(is_english_digit(wvalue[i]) || is_persian_digit(wvalue[i]) ||
-              is_arabic_digit(wvalue[i]))) {
-            memory_destroy(wvalue);
-
-            return false;
-        }
-    }
-
-    memory_destroy(wvalue);
+    number_scan_t scan;
 
-    if (i == start) {
-        return false;
-    }
-
-    return true;
+    return number_scan_string(value, NUMBER_SCAN_SIGN, &scan) &&
+           scan.kind == NUMBER_KIND_INTEGER;
 }
 
 /**
@@ -253,61 +196,10 @@ bool string_is_integer(const char *value) {
  */
 bool string_is_float(const char *value) {
     DEBUG_ME;
-    size_t len = mbstowcs(NULL, value, 0);
-    if (len == (size_t)-1) {
-        return false;
-    }
-
-    wchar_t *wvalue = memory_allocate(sizeof(wchar_t) * (len + 1));
-    mbstowcs(wvalue, value, len + 1);
-
-    if (wvalue[0] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t start = 0;
-    if (wvalue[0] == L'+' || wvalue[0] == L'-') {
-        start = 1;
-    }
-
-    if (start == 1 && wvalue[1] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    bool hasDot = false;
-    size_t i;
-
-    for (i = start; wvalue[i] != L'\0'; i++) {
-        if (wvalue[i] == L'.') {
-            if (hasDot) {
-                memory_destroy(wvalue);
-
-                return false;
-            }
-
-            hasDot = true;
-        } else if (!(is_english_digit(wvalue[i]) ||
-                     is_persian_digit(wvalue[i]) ||
-                     is_arabic_digit(wvalue[i]))) {
-            memory_destroy(wvalue);
-
-            return false;
-        }
-    }
-
-    memory_destroy(wvalue);
-
-    if (hasDot == false) {
-        return false;
-    } else if (i == start) {
-        return false;
-    }
+    number_scan_t scan;
 
-    return true;
+    return number_scan_string(value, NUMBER_SCAN_SIGN, &scan) &&
+           scan.kind == NUMBER_KIND_FLOAT;
 }
 
 /**
@@ -320,137 +212,88 @@ bool string_is_float(const char *value) {
  */
 bool string_is_number(const char *value) {
     DEBUG_ME;
-    size_t len = mbstowcs(NULL, value, 0);
-    if (len == (size_t)-1) {
-        return false;
-    }
-
-    wchar_t *wvalue = memory_allocate(sizeof(wchar_t) * (len + 1));
-    mbstowcs(wvalue, value, len + 1);
-
-    if (wvalue[0] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t start = 0;
-    if (wvalue[0] == L'+' || wvalue[0] == L'-') {
-        start = 1;
-    }
-
-    if (start == 1 && wvalue[1] == L'\0') {
-        memory_destroy(wvalue);
-
-        return false;
-    }
-
-    size_t i;
+    number_scan_t scan;
 
-    for (i = start; wvalue[i] != L'\0'; i++) {
-        if (!(is_english_digit(wvalue[i]) || is_persian_digit(wvalue[i]) ||
-              is_arabic_digit(wvalue[i]))) {
-            memory_destroy(wvalue);
-
-            return false;
-        }
-    }
-
-    memory_destroy(wvalue);
-
-    if (i == start) {
-        return false;
-    }
-
-    return true;
+    return number_scan_string(value, NUMBER_SCAN_SIGN, &scan);
 }
 
 /**
  *
- * @function token_create
- * @brief Creating a new token
+ * @function lexer_push_token
+ * @brief Append a token to the token buffer of the lexer
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_type_t} type - Token type
- * @params {location_t} location - Token location
- * @returns {token_t*}
+ * @params {size_t} start - Index of the token text in source
+ * @params {size_t} end - Index just past the token text in source
+ * @returns {void}
  *
  */
-token_t *token_create(token_type_t type, location_t location) {
+void lexer_push_token(lexer_t *lexer, token_type_t type, size_t start,
+                      size_t end) {
     DEBUG_ME;
-    token_t *token = memory_allocate(sizeof(token_t));
-    token->type = type;
-    token->location = location;
-    token->data_type = TOKEN_ERROR;
+    token_t *token;
 
-    token->name = token_name;
-    token->value_stringify = token_value_stringify;
+    if (lexer->streaming) {
+        // lexer_peek lexes one token at a time, so the ring never overflows
+        token = &lexer->lookahead[(lexer->lookahead_start +
+                                   lexer->lookahead_length++) &
+                                  (LEXER_LOOKAHEAD_SIZE - 1)];
+    } else {
+        if (lexer->tokens_length >= lexer->tokens_capacity) {
+            lexer->tokens_capacity *= 2;
+            lexer->tokens = memory_reallocate(
+                lexer->tokens, lexer->tokens_capacity * sizeof(token_t));
+        }
 
-    token->print = token_print;
-    token->stringify = token_stringify;
-    token->destroy = token_destroy;
+        token = &lexer->tokens[lexer->tokens_length++];
+    }
 
-    return token;
+    lexer->tokens_lexed++;
+    token->type = type;
+    token->offset = (uint32_t)start;
+    token->length = (uint32_t)(end - start);
+    token->line = (uint32_t)lexer->line;
+    token->column = (uint32_t)lexer->column;
 }
 
 /**
  *
- * @function token_copy
- * @brief Copying a token
+ * @function token_start
+ * @brief Get the index where the lexer started a token, a string starts at
+ * its opening quote while its offset is the first byte of its body
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
- * @returns {token_t*}
+ * @returns {size_t}
  *
  */
-token_t *token_copy(token_t *token) {
+size_t token_start(lexer_t *lexer, token_t *token) {
     DEBUG_ME;
-    token_t *copy = token_create(token->type, token->location);
-    copy->data_type = token->data_type;
-
-    switch (token->data_type) {
-        case TOKEN_NUMBER_INT:
-            copy->data.number_int = token->data.number_int;
-            break;
-
-        case TOKEN_NUMBER_FLOAT:
-            copy->data.number_float = token->data.number_float;
-            break;
-
-        case TOKEN_STRING:
-        case TOKEN_IDENTIFIER:
-            if (token->data.string != NULL) {
-                copy->data.string = string_strdup(token->data.string);
-            }
-            break;
-
-        case TOKEN_BOOLEAN:
-            copy->data.boolean = token->data.boolean;
-            break;
+    if (token->type != TOKEN_STRING) {
+        return token->offset;
+    }
 
-        default:
-            break;
+    // '"' is one byte, '«' (C2 AB) two and '“' (E2 80 9C) three
+    if (lexer->source[token->offset - 1] == '"') {
+        return token->offset - 1;
+    } else if ((unsigned char)lexer->source[token->offset - 1] == 0xAB) {
+        return token->offset - 2;
     }
 
-    return copy;
+    return token->offset - 3;
 }
 
 /**
  *
- * @function token_destroy
- * @brief Destroying a token
+ * @function token_location
+ * @brief Get the location of a token
  * @params {token_t*} token - Token
- * @returns {void}
+ * @returns {location_t}
  *
  */
-void token_destroy(token_t *token) {
+location_t token_location(token_t *token) {
     DEBUG_ME;
-    if (token != NULL) {
-        if (token->data_type == TOKEN_STRING ||
-            token->data_type == TOKEN_IDENTIFIER) {
-            if (token->data.string != NULL) {
-                memory_destroy(token->data.string);
-            }
-        }
-
-        memory_destroy(token);
-    }
+    return (location_t){token->offset, token->length, token->line,
+                        token->column, token->line, token->column};
 }
 
 /**
@@ -527,16 +370,17 @@ token_type_t token_char_type(char c) {
  *
  * @function token_stringify
  * @brief Get the name & value & location of a token as a string
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
  * @returns {char*} - String representation of the token
  *
  */
-char *token_stringify(token_t *token) {
+char *token_stringify(lexer_t *lexer, token_t *token) {
     DEBUG_ME;
     static char buffer[1024];
     const char *type = token_type_stringify(token->type);
-    const char *value = token_value_stringify(token);
-    const char *location = location_stringify(token->location);
+    const char *value = token_value_stringify(lexer, token);
+    const char *location = location_stringify(token_location(token));
 
     snprintf(buffer, sizeof(buffer), "%s: %s at %s", type, value, location);
 
@@ -547,14 +391,15 @@ char *token_stringify(token_t *token) {
  *
  * @function token_print
  * @brief Print a token
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
  * @returns {void}
  *
  */
-void token_print(token_t *token) {
+void token_print(lexer_t *lexer, token_t *token) {
     DEBUG_ME;
     printf("Token: ");
-    printf("%s\n", token_stringify(token));
+    printf("%s\n", token_stringify(lexer, token));
 }
 
 /**
@@ -631,68 +476,145 @@ char *token_type_keyword(token_type_t type) {
     return TOKEN_NAME_UNKNOWN;
 }
 
+/**
+ *
+ * @function token_number_int
+ * @brief Get the value of an integer token
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Number token
+ * @returns {int}
+ *
+ */
+int token_number_int(lexer_t *lexer, token_t *token) {
+    DEBUG_ME;
+    number_scan_t scan;
+    number_scan(lexer->source + token->offset, token->length, NUMBER_SCAN_NONE,
+                &scan);
+
+    return (int)scan.integer;
+}
+
+/**
+ *
+ * @function token_number_float
+ * @brief Get the value of a float token
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Number token
+ * @returns {float}
+ *
+ */
+float token_number_float(lexer_t *lexer, token_t *token) {
+    DEBUG_ME;
+    number_scan_t scan;
+    number_scan(lexer->source + token->offset, token->length, NUMBER_SCAN_NONE,
+                &scan);
+
+    return (float)scan.value;
+}
+
 /**
  *
  * @function token_value_stringify
- * @brief Get the value of a token
- * @params {token_t*} Token
- * @returns {char*}
+ * @brief Get the value of a token, decoded from its slice of the source
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Token
+ * @returns {char*} - Valid until the next call
  *
  */
-char *token_value_stringify(token_t *token) {
+char *token_value_stringify(lexer_t *lexer, token_t *token) {
     DEBUG_ME;
     static char buffer[1024];
 
-    switch (token->data_type) {
+    switch (token->type) {
         case TOKEN_NUMBER_INT:
-            snprintf(buffer, sizeof(buffer), "%d", token->data.number_int);
+            snprintf(buffer, sizeof(buffer), "%d",
+                     token_number_int(lexer, token));
 
             return buffer;
 
         case TOKEN_NUMBER_FLOAT:
-            snprintf(buffer, sizeof(buffer), "%f", token->data.number_float);
+            snprintf(buffer, sizeof(buffer), "%f",
+                     token_number_float(lexer, token));
 
             return buffer;
 
-        case TOKEN_STRING:
-        case TOKEN_IDENTIFIER:
-            return token->data.string;
+        default:
+            break;
+    }
+
+    if (token->length == 0) {
+        return token_type_keyword(token->type);
+    }
 
-        case TOKEN_BOOLEAN:
-            return token->data.boolean ? TOKEN_BOOL_TRUE : TOKEN_BOOL_FALSE;
+    // Identifiers never grow when normalised, so the slice length is enough
+    if (token->length + 1 > lexer->value_capacity) {
+        lexer->value_capacity = token->length + 1;
+        lexer->value = memory_reallocate(lexer->value, lexer->value_capacity);
+    }
 
-        default:
-            return token_type_keyword(token->type);
+    const char *text = lexer->source + token->offset;
+    char *value = lexer->value;
+
+    memcpy(value, text, token->length);
+    value[token->length] = '\0';
+
+    if (token->type == TOKEN_STRING) {
+        return value;
     }
+
+    // Arabic yeh (U+064A, "ي") and Persian yeh (U+06CC, "ی") are both two
+    // bytes, so identifiers are normalised in place
+    for (size_t i = 0; i + 1 < token->length; i++) {
+        if ((unsigned char)value[i] == 0xD9 &&
+            (unsigned char)value[i + 1] == 0x8A) {
+            value[i] = (char)0xDB;
+            value[i + 1] = (char)0x8C;
+            i++;
+        }
+    }
+
+    return value;
 }
 
 /**
  *
  * @function lexer_create
- * @brief Creating a new lexer state
+ * @brief Creating a new lexer state, with the arena of its compilation unit
  * @params {char*} file_path - File path
- * @params {char*} source - Source code
+ * @params {const char*} source - Source code, not necessarily NUL-terminated
+ * @params {size_t} source_length - Length of the source in bytes
  * @returns {lexer_t*}
  *
  */
-lexer_t *lexer_create(const char *file_path, char *source) {
+lexer_t *lexer_create(const char *file_path, const char *source,
+                      size_t source_length) {
     DEBUG_ME;
-    lexer_t *lexer = memory_allocate(sizeof(lexer_t));
+    salam_arena_t *arena = salam_arena_create(0);
+    lexer_t *lexer = salam_arena_allocate(arena, sizeof(lexer_t));
 
+    lexer->arena = arena;
     lexer->file_path = file_path;
     lexer->source = source;
-    lexer->source_length = strlen(lexer->source);
+    lexer->source_buffer = NULL;
+    lexer->source_capacity = 0;
+    lexer->source_length = source_length;
     lexer->index = 0;
     lexer->line = 1;
     lexer->column = 1;
 
-    lexer->tokens = array_create(sizeof(token_t *), 10);
-
-    lexer->tokens->print = cast(void (*)(void *), array_token_print);
-    lexer->tokens->stringify = cast(char *(*)(void *), array_token_stringify);
-    lexer->tokens->destroy = cast(void (*)(void *), array_token_destroy);
+    // The token buffer is only allocated by lexer_lex, by default the parser
+    // pulls tokens through the lookahead ring
+    lexer->tokens = NULL;
+    lexer->tokens_length = 0;
+    lexer->tokens_capacity = 0;
+    lexer->tokens_lexed = 0;
 
     lexer->token_index = 0;
+    lexer->streaming = true;
+    lexer->lookahead_start = 0;
+    lexer->lookahead_length = 0;
+    lexer->value_capacity = 64;
+    lexer->value = memory_allocate(lexer->value_capacity);
 
     return lexer;
 }
@@ -700,7 +622,7 @@ lexer_t *lexer_create(const char *file_path, char *source) {
 /**
  *
  * @function lexer_destroy
- * @brief Destroying a lexer state
+ * @brief Destroying a lexer state and its arena, with the AST built in it
  * @params {lexer_t*} lexer - Lexer state
  * @returns {void}
  *
@@ -708,10 +630,16 @@ lexer_t *lexer_create(const char *file_path, char *source) {
 void lexer_destroy(lexer_t *lexer) {
     DEBUG_ME;
     if (lexer != NULL) {
-        array_destroy_custom(lexer->tokens,
-                             cast(void (*)(void *), token_destroy));
+        if (lexer->tokens != NULL) {
+            memory_destroy(lexer->tokens);
+        }
+        if (lexer->source_buffer != NULL) {
+            memory_destroy(lexer->source_buffer);
+        }
+        memory_destroy(lexer->value);
 
-        memory_destroy(lexer);
+        // The lexer itself is in the arena
+        salam_arena_destroy(lexer->arena);
     }
 }
 
@@ -730,7 +658,13 @@ void lexer_save(lexer_t *lexer, const char *tokens_output) {
 
     file_appends(tokens_output, "Tokens:\n");
     file_appends(tokens_output, "Lexer source: ");
-    file_appends(tokens_output, lexer->source == NULL ? "REPL" : lexer->source);
+    if (lexer->source == NULL) {
+        file_appends(tokens_output, "REPL");
+    } else {
+        char *source = string_strndup(lexer->source, lexer->source_length);
+        file_appends(tokens_output, source);
+        memory_destroy(source);
+    }
 
     file_appends(tokens_output, "\n");
     file_appends(tokens_output, "\n");
@@ -747,10 +681,10 @@ void lexer_save(lexer_t *lexer, const char *tokens_output) {
     file_appends(tokens_output, "\n");
     file_appends(tokens_output, "\n");
 
-    for (size_t i = 0; i < lexer->tokens->length; i++) {
-        token_t *token = array_get(lexer->tokens, i);
+    for (size_t i = 0; i < lexer->tokens_length; i++) {
+        token_t *token = &lexer->tokens[i];
 
-        file_appends(tokens_output, token_stringify(token));
+        file_appends(tokens_output, token_stringify(lexer, token));
         file_appends(tokens_output, "\n");
     }
 }
@@ -767,13 +701,21 @@ void lexer_debug(lexer_t *lexer) {
     DEBUG_ME;
     printf("============= START LEXER DEBUG =============\n");
 
-    printf("Lexer source: %s\n",
-           lexer->source == NULL ? "REPL" : lexer->source);
+    if (lexer->source == NULL) {
+        printf("Lexer source: REPL\n");
+    } else {
+        printf("Lexer source: %.*s\n", (int)lexer->source_length,
+               lexer->source);
+    }
     printf("Lexer index: %zu\n", lexer->index);
     printf("Lexer line: %zu\n", lexer->line);
     printf("Lexer column: %zu\n", lexer->column);
 
-    lexer->tokens->print(lexer->tokens);
+    printf("Tokens: %zu\n", lexer->tokens_length);
+
+    for (size_t i = 0; i < lexer->tokens_length; i++) {
+        token_print(lexer, &lexer->tokens[i]);
+    }
 
     printf("============= END LEXER DEBUG =============\n");
 }
@@ -813,82 +755,73 @@ void location_print(location_t location) {
  * @function lexer_lex_number
  * @brief Lexing a number
  * @params {lexer_t*} lexer - Lexer state
- * @params {char*} uc - UTF8 character
+ * @params {size_t} start - Index of the first digit (already consumed)
  * @returns {void}
  *
  */
-void lexer_lex_number(lexer_t *lexer, char *uc) {
+void lexer_lex_number(lexer_t *lexer, size_t start) {
     DEBUG_ME;
-    string_t *value = string_create(25);
-    string_append_char(value, convert_utf8_to_english_digit(uc));
-
-    bool is_float = false;
-
-    while (LEXER_CURRENT != '\0') {
-        // size_t num_bytes;
-        uc = char_utf8_decode(lexer->source, &lexer->index, NULL);
-        if (strcmp(uc, "\0") == 0) {
-            memory_destroy(uc);
-
-            break;
-        }
+    number_scan_t scan;
+    number_scan(lexer->source + start, lexer->source_length - start,
+                NUMBER_SCAN_NONE, &scan);
 
-        size_t is_dot = strcmp(uc, ".");
+    lexer->index = start + scan.length;
 
-        if (!is_utf8_digit(uc) && is_dot != 0) {
-            memory_destroy(uc);
+    token_type_t type = scan.kind == NUMBER_KIND_FLOAT ? TOKEN_NUMBER_FLOAT
+                                                       : TOKEN_NUMBER_INT;
 
-            break;
-        }
-
-        if (is_dot == 0) {
-            if (is_float) {
-                memory_destroy(uc);
+    LEXER_PUSH_TOKEN(type, start);
+}
 
-                break;
-            }
+/**
+ *
+ * @function keyword_table_init
+ * @brief Fill keyword_table from the keywords array (runs once)
+ * @returns {void}
+ *
+ */
+void keyword_table_init() {
+    DEBUG_ME;
+    for (size_t i = 0; i < KEYWORDS_LENGTH; i++) {
+        size_t slot = name_table_hash(keywords[i].keyword, keywords[i].size) &
+                      (KEYWORD_TABLE_SIZE - 1);
 
-            is_float = true;
+        while (keyword_table[slot] != 0) {
+            slot = (slot + 1) & (KEYWORD_TABLE_SIZE - 1);
         }
 
-        string_append_char(value, convert_utf8_to_english_digit(uc));
-
-        memory_destroy(uc);
+        keyword_table[slot] = (unsigned char)(i + 1);
     }
 
-    token_type_t type = is_float ? TOKEN_NUMBER_FLOAT : TOKEN_NUMBER_INT;
-    token_t *token = token_create(
-        type, (location_t){lexer->index, 1, lexer->line, lexer->column,
-                           lexer->line, lexer->column});
-    token->data_type = type;
-
-    if (is_float) {
-        token->data.number_float = atof(value->data);
-    } else {
-        token->data.number_int = atoi(value->data);
-    }
-
-    string_destroy(value);
-
-    LEXER_PUSH_TOKEN(token);
+    keyword_table_ready = true;
 }
 
 /**
  *
  * @function type_keyword
  * @brief Check if a string is a keyword then return the token type
- * @params {const char*} string - String
- * @returns {bool}
+ * @params {const char*} string - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the string in bytes
+ * @returns {token_type_t}
  *
  */
-token_type_t type_keyword(const char *string) {
+token_type_t type_keyword(const char *string, size_t length) {
     DEBUG_ME;
+    if (!keyword_table_ready) {
+        keyword_table_init();
+    }
+
+    size_t slot = name_table_hash(string, length) & (KEYWORD_TABLE_SIZE - 1);
+
+    while (keyword_table[slot] != 0) {
+        const keyword_t *keyword = &keywords[keyword_table[slot] - 1];
 
-    for (size_t i = 0; i < sizeof(keywords) / sizeof(keywords[0]); i++) {
-        // TODO: keywords[i].length == length
-        if (strcmp(string, keywords[i].keyword) == 0) {
-            return keywords[i].type;
+        if (keyword->size == length &&
+            memcmp(string, keyword->keyword, length) == 0) {
+            return keyword->type;
         }
+
+        slot = (slot + 1) & (KEYWORD_TABLE_SIZE - 1);
     }
 
     return TOKEN_IDENTIFIER;
@@ -899,43 +832,28 @@ token_type_t type_keyword(const char *string) {
  * @function lexer_lex_identifier
  * @brief Lexing an identifier
  * @params {lexer_t*} lexer - Lexer state
- * @params {char*} uc - UTF8 character
+ * @params {size_t} start - Index of the first character (already consumed)
  * @returns {void}
  *
  */
-void lexer_lex_identifier(lexer_t *lexer, char *uc) {
+void lexer_lex_identifier(lexer_t *lexer, size_t start) {
     DEBUG_ME;
-    string_t *value = string_create(25);
-
-    string_append_str(value, uc);
-
-    while (LEXER_CURRENT != '\0') {
+    while (lexer->index < lexer->source_length) {
         size_t num_bytes;
-        uc = char_utf8_decode(lexer->source, &lexer->index, &num_bytes);
+        uint32_t codepoint = char_utf8_decode(
+            lexer->source, lexer->source_length, &lexer->index, &num_bytes);
 
-        if (!is_utf8_alpha(uc)) {
+        if (!is_codepoint_identifier_continue(codepoint)) {
             lexer->index -= num_bytes;
 
-            memory_destroy(uc);
-
             break;
         }
-
-        string_append_str(value, uc);
-
-        memory_destroy(uc);
     }
 
-    token_type_t type = type_keyword(value->data);
-    token_t *token = token_create(
-        type, (location_t){lexer->index, 1, lexer->line, lexer->column,
-                           lexer->line, lexer->column});
-    token->data_type = TOKEN_IDENTIFIER;
-    token->data.string = string_arabic2persian(value->data);
+    size_t length = lexer->index - start;
+    token_type_t type = type_keyword(lexer->source + start, length);
 
-    string_destroy(value);
-
-    LEXER_PUSH_TOKEN(token);
+    LEXER_PUSH_TOKEN(type, start);
 }
 
 /**
@@ -951,28 +869,13 @@ void lexer_lex_identifier(lexer_t *lexer, char *uc) {
 void lexer_lex_string(lexer_t *lexer, int type) {
     DEBUG_ME;
     // Opening quote is already consumed
-    string_t *value = string_create(25);
-
-    size_t num_bytes;
-    char *uc = char_utf8_decode(lexer->source, &lexer->index, &num_bytes);
-
-    while (strcmp(uc, "\0") != 0 && ((type == 0 && strcmp(uc, "\"") != 0) ||
-                                     (type == 1 && strcmp(uc, "»") != 0) ||
-                                     (type == 2 && strcmp(uc, "”") != 0))) {
-        string_append_str(value, uc);
-        memory_destroy(uc);
+    uint32_t closing = type == 0 ? '"' : (type == 1 ? 0x00BB : 0x201D);
+    size_t start = lexer->index;
+    size_t end = lexer_scan_string_end(lexer->source, start,
+                                       lexer->source_length, closing);
 
-        uc = char_utf8_decode(lexer->source, &lexer->index, &num_bytes);
-    }
-
-    if ((type == 0 && strcmp(uc, "\"") != 0) ||
-        (type == 1 && strcmp(uc, "»") != 0) ||
-        (type == 2 && strcmp(uc, "”") != 0)) {
-        string_destroy(value);
-
-        if (uc != NULL) {
-            memory_destroy(uc);
-        }
+    if (end >= lexer->source_length) {
+        lexer->index = lexer->source_length;
 
         error_lexer(2, "Unterminated string value at line %zu, column %zu",
                     lexer->line, lexer->column);
@@ -980,117 +883,132 @@ void lexer_lex_string(lexer_t *lexer, int type) {
         return;
     }
 
-    if (uc != NULL) {
-        memory_destroy(uc);
-    }
-
-    token_t *token = token_create(
-        TOKEN_STRING, (location_t){lexer->index, 1, lexer->line, lexer->column,
-                                   lexer->line, lexer->column});
-    token->data_type = TOKEN_STRING;
-    token->data.string = string_strdup(value->data);
+    // Skip the body and the closing quote
+    lexer->index = end + (closing == '"' ? 1 : (closing == 0x00BB ? 2 : 3));
 
-    string_destroy(value);
-
-    LEXER_PUSH_TOKEN(token);
+    lexer_push_token(lexer, TOKEN_STRING, start, end);
 }
 
 /**
  *
- * @function utf8_char_length
- * @brief Get the UTF-8 character and return the length
- * @params {char*} source - Source code
+ * @function char_utf8_decode
+ * @brief Decode the UTF-8 character at index in place and advance past it
+ * @params {const char*} source - Source code
+ * @params {size_t} length - Length of the source in bytes
  * @params {size_t*} index - Index of the current character in source string
- * @params {size_t*} num_bytes - Number of bytes
- * @returns {int}
+ * @params {size_t*} num_bytes - Number of bytes (can be NULL)
+ * @returns {uint32_t} Unicode codepoint
  *
  */
-char *char_utf8_decode(char *source, size_t *index, size_t *num_bytes) {
+uint32_t char_utf8_decode(const char *source, size_t length, size_t *index,
+                          size_t *num_bytes) {
     DEBUG_ME;
-    char *utf8_char = memory_allocate(5);
-    utf8_char[0] = source[*index];
-
+    const unsigned char *s = (const unsigned char *)source + *index;
+    uint32_t codepoint = 0;
     size_t bytes = 0;
 
-    if ((source[*index] & 0x80) == 0) {
+    if (s[0] < 0x80) {
         bytes = 1;
-    } else if ((source[*index] & 0xE0) == 0xC0) {
+    } else if ((s[0] & 0xE0) == 0xC0) {
         bytes = 2;
-    } else if ((source[*index] & 0xF0) == 0xE0) {
+    } else if ((s[0] & 0xF0) == 0xE0) {
         bytes = 3;
-    } else if ((source[*index] & 0xF8) == 0xF0) {
+    } else if ((s[0] & 0xF8) == 0xF0) {
         bytes = 4;
+    }
+
+    // A sequence cut by the end of the source is invalid as well
+    if (bytes == 1) {
+        codepoint = s[0];
+    } else if (bytes == 2 && length - *index >= 2) {
+        codepoint = ((uint32_t)(s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+    } else if (bytes == 3 && length - *index >= 3) {
+        codepoint = ((uint32_t)(s[0] & 0x0F) << 12) |
+                    ((uint32_t)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+    } else if (bytes == 4 && length - *index >= 4) {
+        codepoint = ((uint32_t)(s[0] & 0x07) << 18) |
+                    ((uint32_t)(s[1] & 0x3F) << 12) |
+                    ((uint32_t)(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
     } else {
-        bytes = 0;
         if (num_bytes != NULL) {
-            *num_bytes = bytes;
+            *num_bytes = 0;
         }
 
-        error_lexer(3, "Invalid UTF-8 encoding detected at index %d", *index);
-    }
+        error_lexer(3, "Invalid UTF-8 encoding detected at index %zu", *index);
 
-    for (size_t i = 1; i < bytes; ++i) {
-        utf8_char[i] = source[*index + i];
+        return 0;
     }
 
-    utf8_char[bytes] = '\0';
-
     *index += bytes;
 
     if (num_bytes != NULL) {
         *num_bytes = bytes;
     }
 
-    return utf8_char;
+    return codepoint;
 }
 
 /**
  *
  * @function lexer_lex
- * @brief Lexing the source code
+ * @brief Lexing the whole source code into lexer->tokens, the parser then
+ * reads the buffer instead of lexing on demand
  * @params {lexer_t*} lexer - Lexer state
  * @returns {void}
  *
  */
 void lexer_lex(lexer_t *lexer) {
     DEBUG_ME;
-    char c;
+    lexer->streaming = false;
+
+    if (lexer->tokens == NULL) {
+        // Rough guess of one token per 8 bytes of source to avoid most
+        // regrowth
+        lexer->tokens_capacity = lexer->source_length / 8 + 16;
+        lexer->tokens =
+            memory_allocate(lexer->tokens_capacity * sizeof(token_t));
+    }
+
+    while (lexer_lex_token(lexer)) {
+    }
+}
+
+/**
+ *
+ * @function lexer_lex_token
+ * @brief Lexing the next token and pushing it, TOKEN_EOF is pushed at the end
+ * of the source (again on every later call)
+ * @params {lexer_t*} lexer - Lexer state
+ * @returns {bool} - False if TOKEN_EOF was pushed
+ *
+ */
+bool lexer_lex_token(lexer_t *lexer) {
+    DEBUG_ME;
+    size_t lexed = lexer->tokens_lexed;
 
-    while ((c = LEXER_CURRENT) && c != '\0' &&
+    // Whitespaces, new lines and comments do not push a token
+    while (lexer->tokens_lexed == lexed &&
            lexer->index < lexer->source_length) {
-        // printf("c: %c, i: %zu, length: %zu\n", c, lexer->index,
-        //        lexer->source_length);
+        char c = LEXER_CURRENT;
+        size_t start = lexer->index;
         size_t num_bytes;
-        char *uc = char_utf8_decode(lexer->source, &lexer->index, &num_bytes);
+        uint32_t codepoint = char_utf8_decode(
+            lexer->source, lexer->source_length, &lexer->index, &num_bytes);
 
         switch (num_bytes) {
             case 0: {
-                if (uc != NULL) {
-                    memory_destroy(uc);
-                }
-
-                error_lexer(3, "Invalid UTF-8 encoding detected at index %d",
+                error_lexer(3, "Invalid UTF-8 encoding detected at index %zu",
                             lexer->index);
             } break;
 
             case 1: {
-                char ucf = uc[0];
-
-                switch (ucf) {
-                    // End of file
+                switch (c) {
+                    // NUL bytes no longer end the source, they are skipped
                     case '\0':
-                        if (uc != NULL) {
-                            memory_destroy(uc);
-                        }
-
                         break;
 
                     // New line
                     case '\n':
-                        if (uc != NULL) {
-                            memory_destroy(uc);
-                        }
-
                         LEXER_NEXT_LINE;
                         LEXER_ZERO_COLUMN;
                         continue;
@@ -1102,10 +1020,8 @@ void lexer_lex(lexer_t *lexer) {
                     case '\t':  // Horizontal tab
                     case '\v':  // Vertical tab
                     case ' ':   // Space
-                        if (uc != NULL) {
-                            memory_destroy(uc);
-                        }
-
+                        lexer->index = lexer_scan_blanks(
+                            lexer->source, lexer->index, lexer->source_length);
                         continue;
 
                     case '{':
@@ -1126,35 +1042,20 @@ void lexer_lex(lexer_t *lexer) {
                     case '<':
                     case '>':
                     case '!':
-                        if (uc != NULL) {
-                            memory_destroy(uc);
-                        }
-
                         if (LEXER_CURRENT == '/') {
-                            LEXER_NEXT;
-                            LEXER_NEXT_COLUMN;
-
-                            while (LEXER_CURRENT != '\n' &&
-                                   LEXER_CURRENT != '\0') {
-                                LEXER_NEXT;
-                                LEXER_NEXT_COLUMN;
-                            }
-                        } else {
-                            token_type_t type = token_char_type(c);
-                            token_t *token = token_create(
-                                type, (location_t){lexer->index, 1, lexer->line,
-                                                   lexer->column, lexer->line,
-                                                   lexer->column});
+                            // Comment until the end of the line
+                            size_t end =
+                                lexer_scan_byte(lexer->source, lexer->index,
+                                                lexer->source_length, '\n');
 
-                            LEXER_PUSH_TOKEN(token);
+                            lexer->column += end - lexer->index;
+                            lexer->index = end;
+                        } else {
+                            LEXER_PUSH_TOKEN(token_char_type(c), start);
                         }
                         continue;
 
                     case '"':
-                        if (uc != NULL) {
-                            memory_destroy(uc);
-                        }
-
                         lexer_lex_string(lexer, 0);
                         continue;
 
@@ -1168,25 +1069,17 @@ void lexer_lex(lexer_t *lexer) {
                     case '7':
                     case '8':
                     case '9':
-                        lexer_lex_number(lexer, uc);
-
-                        if (uc != NULL) {
-                            memory_destroy(uc);
-                        }
+                        lexer_lex_number(lexer, start);
                         continue;
 
                     default:
-                        if (c == '_' || is_char_alpha(c)) {
-                            lexer_lex_identifier(lexer, uc);
+                        if (is_codepoint_identifier_start(codepoint)) {
+                            lexer_lex_identifier(lexer, start);
                         } else {
                             error_lexer(1,
-                                        "Unknown character '%s' at line %zu, "
+                                        "Unknown character '%c' at line %zu, "
                                         "column %zu",
-                                        uc, lexer->line, lexer->column);
-                        }
-
-                        if (uc != NULL) {
-                            memory_destroy(uc);
+                                        c, lexer->line, lexer->column);
                         }
                         continue;
                 }
@@ -1196,31 +1089,359 @@ void lexer_lex(lexer_t *lexer) {
             case 3:
             case 4:
             default: {
-                if (strcmp(uc, "«") == 0) {
+                if (codepoint == 0x00AB) {  // «
                     lexer_lex_string(lexer, 1);
-                } else if (strcmp(uc, "“") == 0) {
+                } else if (codepoint == 0x201C) {  // “
                     lexer_lex_string(lexer, 2);
-                } else if (is_utf8_digit(uc)) {
-                    lexer_lex_number(lexer, uc);
-                } else if (c == '_' || is_utf8_alpha(uc) || is_char_alpha(c)) {
-                    lexer_lex_identifier(lexer, uc);
+                } else if (is_codepoint_digit(codepoint)) {
+                    lexer_lex_number(lexer, start);
+                } else if (is_codepoint_identifier_start(codepoint)) {
+                    lexer_lex_identifier(lexer, start);
                 } else {
                     error_lexer(
-                        1, "Unknown character '%s' at line %zu, column %zu", uc,
-                        lexer->line, lexer->column);
-                }
-
-                if (uc != NULL) {
-                    memory_destroy(uc);
+                        1, "Unknown character '%.*s' at line %zu, column %zu",
+                        (int)num_bytes, lexer->source + start, lexer->line,
+                        lexer->column);
                 }
                 continue;
             } break;
         }
     }
 
-    token_t *token = token_create(
-        TOKEN_EOF, (location_t){lexer->index, 1, lexer->line, lexer->column,
-                                lexer->line, lexer->column});
+    if (lexer->tokens_lexed != lexed) {
+        return true;
+    }
+
+    LEXER_PUSH_TOKEN(TOKEN_EOF, lexer->index);
+
+    return false;
+}
+
+/**
+ *
+ * @function lexer_peek
+ * @brief Get an unconsumed token, lexing it first if needed
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} offset - 0 for the current token, 1 for the next one
+ * (smaller than LEXER_LOOKAHEAD_SIZE)
+ * @returns {token_t*} - Valid until the token is consumed
+ *
+ */
+token_t *lexer_peek(lexer_t *lexer, size_t offset) {
+    DEBUG_ME;
+    if (!lexer->streaming) {
+        size_t index = lexer->token_index + offset;
+
+        // Past the end the EOF token is repeated
+        if (index >= lexer->tokens_length) {
+            index = lexer->tokens_length - 1;
+        }
+
+        return &lexer->tokens[index];
+    }
+
+    while (lexer->lookahead_length <= offset) {
+        lexer_lex_token(lexer);
+    }
+
+    return &lexer->lookahead[(lexer->lookahead_start + offset) &
+                             (LEXER_LOOKAHEAD_SIZE - 1)];
+}
+
+/**
+ *
+ * @function lexer_next_token
+ * @brief Consume the current token
+ * @params {lexer_t*} lexer - Lexer state
+ * @returns {token_t*} - Consumed token, valid until the next call
+ *
+ */
+token_t *lexer_next_token(lexer_t *lexer) {
+    DEBUG_ME;
+    lexer->previous = *lexer_peek(lexer, 0);
+
+    if (lexer->streaming) {
+        lexer->lookahead_start =
+            (lexer->lookahead_start + 1) & (LEXER_LOOKAHEAD_SIZE - 1);
+        lexer->lookahead_length--;
+    }
+
+    lexer->token_index++;
+
+    return &lexer->previous;
+}
+
+/**
+ *
+ * @function lexer_relex
+ * @brief Apply an edit to the source and update lexer->tokens by lexing again
+ * only from a token before the edit until the tokens match the old ones, the
+ * old tokens after that point are shifted. The restart token is found by a
+ * binary search and the source is edited in place, so beyond the tokens lexed
+ * again an edit costs a move of the text and tokens after it
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} edit_offset - Index of the edit in the source
+ * @params {size_t} deleted_length - Number of bytes removed at edit_offset
+ * @params {const char*} inserted_text - Text inserted at edit_offset
+ * @returns {void}
+ *
+ */
+void lexer_relex(lexer_t *lexer, size_t edit_offset, size_t deleted_length,
+                 const char *inserted_text) {
+    DEBUG_ME;
+    size_t inserted_length = inserted_text == NULL ? 0 : strlen(inserted_text);
+
+    if (edit_offset > lexer->source_length) {
+        edit_offset = lexer->source_length;
+    }
+    if (deleted_length > lexer->source_length - edit_offset) {
+        deleted_length = lexer->source_length - edit_offset;
+    }
+
+    // Token starts before the restart token and after the resync point are
+    // compared with this start of the edit and end of the deleted text
+    size_t inserted_end = edit_offset + inserted_length;
+
+    if (lexer->streaming || lexer->tokens_length == 0) {
+        // Nothing was lexed yet, so the whole source is lexed
+        lexer_relex_source(lexer, edit_offset, deleted_length, inserted_text,
+                           inserted_length);
+
+        lexer->index = 0;
+        lexer->line = 1;
+        lexer->column = 1;
+        lexer->tokens_length = 0;
+        lexer->token_index = 0;
+
+        lexer_lex(lexer);
+
+        return;
+    }
+
+    // The lexer state when it starts a token is its index, line and column,
+    // so lexing can restart at any token. The token just before the last one
+    // starting before the edit is used, as a token looks at the codepoint
+    // after it to know where it ends. Token starts are sorted, and the tokens
+    // before the edit read the same bytes once the source is edited
+    size_t restart = lexer_relex_restart(lexer, edit_offset);
+    restart = restart >= 2 ? restart - 2 : 0;
+
+    lexer_relex_source(lexer, edit_offset, deleted_length, inserted_text,
+                       inserted_length);
+
+    size_t length = lexer->source_length;
+    size_t index = 0;
+    size_t line = 1;
+    size_t column = 1;
+
+    if (restart > 0) {
+        token_t *token = &lexer->tokens[restart];
+
+        index = token_start(lexer, token);
+        line = token->line;
+        column = token->column;
+    }
+
+    // The new tokens are lexed in their own buffer, the old ones stay in
+    // place until they are spliced
+    token_t *tokens = lexer->tokens;
+    size_t tokens_length = lexer->tokens_length;
+    size_t tokens_capacity = lexer->tokens_capacity;
+    size_t old_line = lexer->line;
+    size_t old_column = lexer->column;
+
+    lexer->index = index;
+    lexer->line = line;
+    lexer->column = column;
+    lexer->tokens_capacity = 16;
+    lexer->tokens = memory_allocate(lexer->tokens_capacity * sizeof(token_t));
+    lexer->tokens_length = 0;
+
+    // First old token that may match a new one, and the line shift
+    size_t old = restart;
+    size_t resync = tokens_length;
+    long line_delta = 0;
+
+    while (true) {
+        bool more = lexer_lex_token(lexer);
+        token_t *token = &lexer->tokens[lexer->tokens_length - 1];
+        size_t start = token_start(lexer, token);
+
+        if (start >= inserted_end) {
+            // Same start in the old source
+            size_t old_start = start - inserted_length + deleted_length;
+
+            while (old < tokens_length &&
+                   lexer_relex_old_start(lexer, &tokens[old], edit_offset,
+                                         deleted_length,
+                                         inserted_length) < old_start) {
+                old++;
+            }
+
+            if (old < tokens_length &&
+                lexer_relex_old_start(lexer, &tokens[old], edit_offset,
+                                      deleted_length,
+                                      inserted_length) == old_start &&
+                tokens[old].type == token->type &&
+                tokens[old].column == token->column) {
+                resync = old;
+                line_delta = (long)token->line - (long)tokens[old].line;
+
+                // The matching token is kept from the old buffer
+                lexer->tokens_length--;
+                break;
+            }
+        }
+
+        if (!more) {
+            break;
+        }
+    }
+
+    // Splice: old tokens before the restart, the new tokens, then the old
+    // tokens from the resync point shifted by the edit
+    size_t tail = tokens_length - resync;
+    size_t total = restart + lexer->tokens_length + tail;
+
+    if (total > tokens_capacity) {
+        tokens_capacity = total;
+        tokens = memory_reallocate(tokens, tokens_capacity * sizeof(token_t));
+    }
+
+    memmove(tokens + restart + lexer->tokens_length, tokens + resync,
+            tail * sizeof(token_t));
+    memcpy(tokens + restart, lexer->tokens,
+           lexer->tokens_length * sizeof(token_t));
+
+    for (size_t i = restart + lexer->tokens_length; i < total; i++) {
+        tokens[i].offset = (uint32_t)(tokens[i].offset - deleted_length +
+                                      inserted_length);
+        tokens[i].line = (uint32_t)((long)tokens[i].line + line_delta);
+    }
+
+    memory_destroy(lexer->tokens);
+
+    if (tail > 0) {
+        // The rest of the source lexes as before
+        lexer->index = length;
+        lexer->line = (size_t)((long)old_line + line_delta);
+        lexer->column = old_column;
+    }
+
+    lexer->tokens = tokens;
+    lexer->tokens_length = total;
+    lexer->tokens_capacity = tokens_capacity;
+    lexer->token_index = 0;
+}
+
+/**
+ *
+ * @function lexer_relex_restart
+ * @brief Find the number of tokens starting before an index, by a binary
+ * search as token starts are sorted
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} index - Index in the source
+ * @returns {size_t}
+ *
+ */
+size_t lexer_relex_restart(lexer_t *lexer, size_t index) {
+    DEBUG_ME;
+    size_t low = 0;
+    size_t high = lexer->tokens_length;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+
+        if (token_start(lexer, &lexer->tokens[middle]) < index) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/**
+ *
+ * @function lexer_relex_source
+ * @brief Apply an edit to the source in place. A source the lexer does not
+ * own (a mapped file or a caller's buffer) is copied once into a buffer with
+ * room to grow, later edits only move the text after them
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} edit_offset - Index of the edit in the source
+ * @params {size_t} deleted_length - Number of bytes removed at edit_offset
+ * @params {const char*} inserted_text - Text inserted at edit_offset
+ * @params {size_t} inserted_length - Length of the inserted text in bytes
+ * @returns {void}
+ *
+ */
+void lexer_relex_source(lexer_t *lexer, size_t edit_offset,
+                        size_t deleted_length, const char *inserted_text,
+                        size_t inserted_length) {
+    DEBUG_ME;
+    size_t deleted_end = edit_offset + deleted_length;
+    size_t inserted_end = edit_offset + inserted_length;
+    size_t tail = lexer->source_length - deleted_end;
+    size_t length = lexer->source_length - deleted_length + inserted_length;
+
+    if (lexer->source_buffer == NULL || length + 1 > lexer->source_capacity) {
+        size_t capacity = (length + 1) * 2;
+        char *source = memory_allocate(capacity);
+
+        memcpy(source, lexer->source, edit_offset);
+        memcpy(source + inserted_end, lexer->source + deleted_end, tail);
+
+        if (lexer->source_buffer != NULL) {
+            memory_destroy(lexer->source_buffer);
+        }
+
+        lexer->source = lexer->source_buffer = source;
+        lexer->source_capacity = capacity;
+    } else {
+        memmove(lexer->source_buffer + inserted_end,
+                lexer->source_buffer + deleted_end, tail);
+    }
+
+    if (inserted_length > 0) {
+        memcpy(lexer->source_buffer + edit_offset, inserted_text,
+               inserted_length);
+    }
+
+    lexer->source_buffer[length] = '\0';
+    lexer->source_length = length;
+}
+
+/**
+ *
+ * @function lexer_relex_old_start
+ * @brief Get the start of a token lexed before an edit, in the source before
+ * the edit, once the source is edited (token_start reads the byte before a
+ * string, which moved if it was after the edit)
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Token lexed before the edit
+ * @params {size_t} edit_offset - Index of the edit in the source
+ * @params {size_t} deleted_length - Number of bytes removed at edit_offset
+ * @params {size_t} inserted_length - Number of bytes inserted at edit_offset
+ * @returns {size_t}
+ *
+ */
+size_t lexer_relex_old_start(lexer_t *lexer, token_t *token,
+                             size_t edit_offset, size_t deleted_length,
+                             size_t inserted_length) {
+    DEBUG_ME;
+    if (token->type != TOKEN_STRING || token->offset - 1 < edit_offset) {
+        return token_start(lexer, token);
+    }
+
+    // The opening quote was deleted, the string starts in the deleted text
+    // and only the tokens after it are compared
+    if (token->offset - 1 < edit_offset + deleted_length) {
+        return token->offset - 1;
+    }
+
+    token_t moved = *token;
+    moved.offset = (uint32_t)(token->offset - deleted_length + inserted_length);
 
-    LEXER_PUSH_TOKEN(token);
+    return token_start(lexer, &moved) - inserted_length + deleted_length;
 }
@@ -3,11 +3,15 @@
 
 #include <errno.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <wchar.h>
 
+#include "arena.h"
 #include "base.h"
 #include "file.h"
+#include "lexer_scan.h"
+#include "name_table.h"
 
 typedef struct {
     size_t index;
@@ -71,8 +75,12 @@ typedef struct {
     int code;             // -1 for non-char tokens
 } token_name_t;
 
+// Must be a power of two and larger than the number of keywords
+#define KEYWORD_TABLE_SIZE 64
+
 typedef struct {
-    size_t length;
+    size_t length;  // in characters
+    size_t size;    // in bytes
     token_type_t type;
     const char *name;     // upper case
     const char *keyword;  // end-user input
@@ -98,41 +106,49 @@ extern token_name_t token_names[];
  */
 extern const keyword_t keywords[];
 
-struct token_t;
+// Number of tokens the parser can look at before consuming them, a power of
+// two larger than the deepest lookahead (current and next token)
+#define LEXER_LOOKAHEAD_SIZE 4
 
-typedef struct token_t {
+// Tokens are plain values stored back to back in lexer->tokens. The text of
+// a token is not copied: offset and length point into lexer->source and the
+// value is decoded on demand (see token_value_stringify)
+typedef struct {
     token_type_t type;
-    location_t location;
-
-    token_type_t data_type;
-    union {
-        int number_int;
-        float number_float;
-        char *string;
-        bool boolean;
-    } data;
-
-    void (*print)(struct token_t *);
-    void (*destroy)(struct token_t *);
-    char *(*name)(token_type_t);
-    char *(*stringify)(struct token_t *);
-    char *(*value_stringify)(struct token_t *);
+    uint32_t offset;  // start of the token text in lexer->source
+    uint32_t length;  // length of the token text in bytes (0 for EOF)
+    uint32_t line;
+    uint32_t column;
 } token_t;
 
-#include "array.h"
-#include "array_custom.h"
-
 typedef struct {
     const char *file_path;  // NULL if source is REPL
-    char *source;
+    const char *source;  // not NUL-terminated, bounded by source_length
+    char *source_buffer;  // Copy of the source owned after lexer_relex
+    size_t source_capacity;  // Size of source_buffer in bytes
     size_t index;
     size_t line;
     size_t column;
     size_t source_length;
-    array_token_t *tokens;
-    size_t token_index;  // For parsing purposes
+    token_t *tokens;  // Only filled by lexer_lex
+    size_t tokens_length;
+    size_t tokens_capacity;
+    size_t tokens_lexed;  // Tokens pushed so far, in both modes
+    size_t token_index;   // For parsing purposes
+    bool streaming;       // Tokens are lexed on demand by lexer_peek
+    token_t lookahead[LEXER_LOOKAHEAD_SIZE];  // Ring of unconsumed tokens
+    size_t lookahead_start;
+    size_t lookahead_length;
+    token_t previous;  // Last consumed token
+    char *value;         // Scratch buffer for decoded token values
+    size_t value_capacity;
+    salam_arena_t *arena;  // Compilation unit: the lexer, the AST and its
+                           // strings, freed at once by lexer_destroy
 } lexer_t;
 
+#include "array.h"
+#include "array_custom.h"
+
 /**
  *
  * @function is_char_digit
@@ -143,15 +159,25 @@ typedef struct {
  */
 bool is_char_digit(char c);
 
+/**
+ *
+ * @function keyword_table_init
+ * @brief Fill keyword_table from the keywords array (runs once)
+ * @returns {void}
+ *
+ */
+void keyword_table_init();
+
 /**
  *
  * @function type_keyword
  * @brief Check if a string is a keyword then return the token type
- * @params {const char*} string - String
- * @returns {bool}
+ * @params {const char*} string - String (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the string in bytes
+ * @returns {token_type_t}
  *
  */
-token_type_t type_keyword(const char *string);
+token_type_t type_keyword(const char *string, size_t length);
 
 /**
  *
@@ -165,24 +191,39 @@ void location_print(location_t location);
 
 /**
  *
- * @function token_create
- * @brief Creating a new token
+ * @function lexer_push_token
+ * @brief Append a token to the token buffer of the lexer
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_type_t} type - Token type
- * @params {location_t} location - Token location
- * @returns {token_t*}
+ * @params {size_t} start - Index of the token text in source
+ * @params {size_t} end - Index just past the token text in source
+ * @returns {void}
  *
  */
-token_t *token_create(token_type_t type, location_t location);
+void lexer_push_token(lexer_t *lexer, token_type_t type, size_t start,
+                      size_t end);
 
 /**
  *
- * @function token_copy
- * @brief Copying a token
+ * @function token_start
+ * @brief Get the index where the lexer started a token, a string starts at
+ * its opening quote while its offset is the first byte of its body
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
- * @returns {token_t*}
+ * @returns {size_t}
  *
  */
-token_t *token_copy(token_t *token);
+size_t token_start(lexer_t *lexer, token_t *token);
+
+/**
+ *
+ * @function token_location
+ * @brief Get the location of a token
+ * @params {token_t*} token - Token
+ * @returns {location_t}
+ *
+ */
+location_t token_location(token_t *token);
 
 /**
  *
@@ -196,49 +237,65 @@ char *token_name(token_type_t type);
 
 /**
  *
- * @function token_value
- * @brief Get the value of a token
- * @params {token_t*} token -
- * @returns {char*}
+ * @function token_value_stringify
+ * @brief Get the value of a token, decoded from its slice of the source
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Token
+ * @returns {char*} - Valid until the next call
  *
  */
-char *token_value_stringify(token_t *token);
+char *token_value_stringify(lexer_t *lexer, token_t *token);
 
 /**
  *
- * @function token_destroy
- * @brief Destroying a token
- * @params {token_t*} token - Token
- * @returns {void}
+ * @function token_number_int
+ * @brief Get the value of an integer token
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Number token
+ * @returns {int}
  *
  */
-void token_destroy(token_t *token);
+int token_number_int(lexer_t *lexer, token_t *token);
+
+/**
+ *
+ * @function token_number_float
+ * @brief Get the value of a float token
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Number token
+ * @returns {float}
+ *
+ */
+float token_number_float(lexer_t *lexer, token_t *token);
 
 /**
  *
  * @function token_print
  * @brief Print a token
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
  * @returns {void}
  *
  */
-void token_print(token_t *token);
+void token_print(lexer_t *lexer, token_t *token);
 
 /**
  *
  * @function lexer_create
- * @brief Creating a new lexer state
+ * @brief Creating a new lexer state, with the arena of its compilation unit
  * @params {const char*} file_path - File path
- * @params {char*} source - Source code
+ * @params {const char*} source - Source code, not necessarily NUL-terminated
+ * @params {size_t} source_length - Length of the source in bytes
  * @returns {lexer_t*}
  *
  */
-lexer_t *lexer_create(const char *file_path, char *source);
+lexer_t *lexer_create(const char *file_path, const char *source,
+                      size_t source_length);
 
 /**
  *
  * @function lexer_destroy
- * @brief Destroying a lexer state
+ * @brief Destroying a lexer state and its arena, with the AST built in it
  * @params {lexer_t*} lexer - Lexer state
  * @returns {void}
  *
@@ -258,34 +315,134 @@ void lexer_debug(lexer_t *lexer);
 /**
  *
  * @function lexer_lex
- * @brief Lexing the source code
+ * @brief Lexing the whole source code into lexer->tokens, the parser then
+ * reads the buffer instead of lexing on demand
  * @params {lexer_t*} lexer - Lexer state
  * @returns {void}
  *
  */
 void lexer_lex(lexer_t *lexer);
 
+/**
+ *
+ * @function lexer_lex_token
+ * @brief Lexing the next token and pushing it, TOKEN_EOF is pushed at the end
+ * of the source (again on every later call)
+ * @params {lexer_t*} lexer - Lexer state
+ * @returns {bool} - False if TOKEN_EOF was pushed
+ *
+ */
+bool lexer_lex_token(lexer_t *lexer);
+
+/**
+ *
+ * @function lexer_peek
+ * @brief Get an unconsumed token, lexing it first if needed
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} offset - 0 for the current token, 1 for the next one
+ * (smaller than LEXER_LOOKAHEAD_SIZE)
+ * @returns {token_t*} - Valid until the token is consumed
+ *
+ */
+token_t *lexer_peek(lexer_t *lexer, size_t offset);
+
+/**
+ *
+ * @function lexer_next_token
+ * @brief Consume the current token
+ * @params {lexer_t*} lexer - Lexer state
+ * @returns {token_t*} - Consumed token, valid until the next call
+ *
+ */
+token_t *lexer_next_token(lexer_t *lexer);
+
+/**
+ *
+ * @function lexer_relex
+ * @brief Apply an edit to the source and update lexer->tokens by lexing again
+ * only from a token before the edit until the tokens match the old ones, the
+ * old tokens after that point are shifted. The restart token is found by a
+ * binary search and the source is edited in place, so beyond the tokens lexed
+ * again an edit costs a move of the text and tokens after it
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} edit_offset - Index of the edit in the source
+ * @params {size_t} deleted_length - Number of bytes removed at edit_offset
+ * @params {const char*} inserted_text - Text inserted at edit_offset
+ * @returns {void}
+ *
+ */
+void lexer_relex(lexer_t *lexer, size_t edit_offset, size_t deleted_length,
+                 const char *inserted_text);
+
+/**
+ *
+ * @function lexer_relex_restart
+ * @brief Find the number of tokens starting before an index, by a binary
+ * search as token starts are sorted
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} index - Index in the source
+ * @returns {size_t}
+ *
+ */
+size_t lexer_relex_restart(lexer_t *lexer, size_t index);
+
+/**
+ *
+ * @function lexer_relex_source
+ * @brief Apply an edit to the source in place. A source the lexer does not
+ * own (a mapped file or a caller's buffer) is copied once into a buffer with
+ * room to grow, later edits only move the text after them
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {size_t} edit_offset - Index of the edit in the source
+ * @params {size_t} deleted_length - Number of bytes removed at edit_offset
+ * @params {const char*} inserted_text - Text inserted at edit_offset
+ * @params {size_t} inserted_length - Length of the inserted text in bytes
+ * @returns {void}
+ *
+ */
+void lexer_relex_source(lexer_t *lexer, size_t edit_offset,
+                        size_t deleted_length, const char *inserted_text,
+                        size_t inserted_length);
+
+/**
+ *
+ * @function lexer_relex_old_start
+ * @brief Get the start of a token lexed before an edit, in the source before
+ * the edit, once the source is edited (token_start reads the byte before a
+ * string, which moved if it was after the edit)
+ * @params {lexer_t*} lexer - Lexer state
+ * @params {token_t*} token - Token lexed before the edit
+ * @params {size_t} edit_offset - Index of the edit in the source
+ * @params {size_t} deleted_length - Number of bytes removed at edit_offset
+ * @params {size_t} inserted_length - Number of bytes inserted at edit_offset
+ * @returns {size_t}
+ *
+ */
+size_t lexer_relex_old_start(lexer_t *lexer, token_t *token,
+                             size_t edit_offset, size_t deleted_length,
+                             size_t inserted_length);
+
 /**
  *
  * @function lexer_lex_identifier
  * @brief Lexing an identifier
  * @params {lexer_t*} lexer - Lexer state
- * @params {char} uc - UTF8 character
+ * @params {size_t} start - Index of the first character (already consumed)
  * @returns {void}
  *
  */
-void lexer_lex_identifier(lexer_t *lexer, char *uc);
+void lexer_lex_identifier(lexer_t *lexer, size_t start);
 
 /**
  *
  * @function lexer_lex_number
  * @brief Lexing a number
  * @params {lexer_t*} lexer - Lexer state
- * @params {char*} uc - UTF8 character
+ * @params {size_t} start - Index of the first digit (already consumed)
  * @returns {void}
  *
  */
-void lexer_lex_number(lexer_t *lexer, char *uc);
+void lexer_lex_number(lexer_t *lexer, size_t start);
 
 /**
  *
@@ -323,11 +480,12 @@ char *location_stringify(location_t location);
  *
  * @function token_stringify
  * @brief Get the name & value & location of a token as a string
+ * @params {lexer_t*} lexer - Lexer state
  * @params {token_t*} token - Token
  * @returns {char*} - String representation of the token
  *
  */
-char *token_stringify(token_t *token);
+char *token_stringify(lexer_t *lexer, token_t *token);
 
 /**
  *
@@ -443,14 +601,16 @@ bool string_is_float(const char *value);
 
 /**
  *
- * @function utf8_char_length
- * @brief Get the UTF-8 character and return the length
- * @params {char*} source - Source code
+ * @function char_utf8_decode
+ * @brief Decode the UTF-8 character at index in place and advance past it
+ * @params {const char*} source - Source code
+ * @params {size_t} length - Length of the source in bytes
  * @params {size_t*} index - Index of the current character in source string
- * @params {size_t*} num_bytes - Number of bytes
- * @returns {int}
+ * @params {size_t*} num_bytes - Number of bytes (can be NULL)
+ * @returns {uint32_t} Unicode codepoint
  *
  */
-char *char_utf8_decode(char *source, size_t *index, size_t *num_bytes);
+uint32_t char_utf8_decode(const char *source, size_t length, size_t *index,
+                          size_t *num_bytes);
 
 #endif
@@ -0,0 +1,215 @@
+#include "lexer_scan.h"
+
+/**
+ *
+ * @function lexer_scan_is_blank
+ * @brief Check if a byte is a whitespace other than the new line
+ * @params {char} c - Byte
+ * @returns {bool}
+ *
+ */
+bool lexer_scan_is_blank(char c) {
+    DEBUG_ME;
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ *
+ * @function lexer_scan_blanks
+ * @brief Skip a run of spaces, tabs, carriage returns, vertical tabs and form
+ * feeds (new lines are left to the lexer, which counts them)
+ * @params {const char*} source - Source code
+ * @params {size_t} index - Index to start from
+ * @params {size_t} length - Length of the source in bytes
+ * @returns {size_t} Index of the first other byte, or length
+ *
+ */
+size_t lexer_scan_blanks(const char *source, size_t index, size_t length) {
+    DEBUG_ME;
+#if defined(LEXER_SCAN_AVX2)
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i carriage = _mm256_set1_epi8('\r');
+    const __m256i vertical = _mm256_set1_epi8('\v');
+    const __m256i feed = _mm256_set1_epi8('\f');
+
+    while (index + LEXER_SCAN_STRIDE <= length) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i *)(source + index));
+        __m256i blank = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, space),
+                            _mm256_cmpeq_epi8(chunk, tab)),
+            _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, carriage),
+                                _mm256_cmpeq_epi8(chunk, vertical)),
+                _mm256_cmpeq_epi8(chunk, feed)));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(blank);
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+
+        index += LEXER_SCAN_STRIDE;
+    }
+#elif defined(LEXER_SCAN_SSE2)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i carriage = _mm_set1_epi8('\r');
+    const __m128i vertical = _mm_set1_epi8('\v');
+    const __m128i feed = _mm_set1_epi8('\f');
+
+    while (index + LEXER_SCAN_STRIDE <= length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(source + index));
+        __m128i blank = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, space),
+                         _mm_cmpeq_epi8(chunk, tab)),
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, carriage),
+                                      _mm_cmpeq_epi8(chunk, vertical)),
+                         _mm_cmpeq_epi8(chunk, feed)));
+        uint32_t mask = ~(uint32_t)_mm_movemask_epi8(blank) & 0xFFFF;
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+
+        index += LEXER_SCAN_STRIDE;
+    }
+#elif defined(LEXER_SCAN_WASM)
+    const v128_t space = wasm_i8x16_splat(' ');
+    const v128_t tab = wasm_i8x16_splat('\t');
+    const v128_t carriage = wasm_i8x16_splat('\r');
+    const v128_t vertical = wasm_i8x16_splat('\v');
+    const v128_t feed = wasm_i8x16_splat('\f');
+
+    while (index + LEXER_SCAN_STRIDE <= length) {
+        v128_t chunk = wasm_v128_load(source + index);
+        v128_t blank = wasm_v128_or(
+            wasm_v128_or(wasm_i8x16_eq(chunk, space),
+                         wasm_i8x16_eq(chunk, tab)),
+            wasm_v128_or(wasm_v128_or(wasm_i8x16_eq(chunk, carriage),
+                                      wasm_i8x16_eq(chunk, vertical)),
+                         wasm_i8x16_eq(chunk, feed)));
+        uint32_t mask = ~(uint32_t)wasm_i8x16_bitmask(blank) & 0xFFFF;
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+
+        index += LEXER_SCAN_STRIDE;
+    }
+#endif
+
+    while (index < length && lexer_scan_is_blank(source[index])) {
+        index++;
+    }
+
+    return index;
+}
+
+/**
+ *
+ * @function lexer_scan_byte
+ * @brief Find the next occurrence of a byte
+ * @params {const char*} source - Source code
+ * @params {size_t} index - Index to start from
+ * @params {size_t} length - Length of the source in bytes
+ * @params {unsigned char} byte - Byte to find
+ * @returns {size_t} Index of the byte, or length
+ *
+ */
+size_t lexer_scan_byte(const char *source, size_t index, size_t length,
+                       unsigned char byte) {
+    DEBUG_ME;
+#if defined(LEXER_SCAN_AVX2)
+    const __m256i needle = _mm256_set1_epi8((char)byte);
+
+    while (index + LEXER_SCAN_STRIDE <= length) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i *)(source + index));
+        uint32_t mask =
+            (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle));
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+
+        index += LEXER_SCAN_STRIDE;
+    }
+#elif defined(LEXER_SCAN_SSE2)
+    const __m128i needle = _mm_set1_epi8((char)byte);
+
+    while (index + LEXER_SCAN_STRIDE <= length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(source + index));
+        uint32_t mask =
+            (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+
+        index += LEXER_SCAN_STRIDE;
+    }
+#elif defined(LEXER_SCAN_WASM)
+    const v128_t needle = wasm_i8x16_splat((char)byte);
+
+    while (index + LEXER_SCAN_STRIDE <= length) {
+        v128_t chunk = wasm_v128_load(source + index);
+        uint32_t mask =
+            (uint32_t)wasm_i8x16_bitmask(wasm_i8x16_eq(chunk, needle));
+
+        if (mask != 0) {
+            return index + __builtin_ctz(mask);
+        }
+
+        index += LEXER_SCAN_STRIDE;
+    }
+#endif
+
+    while (index < length && (unsigned char)source[index] != byte) {
+        index++;
+    }
+
+    return index;
+}
+
+/**
+ *
+ * @function lexer_scan_string_end
+ * @brief Find the closing quote of a string body
+ * @params {const char*} source - Source code
+ * @params {size_t} index - Index of the first byte of the body
+ * @params {size_t} length - Length of the source in bytes
+ * @params {uint32_t} closing - Closing quote ('"', U+00BB or U+201D)
+ * @returns {size_t} Index of the first byte of the closing quote, or length
+ *
+ */
+size_t lexer_scan_string_end(const char *source, size_t index, size_t length,
+                             uint32_t closing) {
+    DEBUG_ME;
+    const unsigned char *bytes = (const unsigned char *)source;
+    size_t start = index;
+
+    // The last byte of a quote is searched, then the bytes before it are
+    // checked: "»" is C2 BB and "”" is E2 80 9D in UTF-8
+    unsigned char last = 0x22;
+    size_t before = 0;
+
+    if (closing == 0x00BB) {
+        last = 0xBB;
+        before = 1;
+    } else if (closing == 0x201D) {
+        last = 0x9D;
+        before = 2;
+    }
+
+    while ((index = lexer_scan_byte(source, index, length, last)) < length) {
+        if (index - start >= before &&
+            (before == 0 || (before == 1 && bytes[index - 1] == 0xC2) ||
+             (before == 2 && bytes[index - 2] == 0xE2 &&
+              bytes[index - 1] == 0x80))) {
+            return index - before;
+        }
+
+        index++;
+    }
+
+    return length;
+}
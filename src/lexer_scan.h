@@ -0,0 +1,80 @@
+#ifndef _LEXER_SCAN_H_
+#define _LEXER_SCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "base.h"
+
+// The widest kernel the compiler targets is used, the scalar loop handles the
+// tail of the input and builds without SIMD
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LEXER_SCAN_AVX2
+#define LEXER_SCAN_STRIDE 32
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define LEXER_SCAN_SSE2
+#define LEXER_SCAN_STRIDE 16
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define LEXER_SCAN_WASM
+#define LEXER_SCAN_STRIDE 16
+#else
+#define LEXER_SCAN_SCALAR
+#define LEXER_SCAN_STRIDE 1
+#endif
+
+/**
+ *
+ * @function lexer_scan_is_blank
+ * @brief Check if a byte is a whitespace other than the new line
+ * @params {char} c - Byte
+ * @returns {bool}
+ *
+ */
+bool lexer_scan_is_blank(char c);
+
+/**
+ *
+ * @function lexer_scan_blanks
+ * @brief Skip a run of spaces, tabs, carriage returns, vertical tabs and form
+ * feeds (new lines are left to the lexer, which counts them)
+ * @params {const char*} source - Source code
+ * @params {size_t} index - Index to start from
+ * @params {size_t} length - Length of the source in bytes
+ * @returns {size_t} Index of the first other byte, or length
+ *
+ */
+size_t lexer_scan_blanks(const char *source, size_t index, size_t length);
+
+/**
+ *
+ * @function lexer_scan_byte
+ * @brief Find the next occurrence of a byte
+ * @params {const char*} source - Source code
+ * @params {size_t} index - Index to start from
+ * @params {size_t} length - Length of the source in bytes
+ * @params {unsigned char} byte - Byte to find
+ * @returns {size_t} Index of the byte, or length
+ *
+ */
+size_t lexer_scan_byte(const char *source, size_t index, size_t length,
+                       unsigned char byte);
+
+/**
+ *
+ * @function lexer_scan_string_end
+ * @brief Find the closing quote of a string body
+ * @params {const char*} source - Source code
+ * @params {size_t} index - Index of the first byte of the body
+ * @params {size_t} length - Length of the source in bytes
+ * @params {uint32_t} closing - Closing quote ('"', U+00BB or U+201D)
+ * @returns {size_t} Index of the first byte of the closing quote, or length
+ *
+ */
+size_t lexer_scan_string_end(const char *source, size_t index, size_t length,
+                             uint32_t closing);
+
+#endif
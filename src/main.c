@@ -1,25 +1,92 @@
 #include "main.h"
 
+/**
+ *
+ * @function options_parse
+ * @brief Parsing and removing the options from the command line arguments
+ * @params {int} argc - Number of arguments
+ * @params {char**} argv - Array of arguments
+ * @params {salam_options_t*} options - Options to fill
+ * @returns {int} - Number of arguments left
+ *
+ */
+int options_parse(int argc, char **argv, salam_options_t *options) {
+    DEBUG_ME;
+    int length = 1;
+
+    options->repeat_limit = GENERATOR_REPEAT_LIMIT;
+    options->atomic_css = false;
+    options->minify = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+
+        if (strncmp(arg, "--", 2) != 0) {
+            argv[length++] = argv[i];
+        } else if (strncmp(arg, "--repeat-limit=", 15) == 0) {
+            number_scan_t scan;
+
+            if (!number_scan_string(arg + 15, NUMBER_SCAN_NONE, &scan) ||
+                scan.kind != NUMBER_KIND_INTEGER || scan.integer < 1) {
+                error(1, "Option --repeat-limit must be a positive integer\n");
+            }
+
+            options->repeat_limit = (size_t)scan.integer;
+        } else if (strcmp(arg, "--css=atomic") == 0) {
+            options->atomic_css = true;
+        } else if (strcmp(arg, "--css=block") == 0) {
+            options->atomic_css = false;
+        } else if (strcmp(arg, "--minify") == 0) {
+            options->minify = true;
+        } else {
+            error(1, "Unknown option: %s\n", arg);
+        }
+    }
+
+    argv[length] = NULL;
+
+    return length;
+}
+
+/**
+ *
+ * @function options_apply
+ * @brief Applying the options to a generator
+ * @params {salam_options_t*} options - Options
+ * @params {generator_t*} generator - Generator
+ * @returns {void}
+ *
+ */
+void options_apply(salam_options_t *options, generator_t *generator) {
+    DEBUG_ME;
+    generator->repeat_limit = options->repeat_limit;
+    generator->atomicCSS = options->atomic_css;
+    generator->minify = options->minify;
+}
+
 /**
  *
  * @function lint
  * @brief Linting the given content and parameters
  * @params {bool} isCode - Whether the content is code or file
  * @params {const char*} path - Path of the file
- * @params {char*} content - Content of the file
+ * @params {const char*} content - Content of the file
+ * @params {size_t} length - Length of the content in bytes
  * @params {char*} build_file - Build file
+ * @params {salam_options_t*} options - Options
  * @returns {void}
  *
  */
-void lint(bool isCode, const char *path, char *content, char *build_file) {
-    lexer_t *lexer = lexer_create(path, content);
-
-    lexer_lex(lexer);
+void lint(bool isCode, const char *path, const char *content, size_t length,
+          char *build_file, salam_options_t *options) {
+    lexer_t *lexer = lexer_create(path, content, length);
 
     ast_t *ast = parser_parse(lexer);
 
     generator_t *generator = generator_create(ast);
 
+    options_apply(options, generator);
+
     generator_code(generator);
 
     string_t *cleaned_code = generator_salam(ast);
@@ -43,32 +110,76 @@ void lint(bool isCode, const char *path, char *content, char *build_file) {
     lexer_destroy(lexer);
 }
 
+/**
+ *
+ * @function compile_ast
+ * @brief Compiling the given file to a precompiled AST (.salamc), which can
+ * be run or included later without lexing and parsing it again
+ * @params {const char*} path - Path of the file
+ * @params {const char*} content - Content of the file
+ * @params {size_t} length - Length of the content in bytes
+ * @params {char*} build_file - Build file
+ * @returns {void}
+ *
+ */
+void compile_ast(const char *path, const char *content, size_t length,
+                 char *build_file) {
+    lexer_t *lexer = lexer_create(path, content, length);
+
+    ast_t *ast = parser_parse(lexer);
+
+    if (!ast_binary_save(ast, build_file)) {
+        error(1, "Could not write the precompiled AST to '%s'\n", build_file);
+    }
+
+    ast_destroy(ast);
+
+    lexer_destroy(lexer);
+
+    printf("END SUCCESS\n");
+}
+
 /**
  *
  * @function run
  * @brief Running the compiler with the given content and parameters
  * @params {bool} isCode - Whether the content is code or file
  * @params {const char*} path - Path of the file
- * @params {char*} content - Content of the file
+ * @params {const char*} content - Content of the file
+ * @params {size_t} length - Length of the content in bytes
  * @params {char*} build_dir - Build directory
+ * @params {salam_options_t*} options - Options
  * @returns {void}
  *
  */
-void run(bool isCode, const char *path, char *content, char *build_dir) {
-    lexer_t *lexer = lexer_create(path, content);
+void run(bool isCode, const char *path, const char *content, size_t length,
+         char *build_dir, salam_options_t *options) {
+    lexer_t *lexer = NULL;
+    salam_arena_t *arena = NULL;
+    ast_t *ast = NULL;
+
+    if (!isCode && ast_binary_is_path(path)) {
+        arena = salam_arena_create(0);
+        ast = ast_binary_load(arena, path, content, length);
+    } else {
+        lexer = lexer_create(path, content, length);
 
-    lexer_lex(lexer);
+        // The parser lexes tokens on demand, lexer_debug and lexer_save need
+        // the whole token buffer from lexer_lex(lexer)
 
-    // lexer_debug(lexer);
+        // lexer_debug(lexer);
 
-    // lexer_save(lexer, "tokens.txt");
+        // lexer_save(lexer, "tokens.txt");
 
-    ast_t *ast = parser_parse(lexer);
+        ast = parser_parse(lexer);
+    }
 
     // ast_debug(ast);
 
     generator_t *generator = generator_create(ast);
 
+    options_apply(options, generator);
+
     if (isCode == false && build_dir != NULL) {
         string_set_str(generator->output_dir, build_dir);
     }
@@ -84,9 +195,10 @@ void run(bool isCode, const char *path, char *content, char *build_dir) {
 
     if (isCode == true) {
         if (build_dir == NULL) {
-            printf("%s\n", generator->html->data);
+            generator_write_html(generator, stdout);
+            printf("\n");
         } else {
-            file_writes(build_dir, generator->html->data);
+            generator_save_html(generator, build_dir);
         }
     } else {
         generator_save(generator, "index.html", "style.css", "script.js");
@@ -98,11 +210,67 @@ void run(bool isCode, const char *path, char *content, char *build_dir) {
 
     lexer_destroy(lexer);
 
+    salam_arena_destroy(arena);
+
     if (!isCode) {
         printf("END SUCCESS\n");
     }
 }
 
+/**
+ *
+ * @function deps
+ * @brief Printing the files included by the given file, directly or through
+ * other files, as a make rule for build systems
+ * @params {const char*} path - Path of the file
+ * @params {const char*} content - Content of the file
+ * @params {size_t} length - Length of the content in bytes
+ * @params {char*} build_file - Build file (can be NULL for stdout)
+ * @params {salam_options_t*} options - Options
+ * @returns {void}
+ *
+ */
+void deps(const char *path, const char *content, size_t length,
+          char *build_file, salam_options_t *options) {
+    lexer_t *lexer = NULL;
+    salam_arena_t *arena = NULL;
+    ast_t *ast = NULL;
+
+    if (ast_binary_is_path(path)) {
+        arena = salam_arena_create(0);
+        ast = ast_binary_load(arena, path, content, length);
+    } else {
+        lexer = lexer_create(path, content, length);
+        ast = parser_parse(lexer);
+    }
+
+    // The includes are only known once the layout is generated
+    generator_t *generator = generator_create(ast);
+
+    options_apply(options, generator);
+
+    generator_code(generator);
+
+    string_t *rule =
+        generator_includes_dependencies(generator->includes, path);
+
+    if (build_file != NULL) {
+        file_writes(build_file, rule->data);
+    } else {
+        printf("%s", rule->data);
+    }
+
+    string_destroy(rule);
+
+    generator_destroy(generator);
+
+    ast_destroy(ast);
+
+    lexer_destroy(lexer);
+
+    salam_arena_destroy(arena);
+}
+
 /**
  *
  * @function help
@@ -128,6 +296,25 @@ void help(char *app) {
     printf("%s lint <filename> <output_dir>    # Lint a Salam script\n", app);
     printf("%s lint code <content>             # Lint Salam code\n", app);
     printf("\n");
+    printf(
+        "%s compile-ast <filename> <output> # Precompile a Salam script "
+        "to .salamc\n",
+        app);
+    printf(
+        "%s deps <filename> <output>        # List the files included by a "
+        "Salam script\n",
+        app);
+    printf("\n");
+    printf(
+        "--repeat-limit=<count>                  # Highest 'repeat' value "
+        "(default %d)\n",
+        GENERATOR_REPEAT_LIMIT);
+    printf(
+        "--css=atomic                            # One shared class per CSS "
+        "declaration\n");
+    printf(
+        "--minify                                # Minify the generated "
+        "HTML, CSS and JS\n");
     printf(
         "%s version                         # Print the version of "
         "Salam\n",
@@ -157,6 +344,10 @@ void help(char *app) {
  */
 void doargs(int argc, char **argv) {
     DEBUG_ME;
+    salam_options_t options;
+
+    argc = options_parse(argc, argv, &options);
+
     if (argc < 2) {
         help(argv[0]);
     }
@@ -210,7 +401,7 @@ void doargs(int argc, char **argv) {
 
             char *content = argv[3];
 
-            lint(true, "stdin", content, NULL);
+            lint(true, "stdin", content, strlen(content), NULL, &options);
         } else {
             if (!file_exists(argv[2])) {
                 error(1, "File does not exist: %s\n", argv[2]);
@@ -220,14 +411,49 @@ void doargs(int argc, char **argv) {
                 error(1, "Usage: %s lint <file> <output>\n", argv[0]);
             }
 
-            char *content = file_reads_binary(path, NULL);
+            file_map_t *content = file_map(path);
 
             char *output_file = argv[3];
 
-            lint(false, path, content, output_file);
+            lint(false, path, content->data, content->size, output_file,
+                 &options);
 
-            memory_destroy(content);
+            file_unmap(content);
+        }
+    } else if (strcmp(path, "compile-ast") == 0) {
+        if (argc <= 3) {
+            error(1, "Usage: %s compile-ast <file> <output>\n", argv[0]);
         }
+
+        if (!file_exists(argv[2])) {
+            error(1, "File does not exist: %s\n", argv[2]);
+        }
+
+        file_map_t *content = file_map(argv[2]);
+
+        compile_ast(argv[2], content->data, content->size, argv[3]);
+
+        file_unmap(content);
+    } else if (strcmp(path, "deps") == 0) {
+        if (argc <= 2) {
+            error(1, "Usage: %s deps <file> <output>\n", argv[0]);
+        }
+
+        if (!file_exists(argv[2])) {
+            error(1, "File does not exist: %s\n", argv[2]);
+        }
+
+        file_map_t *content = file_map(argv[2]);
+
+        char *output_file = NULL;
+
+        if (argc >= 4) {
+            output_file = argv[3];
+        }
+
+        deps(argv[2], content->data, content->size, output_file, &options);
+
+        file_unmap(content);
     } else if (strcmp(path, "code") == 0) {
         if (argc <= 2) {
             error(1, "Usage: %s code <content>\n", argv[0]);
@@ -237,13 +463,13 @@ void doargs(int argc, char **argv) {
 
         char *output_dir = argv[3];
 
-        run(true, "stdin", content, output_dir);
+        run(true, "stdin", content, strlen(content), output_dir, &options);
     } else {
         if (!file_exists(path)) {
             error(1, "File does not exist: %s\n", path);
         }
 
-        char *content = file_reads_binary(path, NULL);
+        file_map_t *content = file_map(path);
 
         char *output_dir = NULL;
 
@@ -251,9 +477,9 @@ void doargs(int argc, char **argv) {
             output_dir = argv[2];
         }
 
-        run(false, path, content, output_dir);
+        run(false, path, content->data, content->size, output_dir, &options);
 
-        memory_destroy(content);
+        file_unmap(content);
     }
 }
 
@@ -274,6 +500,8 @@ int main(int argc, char **argv) {
 
     doargs(argc, argv);
 
+    salam_intern_global_destroy();
+
     // #ifdef __EMSCRIPTEN__
     //     emscripten_force_exit(0);
     // #endif
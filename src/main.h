@@ -9,15 +9,24 @@
 
 #include "array.h"
 #include "ast.h"
+#include "ast_binary.h"
 #include "base.h"
 #include "downloader.h"
 #include "file.h"
 #include "generator.h"
 #include "generator_salam.h"
+#include "intern.h"
 #include "lexer.h"
 #include "log.h"
 #include "memory.h"
 #include "parser.h"
 #include "validator.h"
 
+// Options given as --name=value anywhere in the arguments
+typedef struct salam_options_t {
+    size_t repeat_limit;  // see generator_t
+    bool atomic_css;  // --css=atomic, see generator_t
+    bool minify;  // --minify, see generator_t
+} salam_options_t;
+
 #endif
@@ -0,0 +1,98 @@
+#include "name_table.h"
+
+/**
+ *
+ * @function name_table_hash
+ * @brief FNV-1a hash of a name
+ * @params {const char*} name - Name (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the name in bytes
+ * @returns {uint32_t}
+ *
+ */
+uint32_t name_table_hash(const char *name, size_t length) {
+    DEBUG_ME;
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ *
+ * @function name_table_build
+ * @brief Fill the slots of a name table from its entries, the first entry of a
+ * duplicated name wins (same as the old if/else-if chains)
+ * @params {name_table_t*} table - Name table
+ * @returns {void}
+ *
+ */
+void name_table_build(name_table_t *table) {
+    DEBUG_ME;
+    for (size_t i = 0; i < table->entries_length; i++) {
+        const name_table_entry_t *entry = &table->entries[i];
+        size_t slot = name_table_hash(entry->name, entry->length) &
+                      (NAME_TABLE_CAPACITY - 1);
+        bool duplicate = false;
+
+        while (table->slots[slot] != 0) {
+            const name_table_entry_t *other =
+                &table->entries[table->slots[slot] - 1];
+
+            if (other->length == entry->length &&
+                memcmp(other->name, entry->name, entry->length) == 0) {
+                duplicate = true;
+                break;
+            }
+
+            slot = (slot + 1) & (NAME_TABLE_CAPACITY - 1);
+        }
+
+        if (!duplicate) {
+            table->slots[slot] = (uint16_t)(i + 1);
+        }
+    }
+
+    table->ready = true;
+}
+
+/**
+ *
+ * @function name_table_find
+ * @brief Find the type of a name with one hash and one compare
+ * @params {name_table_t*} table - Name table
+ * @params {const char*} name - Name (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the name in bytes
+ * @params {int} not_found - Value to return if the name is unknown
+ * @returns {int} type
+ *
+ */
+int name_table_find(name_table_t *table, const char *name, size_t length,
+                    int not_found) {
+    DEBUG_ME;
+    if (name == NULL) {
+        return not_found;
+    }
+
+    if (!table->ready) {
+        name_table_build(table);
+    }
+
+    size_t slot = name_table_hash(name, length) & (NAME_TABLE_CAPACITY - 1);
+
+    while (table->slots[slot] != 0) {
+        const name_table_entry_t *entry =
+            &table->entries[table->slots[slot] - 1];
+
+        if (entry->length == length && memcmp(entry->name, name, length) == 0) {
+            return entry->type;
+        }
+
+        slot = (slot + 1) & (NAME_TABLE_CAPACITY - 1);
+    }
+
+    return not_found;
+}
@@ -0,0 +1,71 @@
+#ifndef _NAME_TABLE_H_
+#define _NAME_TABLE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "base.h"
+
+// Must be a power of two and at least twice the largest table
+#define NAME_TABLE_CAPACITY 1024
+
+typedef struct {
+    const char *name;
+    size_t length;  // in bytes
+    int type;
+} name_table_entry_t;
+
+typedef struct {
+    const name_table_entry_t *entries;
+    size_t entries_length;
+
+    bool ready;
+    uint16_t slots[NAME_TABLE_CAPACITY];  // index + 1, 0 = empty
+} name_table_t;
+
+// Both macros are meant to be used from X-macro expansions, so the byte length
+// of each name is computed by the compiler
+#define NAME_TABLE_ENTRY(NAME, TYPE) {NAME, sizeof(NAME) - 1, TYPE},
+
+#define NAME_TABLE_INIT(ENTRIES) \
+    {ENTRIES, sizeof(ENTRIES) / sizeof(ENTRIES[0]), false, {0}}
+
+/**
+ *
+ * @function name_table_hash
+ * @brief FNV-1a hash of a name
+ * @params {const char*} name - Name (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the name in bytes
+ * @returns {uint32_t}
+ *
+ */
+uint32_t name_table_hash(const char *name, size_t length);
+
+/**
+ *
+ * @function name_table_build
+ * @brief Fill the slots of a name table from its entries, the first entry of a
+ * duplicated name wins (same as the old if/else-if chains)
+ * @params {name_table_t*} table - Name table
+ * @returns {void}
+ *
+ */
+void name_table_build(name_table_t *table);
+
+/**
+ *
+ * @function name_table_find
+ * @brief Find the type of a name with one hash and one compare
+ * @params {name_table_t*} table - Name table
+ * @params {const char*} name - Name (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the name in bytes
+ * @params {int} not_found - Value to return if the name is unknown
+ * @returns {int} type
+ *
+ */
+int name_table_find(name_table_t *table, const char *name, size_t length,
+                    int not_found);
+
+#endif
@@ -0,0 +1,232 @@
+#include "name_trie.h"
+
+/**
+ *
+ * @function name_trie_slot
+ * @brief Get the first slot to probe for an edge
+ * @params {size_t} parent - Node
+ * @params {char} separator - Separator before the word
+ * @params {const char*} word - Word (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the word in bytes
+ * @returns {size_t}
+ *
+ */
+size_t name_trie_slot(size_t parent, char separator, const char *word,
+                      size_t length) {
+    DEBUG_ME;
+    uint32_t hash = name_table_hash(word, length);
+
+    hash ^= (uint32_t)parent * 2654435761u;
+    hash ^= (unsigned char)separator;
+
+    return hash & (NAME_TRIE_CAPACITY - 1);
+}
+
+/**
+ *
+ * @function name_trie_init
+ * @brief Empty a name trie, keeping only its root
+ * @params {name_trie_t*} trie - Name trie
+ * @returns {void}
+ *
+ */
+void name_trie_init(name_trie_t *trie) {
+    DEBUG_ME;
+    memset(trie->slots, 0, sizeof(trie->slots));
+
+    name_trie_node_t *root = &trie->nodes[0];
+    root->parent = 0;
+    root->separator = NAME_TRIE_NO_SEPARATOR;
+    root->word = "";
+    root->word_length = 0;
+    root->name = NULL;
+    for (size_t kind = 0; kind < NAME_TRIE_KINDS; kind++) {
+        root->types[kind] = -1;
+    }
+    root->suffixed = false;
+
+    trie->nodes_length = 1;
+    trie->ready = true;
+}
+
+/**
+ *
+ * @function name_trie_child
+ * @brief Follow the edge of a word from a node
+ * @params {const name_trie_t*} trie - Name trie
+ * @params {size_t} parent - Node
+ * @params {char} separator - ' ' or '-' before the word,
+ * NAME_TRIE_NO_SEPARATOR for the first word
+ * @params {const char*} word - Word (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the word in bytes
+ * @returns {size_t} Child node, 0 if there is no such edge
+ *
+ */
+size_t name_trie_child(const name_trie_t *trie, size_t parent, char separator,
+                       const char *word, size_t length) {
+    DEBUG_ME;
+    size_t slot = name_trie_slot(parent, separator, word, length);
+
+    while (trie->slots[slot] != 0) {
+        const name_trie_node_t *node = &trie->nodes[trie->slots[slot]];
+
+        if (node->parent == parent && node->separator == separator &&
+            node->word_length == length &&
+            memcmp(node->word, word, length) == 0) {
+            return trie->slots[slot];
+        }
+
+        slot = (slot + 1) & (NAME_TRIE_CAPACITY - 1);
+    }
+
+    return 0;
+}
+
+/**
+ *
+ * @function name_trie_add_child
+ * @brief Follow the edge of a word from a node, adding it if needed
+ * @params {name_trie_t*} trie - Name trie
+ * @params {size_t} parent - Node
+ * @params {char} separator - Separator before the word
+ * @params {const char*} word - Word, must outlive the trie
+ * @params {size_t} length - Length of the word in bytes
+ * @returns {size_t} Child node
+ *
+ */
+size_t name_trie_add_child(name_trie_t *trie, size_t parent, char separator,
+                           const char *word, size_t length) {
+    DEBUG_ME;
+    size_t child = name_trie_child(trie, parent, separator, word, length);
+    if (child != 0) {
+        return child;
+    }
+
+    if (trie->nodes_length >= NAME_TRIE_MAX_NODES) {
+        panic("Name trie is full, increase NAME_TRIE_MAX_NODES");
+    }
+
+    child = trie->nodes_length++;
+
+    name_trie_node_t *node = &trie->nodes[child];
+    node->parent = (uint16_t)parent;
+    node->separator = separator;
+    node->word = word;
+    node->word_length = length;
+    node->name = NULL;
+    for (size_t kind = 0; kind < NAME_TRIE_KINDS; kind++) {
+        node->types[kind] = -1;
+    }
+    node->suffixed = false;
+
+    size_t slot = name_trie_slot(parent, separator, word, length);
+    while (trie->slots[slot] != 0) {
+        slot = (slot + 1) & (NAME_TRIE_CAPACITY - 1);
+    }
+    trie->slots[slot] = (uint16_t)child;
+
+    return child;
+}
+
+/**
+ *
+ * @function name_trie_add
+ * @brief Add a name split into words at ' ' and '-', if a name is added twice
+ * for a kind the first type wins (same as name_table_find)
+ * @params {name_trie_t*} trie - Name trie
+ * @params {const char*} name - NUL-terminated name, must outlive the trie
+ * @params {int} kind - Kind, smaller than NAME_TRIE_KINDS
+ * @params {int} type - Type of the name for this kind
+ * @returns {size_t} Node of the end of the name, 0 for an empty name
+ *
+ */
+size_t name_trie_add(name_trie_t *trie, const char *name, int kind, int type) {
+    DEBUG_ME;
+    if (!trie->ready) {
+        name_trie_init(trie);
+    }
+
+    if (name == NULL || name[0] == '\0') {
+        return 0;
+    }
+
+    size_t node = 0;
+    char separator = NAME_TRIE_NO_SEPARATOR;
+    const char *word = name;
+
+    for (const char *c = name;; c++) {
+        if (*c == ' ' || *c == '-' || *c == '\0') {
+            node = name_trie_add_child(trie, node, separator, word,
+                                       (size_t)(c - word));
+
+            if (*c == '\0') {
+                break;
+            }
+
+            separator = *c;
+            word = c + 1;
+        }
+    }
+
+    if (trie->nodes[node].types[kind] == -1) {
+        trie->nodes[node].types[kind] = type;
+    }
+    if (trie->nodes[node].name == NULL) {
+        trie->nodes[node].name = name;
+    }
+
+    return node;
+}
+
+/**
+ *
+ * @function name_trie_add_table
+ * @brief Add every name of a name table
+ * @params {name_trie_t*} trie - Name trie
+ * @params {const name_table_t*} table - Name table
+ * @params {int} kind - Kind of the names
+ * @returns {void}
+ *
+ */
+void name_trie_add_table(name_trie_t *trie, const name_table_t *table,
+                         int kind) {
+    DEBUG_ME;
+    for (size_t i = 0; i < table->entries_length; i++) {
+        name_trie_add(trie, table->entries[i].name, kind,
+                      table->entries[i].type);
+    }
+}
+
+/**
+ *
+ * @function name_trie_add_suffix
+ * @brief Add the names of a kind followed by a suffix word, the node of the
+ * longer name keeps the name and type of the shorter one and is flagged as
+ * suffixed
+ * @params {name_trie_t*} trie - Name trie
+ * @params {int} kind - Kind of the names
+ * @params {const char*} suffix - Separator and word, e.g. " گروه"
+ * @returns {void}
+ *
+ */
+void name_trie_add_suffix(name_trie_t *trie, int kind, const char *suffix) {
+    DEBUG_ME;
+    size_t nodes_length = trie->nodes_length;
+
+    for (size_t i = 1; i < nodes_length; i++) {
+        name_trie_node_t *node = &trie->nodes[i];
+
+        if (node->types[kind] == -1 || node->suffixed) {
+            continue;
+        }
+
+        size_t child = name_trie_add_child(trie, i, suffix[0], suffix + 1,
+                                           strlen(suffix + 1));
+
+        if (trie->nodes[child].types[kind] == -1) {
+            trie->nodes[child].types[kind] = node->types[kind];
+            trie->nodes[child].name = node->name;
+            trie->nodes[child].suffixed = true;
+        }
+    }
+}
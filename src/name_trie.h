@@ -0,0 +1,144 @@
+#ifndef _NAME_TRIE_H_
+#define _NAME_TRIE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "base.h"
+#include "log.h"
+#include "name_table.h"
+
+// A name can be of several kinds at once (e.g. element, state, attribute)
+#define NAME_TRIE_KINDS 3
+
+// Largest number of nodes, every word of every name is at most one node
+#define NAME_TRIE_MAX_NODES 2048
+
+// Must be a power of two and at least twice NAME_TRIE_MAX_NODES
+#define NAME_TRIE_CAPACITY 4096
+
+// Separator before the first word of a name
+#define NAME_TRIE_NO_SEPARATOR '\0'
+
+typedef struct {
+    // Edge from the parent: the word and the separator before it
+    uint16_t parent;
+    char separator;
+    const char *word;
+    size_t word_length;
+
+    // Only for the end of a name: the name (NUL-terminated), its type for
+    // each kind or -1 and whether it was added with name_trie_add_suffix
+    const char *name;
+    int types[NAME_TRIE_KINDS];
+    bool suffixed;
+} name_trie_node_t;
+
+typedef struct {
+    bool ready;
+
+    name_trie_node_t nodes[NAME_TRIE_MAX_NODES];  // 0 is the root
+    size_t nodes_length;
+
+    uint16_t slots[NAME_TRIE_CAPACITY];  // child node, 0 = empty
+} name_trie_t;
+
+/**
+ *
+ * @function name_trie_slot
+ * @brief Get the first slot to probe for an edge
+ * @params {size_t} parent - Node
+ * @params {char} separator - Separator before the word
+ * @params {const char*} word - Word (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the word in bytes
+ * @returns {size_t}
+ *
+ */
+size_t name_trie_slot(size_t parent, char separator, const char *word,
+                      size_t length);
+
+/**
+ *
+ * @function name_trie_init
+ * @brief Empty a name trie, keeping only its root
+ * @params {name_trie_t*} trie - Name trie
+ * @returns {void}
+ *
+ */
+void name_trie_init(name_trie_t *trie);
+
+/**
+ *
+ * @function name_trie_child
+ * @brief Follow the edge of a word from a node
+ * @params {const name_trie_t*} trie - Name trie
+ * @params {size_t} parent - Node
+ * @params {char} separator - ' ' or '-' before the word,
+ * NAME_TRIE_NO_SEPARATOR for the first word
+ * @params {const char*} word - Word (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the word in bytes
+ * @returns {size_t} Child node, 0 if there is no such edge
+ *
+ */
+size_t name_trie_child(const name_trie_t *trie, size_t parent, char separator,
+                       const char *word, size_t length);
+
+/**
+ *
+ * @function name_trie_add_child
+ * @brief Follow the edge of a word from a node, adding it if needed
+ * @params {name_trie_t*} trie - Name trie
+ * @params {size_t} parent - Node
+ * @params {char} separator - Separator before the word
+ * @params {const char*} word - Word, must outlive the trie
+ * @params {size_t} length - Length of the word in bytes
+ * @returns {size_t} Child node
+ *
+ */
+size_t name_trie_add_child(name_trie_t *trie, size_t parent, char separator,
+                           const char *word, size_t length);
+
+/**
+ *
+ * @function name_trie_add
+ * @brief Add a name split into words at ' ' and '-', if a name is added twice
+ * for a kind the first type wins (same as name_table_find)
+ * @params {name_trie_t*} trie - Name trie
+ * @params {const char*} name - NUL-terminated name, must outlive the trie
+ * @params {int} kind - Kind, smaller than NAME_TRIE_KINDS
+ * @params {int} type - Type of the name for this kind
+ * @returns {size_t} Node of the end of the name, 0 for an empty name
+ *
+ */
+size_t name_trie_add(name_trie_t *trie, const char *name, int kind, int type);
+
+/**
+ *
+ * @function name_trie_add_table
+ * @brief Add every name of a name table
+ * @params {name_trie_t*} trie - Name trie
+ * @params {const name_table_t*} table - Name table
+ * @params {int} kind - Kind of the names
+ * @returns {void}
+ *
+ */
+void name_trie_add_table(name_trie_t *trie, const name_table_t *table,
+                         int kind);
+
+/**
+ *
+ * @function name_trie_add_suffix
+ * @brief Add the names of a kind followed by a suffix word, the node of the
+ * longer name keeps the name and type of the shorter one and is flagged as
+ * suffixed
+ * @params {name_trie_t*} trie - Name trie
+ * @params {int} kind - Kind of the names
+ * @params {const char*} suffix - Separator and word, e.g. " گروه"
+ * @returns {void}
+ *
+ */
+void name_trie_add_suffix(name_trie_t *trie, int kind, const char *suffix);
+
+#endif
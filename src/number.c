@@ -0,0 +1,218 @@
+#include "number.h"
+
+/**
+ *
+ * @variable number_powers_of_ten
+ * @brief Powers of ten that are exact in a double
+ * @type {const double[23]}
+ *
+ */
+static const double number_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+#define NUMBER_MAX_POWER_OF_TEN 22
+
+// Up to 19 digits always fit in the mantissa
+#define NUMBER_MAX_MANTISSA_DIGITS 19
+
+/**
+ *
+ * @function number_scale
+ * @brief Multiply or divide a value by a power of ten
+ * @params {double} value - Value
+ * @params {int} exponent - Power of ten, can be negative
+ * @returns {double}
+ *
+ */
+double number_scale(double value, int exponent) {
+    DEBUG_ME;
+    while (exponent > NUMBER_MAX_POWER_OF_TEN) {
+        value *= number_powers_of_ten[NUMBER_MAX_POWER_OF_TEN];
+        exponent -= NUMBER_MAX_POWER_OF_TEN;
+    }
+
+    while (exponent < -NUMBER_MAX_POWER_OF_TEN) {
+        value /= number_powers_of_ten[NUMBER_MAX_POWER_OF_TEN];
+        exponent += NUMBER_MAX_POWER_OF_TEN;
+    }
+
+    // A single multiplication or division by an exact power of ten is
+    // correctly rounded, so short numbers get the same value as strtod
+    if (exponent >= 0) {
+        return value * number_powers_of_ten[exponent];
+    }
+
+    return value / number_powers_of_ten[-exponent];
+}
+
+/**
+ *
+ * @function number_scan
+ * @brief Scan a number with English, Persian or Arabic digits in one pass,
+ * without allocating
+ * @params {const char*} source - UTF-8 string (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the string in bytes
+ * @params {int} flags - NUMBER_SCAN_* flags
+ * @params {number_scan_t*} scan - Result
+ * @returns {bool} - True if the string starts with a number
+ *
+ */
+bool number_scan(const char *source, size_t length, int flags,
+                 number_scan_t *scan) {
+    DEBUG_ME;
+    scan->kind = NUMBER_KIND_NONE;
+    scan->negative = false;
+    scan->has_percent = false;
+    scan->length = 0;
+    scan->digits = 0;
+    scan->integer = 0;
+    scan->value = 0;
+    scan->text[0] = '\0';
+    scan->text_length = 0;
+    scan->unit = NULL;
+    scan->unit_length = 0;
+
+    size_t index = 0;
+
+    if ((flags & NUMBER_SCAN_SIGN) && index < length &&
+        (source[index] == '+' || source[index] == '-')) {
+        if (source[index] == '-') {
+            scan->negative = true;
+            scan->text[scan->text_length++] = '-';
+        }
+
+        index++;
+    }
+
+    uint64_t mantissa = 0;
+    size_t mantissa_digits = 0;
+    int exponent = 0;
+    bool has_dot = false;
+
+    while (index < length) {
+        size_t next = index;
+        uint32_t codepoint = unicode_decode(source, length, &next);
+        int digit = unicode_digit_value(codepoint);
+
+        if (digit < 0) {
+            // '.' or the Arabic decimal separator '٫'
+            if ((codepoint != '.' && codepoint != 0x066B) || has_dot) {
+                break;
+            }
+
+            has_dot = true;
+        }
+
+        if (scan->text_length + 1 < NUMBER_SCAN_TEXT_SIZE) {
+            scan->text[scan->text_length++] = digit < 0 ? '.' : '0' + digit;
+        }
+
+        index = next;
+
+        if (digit < 0) {
+            continue;
+        }
+
+        scan->digits++;
+
+        if (mantissa_digits < NUMBER_MAX_MANTISSA_DIGITS) {
+            if (mantissa != 0 || digit != 0) {
+                mantissa_digits++;
+            }
+
+            mantissa = mantissa * 10 + (uint64_t)digit;
+
+            if (has_dot) {
+                exponent--;
+            }
+        } else if (!has_dot) {
+            // Digits that do not fit only scale the integer part
+            exponent++;
+        }
+    }
+
+    scan->text[scan->text_length] = '\0';
+
+    if (scan->digits == 0) {
+        scan->text[0] = '\0';
+        scan->text_length = 0;
+        scan->negative = false;
+
+        return false;
+    }
+
+    if ((flags & NUMBER_SCAN_PERCENT) && index < length) {
+        size_t next = index;
+        uint32_t codepoint = unicode_decode(source, length, &next);
+
+        // '%' or the Arabic percent sign '٪'
+        if (codepoint == '%' || codepoint == 0x066A) {
+            scan->has_percent = true;
+            index = next;
+        }
+    }
+
+    scan->kind = has_dot ? NUMBER_KIND_FLOAT : NUMBER_KIND_INTEGER;
+    scan->length = index;
+    scan->value = number_scale((double)mantissa, exponent);
+
+    if (scan->negative) {
+        scan->value = -scan->value;
+    }
+
+    if (scan->value >= (double)LLONG_MAX) {
+        scan->integer = LLONG_MAX;
+    } else if (scan->value <= (double)LLONG_MIN) {
+        scan->integer = LLONG_MIN;
+    } else {
+        scan->integer = (long long)scan->value;
+    }
+
+    if (flags & NUMBER_SCAN_UNIT) {
+        while (index < length) {
+            size_t next = index;
+
+            if (!is_codepoint_whitespace(
+                    unicode_decode(source, length, &next))) {
+                break;
+            }
+
+            index = next;
+        }
+
+        scan->unit = source + index;
+        scan->unit_length = length - index;
+    }
+
+    return true;
+}
+
+/**
+ *
+ * @function number_scan_string
+ * @brief Scan a whole NUL-terminated string as a number, with
+ * NUMBER_SCAN_UNIT the rest of the string is the unit
+ * @params {const char*} value - Value
+ * @params {int} flags - NUMBER_SCAN_* flags
+ * @params {number_scan_t*} scan - Result
+ * @returns {bool} - True if the whole string is a number
+ *
+ */
+bool number_scan_string(const char *value, int flags, number_scan_t *scan) {
+    DEBUG_ME;
+    if (value == NULL) {
+        number_scan("", 0, flags, scan);
+
+        return false;
+    }
+
+    size_t length = strlen(value);
+
+    if (!number_scan(value, length, flags, scan)) {
+        return false;
+    }
+
+    return (flags & NUMBER_SCAN_UNIT) || scan->length == length;
+}
@@ -0,0 +1,77 @@
+#ifndef _NUMBER_H_
+#define _NUMBER_H_
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "base.h"
+#include "unicode.h"
+
+// Flags of number_scan
+#define NUMBER_SCAN_NONE 0
+#define NUMBER_SCAN_SIGN (1 << 0)     // Accept a leading '+' or '-'
+#define NUMBER_SCAN_PERCENT (1 << 1)  // Accept a trailing '%' or '٪'
+#define NUMBER_SCAN_UNIT (1 << 2)     // Report the text after the number
+
+// Longer numbers are still scanned, only their text is cut
+#define NUMBER_SCAN_TEXT_SIZE 64
+
+typedef enum {
+    NUMBER_KIND_NONE = 0,
+    NUMBER_KIND_INTEGER,
+    NUMBER_KIND_FLOAT,
+} number_kind_t;
+
+typedef struct {
+    number_kind_t kind;
+    bool negative;
+    bool has_percent;
+
+    size_t length;  // bytes consumed, including the sign and the percent
+    size_t digits;  // number of digits (any script)
+
+    long long integer;  // value truncated to an integer
+    double value;
+
+    // Sign, English digits and '.', e.g. "-12.5" for "-۱۲٫۵"
+    char text[NUMBER_SCAN_TEXT_SIZE];
+    size_t text_length;
+
+    // Only with NUMBER_SCAN_UNIT: the rest of the input after the number and
+    // the whitespaces that follow it, e.g. "px" or "پیکسل"
+    const char *unit;
+    size_t unit_length;
+} number_scan_t;
+
+/**
+ *
+ * @function number_scan
+ * @brief Scan a number with English, Persian or Arabic digits in one pass,
+ * without allocating
+ * @params {const char*} source - UTF-8 string (not necessarily NUL-terminated)
+ * @params {size_t} length - Length of the string in bytes
+ * @params {int} flags - NUMBER_SCAN_* flags
+ * @params {number_scan_t*} scan - Result
+ * @returns {bool} - True if the string starts with a number
+ *
+ */
+bool number_scan(const char *source, size_t length, int flags,
+                 number_scan_t *scan);
+
+/**
+ *
+ * @function number_scan_string
+ * @brief Scan a whole NUL-terminated string as a number, with
+ * NUMBER_SCAN_UNIT the rest of the string is the unit
+ * @params {const char*} value - Value
+ * @params {int} flags - NUMBER_SCAN_* flags
+ * @params {number_scan_t*} scan - Result
+ * @returns {bool} - True if the whole string is a number
+ *
+ */
+bool number_scan_string(const char *value, int flags, number_scan_t *scan);
+
+#endif
@@ -121,8 +121,7 @@ void expect(lexer_t *lexer, token_type_t token_type) {
         error_parser(2, "Expected token type %s, got %s at line %d, column %d",
                      token_type_keyword(token_type),
                      token_type_keyword(PARSER_CURRENT->type),
-                     PARSER_CURRENT->location.end_line,
-                     PARSER_CURRENT->location.end_column);
+                     PARSER_CURRENT->line, PARSER_CURRENT->column);
     }
 
     PARSER_NEXT;
@@ -139,10 +138,6 @@ void expect(lexer_t *lexer, token_type_t token_type) {
  */
 bool match_next(lexer_t *lexer, token_type_t token_type) {
     DEBUG_ME;
-    if (lexer->token_index + 1 >= lexer->tokens->capacity) {
-        return false;
-    }
-
     return PARSER_CURRENT_NEXT->type == token_type;
 }
 
@@ -174,21 +169,20 @@ bool match_prev(lexer_t *lexer, token_type_t token_type) {
  */
 ast_value_t *parser_parse_value(lexer_t *lexer) {
     DEBUG_ME;
-    token_t *token = PARSER_CURRENT;
+    token_t token = *PARSER_CURRENT;
 
     PARSER_NEXT;
 
-    if (token->type == TOKEN_IDENTIFIER) {
+    if (token.type == TOKEN_IDENTIFIER) {
         // TODO
         error_parser(2, "Identifier '%s' is not defined at line %d, column %d",
-                     token->data.string, token->location.end_line,
-                     token->location.end_column);
+                     token_value_stringify(lexer, &token), token.line,
+                     token.column);
     }
 
-    ast_value_type_t *type =
-        ast_value_type_create(AST_TYPE_KIND_STRING, token->location);
-
-    ast_value_t *value = ast_value_create(type, token_value_stringify(token));
+    ast_value_t *value = ast_value_create(
+        lexer->arena, AST_TYPE_KIND_STRING, token_location(&token),
+        token_value_stringify(lexer, &token));
 
     return value;
 }
@@ -212,8 +206,7 @@ void parser_parse_block(lexer_t *lexer, ast_block_t *block) {
 
         if (node == NULL) {
             error_parser(2, "Expected a node at line %d, column %d, but got %s",
-                         PARSER_CURRENT->location.end_line,
-                         PARSER_CURRENT->location.end_column,
+                         PARSER_CURRENT->line, PARSER_CURRENT->column,
                          token_type_keyword(PARSER_CURRENT->type));
             continue;
         } else {
@@ -234,14 +227,15 @@ void parser_parse_block(lexer_t *lexer, ast_block_t *block) {
  */
 ast_node_t *parser_parse_function(lexer_t *lexer) {
     DEBUG_ME;
-    ast_node_t *node =
-        ast_node_create(AST_TYPE_FUNCTION, PARSER_CURRENT->location);
+    ast_node_t *node = ast_node_create(lexer->arena, AST_TYPE_FUNCTION,
+                                       token_location(PARSER_CURRENT));
 
     PARSER_NEXT;  // Eat the function token
 
-    token_t *function_name = PARSER_CURRENT;
+    token_t function_name = *PARSER_CURRENT;
     expect(lexer, TOKEN_IDENTIFIER);
-    node->data.function = ast_function_create(function_name->data.string);
+    node->data.function = ast_function_create(
+        lexer->arena, token_value_stringify(lexer, &function_name));
 
     // Optional ()
     if (match(lexer, TOKEN_LEFT_PAREN)) {
@@ -273,7 +267,7 @@ array_value_t *parser_parse_expressions_maybe(lexer_t *lexer) {
         return parser_parse_expressions(lexer);
     }
 
-    return array_value_create(1);
+    return array_value_create(lexer->arena, 1);
 }
 
 /**
@@ -286,7 +280,7 @@ array_value_t *parser_parse_expressions_maybe(lexer_t *lexer) {
  */
 array_value_t *parser_parse_expressions(lexer_t *lexer) {
     DEBUG_ME;
-    array_value_t *values = array_value_create(1);
+    array_value_t *values = array_value_create(lexer->arena, 1);
 
     ast_value_t *value = parser_parse_expression(lexer);
     array_push(values, value);
@@ -298,8 +292,7 @@ array_value_t *parser_parse_expressions(lexer_t *lexer) {
         if (new_value == NULL) {
             error_parser(
                 2, "Expected an expression at line %d, column %d, but got %s",
-                PARSER_CURRENT->location.end_line,
-                PARSER_CURRENT->location.end_column,
+                PARSER_CURRENT->line, PARSER_CURRENT->column,
                 token_type_keyword(PARSER_CURRENT->type));
         }
 
@@ -319,54 +312,55 @@ array_value_t *parser_parse_expressions(lexer_t *lexer) {
  */
 ast_value_t *parser_parse_expression(lexer_t *lexer) {
     DEBUG_ME;
-    token_t *token = PARSER_CURRENT;
+    token_t token = *PARSER_CURRENT;
 
-    ast_value_type_t *type = NULL;
     ast_value_t *value = NULL;
 
     if (match(lexer, TOKEN_IDENTIFIER)) {
         PARSER_NEXT;
 
-        type = ast_value_type_create(AST_TYPE_KIND_STRING, token->location);
-        value = ast_value_create(type, token->data.string);
+        value = ast_value_create(lexer->arena, AST_TYPE_KIND_STRING,
+                                 token_location(&token),
+                                 token_value_stringify(lexer, &token));
 
         return value;
     } else if (match(lexer, TOKEN_STRING)) {
         PARSER_NEXT;
 
-        type = ast_value_type_create(AST_TYPE_KIND_STRING, token->location);
-        value = ast_value_create(type, token->data.string);
+        value = ast_value_create(lexer->arena, AST_TYPE_KIND_STRING,
+                                 token_location(&token),
+                                 token_value_stringify(lexer, &token));
 
         return value;
     } else if (match(lexer, TOKEN_NUMBER_INT)) {
         PARSER_NEXT;
 
-        type = ast_value_type_create(AST_TYPE_KIND_INT, token->location);
-        value = ast_value_create(type, NULL);
-        value->data.int_value = token->data.number_int;
+        value = ast_value_create(lexer->arena, AST_TYPE_KIND_INT,
+                                 token_location(&token), NULL);
+        value->data.int_value = token_number_int(lexer, &token);
 
         return value;
     } else if (match(lexer, TOKEN_NUMBER_FLOAT)) {
         PARSER_NEXT;
 
-        type = ast_value_type_create(AST_TYPE_KIND_STRING, token->location);
-        value = ast_value_create(type, NULL);
-        value->data.float_value = token->data.number_float;
+        value = ast_value_create(lexer->arena, AST_TYPE_KIND_FLOAT,
+                                 token_location(&token), NULL);
+        value->data.float_value = token_number_float(lexer, &token);
 
         return value;
     } else if (match(lexer, TOKEN_BOOLEAN)) {
         PARSER_NEXT;
 
-        type = ast_value_type_create(AST_TYPE_KIND_STRING, token->location);
-        value = ast_value_create(type, NULL);
-        value->data.bool_value = token->data.boolean;
+        value = ast_value_create(lexer->arena, AST_TYPE_KIND_BOOL,
+                                 token_location(&token), NULL);
+        // Only "true" is lexed as a boolean, "false" is a hidden keyword
+        value->data.bool_value = true;
 
         return value;
     } else {
         error_parser(2,
                      "Expected an expression at line %d, column %d, but got %s",
-                     token->location.end_line, token->location.end_column,
-                     token_type_keyword(token->type));
+                     token.line, token.column, token_type_keyword(token.type));
     }
 
     return NULL;
@@ -382,13 +376,13 @@ ast_value_t *parser_parse_expression(lexer_t *lexer) {
  */
 ast_node_t *parser_parse_print(lexer_t *lexer) {
     DEBUG_ME;
-    ast_node_t *node =
-        ast_node_create(AST_TYPE_PRINT, PARSER_CURRENT->location);
+    ast_node_t *node = ast_node_create(lexer->arena, AST_TYPE_PRINT,
+                                       token_location(PARSER_CURRENT));
 
     PARSER_NEXT;  // Eat the print token
 
     array_value_t *values = parser_parse_expressions_maybe(lexer);
-    node->data.print = ast_print_create(values);
+    node->data.print = ast_print_create(lexer->arena, values);
 
     return node;
 }
@@ -403,13 +397,13 @@ ast_node_t *parser_parse_print(lexer_t *lexer) {
  */
 ast_node_t *parser_parse_return(lexer_t *lexer) {
     DEBUG_ME;
-    ast_node_t *node =
-        ast_node_create(AST_TYPE_RETURN, PARSER_CURRENT->location);
+    ast_node_t *node = ast_node_create(lexer->arena, AST_TYPE_RETURN,
+                                       token_location(PARSER_CURRENT));
 
     PARSER_NEXT;  // Eat the return token
 
     array_value_t *values = parser_parse_expressions(lexer);
-    node->data.returns = ast_return_create(values);
+    node->data.returns = ast_return_create(lexer->arena, values);
 
     return node;
 }
@@ -424,12 +418,13 @@ ast_node_t *parser_parse_return(lexer_t *lexer) {
  */
 ast_node_t *parser_parse_if(lexer_t *lexer) {
     DEBUG_ME;
-    ast_node_t *node = ast_node_create(AST_TYPE_IF, PARSER_CURRENT->location);
+    ast_node_t *node = ast_node_create(lexer->arena, AST_TYPE_IF,
+                                       token_location(PARSER_CURRENT));
 
     PARSER_NEXT;  // Eat the if token
 
     ast_value_t *condition = parser_parse_expression(lexer);
-    node->data.ifclause = ast_if_create(condition);
+    node->data.ifclause = ast_if_create(lexer->arena, condition);
 
     parser_parse_block(lexer, node->data.ifclause->block);
 
@@ -441,9 +436,10 @@ ast_node_t *parser_parse_if(lexer_t *lexer) {
                 PARSER_NEXT;  // Eat the else token
 
                 ast_node_t *else_if =
-                    ast_node_create(AST_TYPE_ELSE_IF, PARSER_CURRENT->location);
+                    ast_node_create(lexer->arena, AST_TYPE_ELSE_IF,
+                                    token_location(PARSER_CURRENT));
 
-                else_if->data.ifclause = ast_else_create();
+                else_if->data.ifclause = ast_else_create(lexer->arena);
                 parser_parse_block(lexer, else_if->data.ifclause->block);
 
                 array_push(node->data.ifclause->else_blocks, else_if);
@@ -455,11 +451,13 @@ ast_node_t *parser_parse_if(lexer_t *lexer) {
                 PARSER_NEXT;  // Eat the else token
 
                 ast_node_t *else_if =
-                    ast_node_create(AST_TYPE_IF, PARSER_CURRENT->location);
+                    ast_node_create(lexer->arena, AST_TYPE_IF,
+                                    token_location(PARSER_CURRENT));
                 PARSER_NEXT;  // Eat the sub if token
 
                 ast_value_t *condition = parser_parse_expression(lexer);
-                else_if->data.ifclause = ast_elseif_create(condition);
+                else_if->data.ifclause =
+                    ast_elseif_create(lexer->arena, condition);
 
                 parser_parse_block(lexer, else_if->data.ifclause->block);
 
@@ -468,8 +466,7 @@ ast_node_t *parser_parse_if(lexer_t *lexer) {
                 error_parser(2,
                              "Expected a block or an else if at line %d, "
                              "column %d, but got %s",
-                             PARSER_CURRENT->location.end_line,
-                             PARSER_CURRENT->location.end_column,
+                             PARSER_CURRENT->line, PARSER_CURRENT->column,
                              token_type_keyword(PARSER_CURRENT->type));
             }
         } else {
@@ -503,8 +500,7 @@ ast_node_t *parser_parse_node(lexer_t *lexer) {
     } else {
         error_parser(2, "Unknown token '%s' as statement at line %d, column %d",
                      token_type_keyword(PARSER_CURRENT->type),
-                     PARSER_CURRENT->location.end_line,
-                     PARSER_CURRENT->location.end_column);
+                     PARSER_CURRENT->line, PARSER_CURRENT->column);
     }
 
     return NULL;
@@ -520,39 +516,22 @@ ast_node_t *parser_parse_node(lexer_t *lexer) {
  */
 ast_t *parser_parse(lexer_t *lexer) {
     DEBUG_ME;
-    ast_t *ast = ast_create();
-
-    while (lexer->token_index < lexer->tokens->length) {
-        if (PARSER_CURRENT->type == TOKEN_EOF) {
-            break;
-        }
+    ast_t *ast = ast_create(lexer->arena);
 
+    while (!match(lexer, TOKEN_EOF)) {
         ast_node_t *node = parser_parse_node(lexer);
 
         if (node == NULL) {
             error_parser(2, "Expected a node at line %d, column %d, but got %s",
-                         PARSER_CURRENT->location.end_line,
-                         PARSER_CURRENT->location.end_column,
+                         PARSER_CURRENT->line, PARSER_CURRENT->column,
                          token_type_keyword(PARSER_CURRENT->type));
             continue;
         } else if (node->type == AST_TYPE_LAYOUT) {
-            // Free the previous layout if it exists
-            if (ast->layout != NULL) {
-                ast_layout_destroy(ast->layout);
-            }
-
-            // Set the layout
+            // Set the layout, a previous one and the nodes are left to the
+            // lexer's arena
             ast->layout = node->data.layout;
-
-            // Free the node as we don't need it anymore, we just need layout
-            // node
-            if (node != NULL) {
-                memory_destroy(node);
-            }
         } else if (node->type == AST_TYPE_FUNCTION) {
             array_push(ast->functions, node->data.function);
-
-            ast_node_destroy_notall(node);
         }
     }
 
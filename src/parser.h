@@ -8,14 +8,13 @@
 #include "lexer.h"
 #include "validator.h"
 
-#define PARSER_NEXT lexer->token_index++
-#define PARSER_PREV lexer->token_index--
-
-#define PARSER_CURRENT ((token_t *)lexer->tokens->data[lexer->token_index])
-#define PARSER_CURRENT_NEXT \
-    ((token_t *)lexer->tokens->data[lexer->token_index + 1])
-#define PARSER_CURRENT_PREV \
-    ((token_t *)lexer->tokens->data[lexer->token_index + 1])
+// The parser pulls tokens from the lexer, a token pointer is only valid until
+// the token is consumed: copy the token to keep it
+#define PARSER_NEXT lexer_next_token(lexer)
+
+#define PARSER_CURRENT (lexer_peek(lexer, 0))
+#define PARSER_CURRENT_NEXT (lexer_peek(lexer, 1))
+#define PARSER_CURRENT_PREV (&lexer->previous)
 
 #include "parser_layout.h"
 
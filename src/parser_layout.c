@@ -10,12 +10,12 @@
  */
 ast_node_t *parser_parse_layout(lexer_t *lexer) {
     DEBUG_ME;
-    ast_node_t *node =
-        ast_node_create(AST_TYPE_LAYOUT, PARSER_CURRENT->location);
+    ast_node_t *node = ast_node_create(lexer->arena, AST_TYPE_LAYOUT,
+                                       token_location(PARSER_CURRENT));
 
     PARSER_NEXT;  // Eat the layout token
 
-    node->data.layout = ast_layout_create();
+    node->data.layout = ast_layout_create(lexer->arena);
 
     parser_parse_layout_block(node->data.layout->block, lexer);
 
@@ -38,48 +38,32 @@ void parser_parse_layout_block(ast_layout_block_t *block, lexer_t *lexer) {
 
     while (PARSER_CURRENT->type != TOKEN_TYPE_CLOSE_BLOCK) {
         if (match(lexer, TOKEN_IDENTIFIER) || match(lexer, TOKEN_PRINT)) {
-            token_t *last_name = PARSER_CURRENT;
-            string_t *name = parser_parse_layout_name(lexer, &last_name);
-
-            if (enduser_name_to_ast_layout_node_type(name->data) !=
-                AST_LAYOUT_TYPE_ERROR) {
-                parser_parse_layout_block_children(block, lexer, name->data,
-                                                   last_name);
-
-                string_destroy(name);
-            } else if (block->states != NULL &&
-                       enduser_name_to_ast_layout_attribute_style_state_type(
-                           name->data) !=
-                           AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR) {
-                parser_parse_layout_block_style_state(block, lexer, name->data,
-                                                      last_name);
-
-                string_destroy(name);
-            } else if (enduser_name_to_ast_layout_attribute_type(name->data) !=
-                       AST_LAYOUT_ATTRIBUTE_TYPE_ERROR) {
+            token_t last_name = *PARSER_CURRENT;
+            const name_trie_node_t *found;
+            char *name = parser_parse_layout_name(lexer, &last_name, &found);
+
+            if (found != NULL && found->types[PARSER_LAYOUT_NAME_NODE] != -1) {
+                parser_parse_layout_block_children(block, lexer, name,
+                                                   &last_name);
+            } else if (found != NULL && block->states != NULL &&
+                       !found->suffixed &&
+                       found->types[PARSER_LAYOUT_NAME_STATE] != -1) {
+                parser_parse_layout_block_style_state(block, lexer, name,
+                                                      &last_name);
+            } else if (found != NULL &&
+                       found->types[PARSER_LAYOUT_NAME_ATTRIBUTE] != -1) {
                 parser_parse_layout_block_attribute(
-                    false, block, block->styles->normal, lexer, name->data,
-                    last_name);
-
-                string_destroy(name);
+                    false, block, block->styles->normal, lexer, name,
+                    &last_name);
+            } else if (found != NULL && found->suffixed) {
+                // The name of the state without STYLE_STATE_ENDS_GROUP
+                parser_parse_layout_block_style_state(
+                    block, lexer, (char *)found->name, &last_name);
             } else {
-                if (string_ends(name->data, STYLE_STATE_ENDS_GROUP)) {
-                    string_t *name2 = string_create_from(
-                        name->data, 0,
-                        name->length - strlen(STYLE_STATE_ENDS_GROUP));
-
-                    parser_parse_layout_block_style_state(
-                        block, lexer, name2->data, last_name);
-
-                    string_destroy(name2);
-                    string_destroy(name);
-                } else {
-                    error_parser(2,
-                                 "The '%s' is not a valid layout node, style "
-                                 "state or attribute at line %d, column %d",
-                                 name->data, last_name->location.end_line,
-                                 last_name->location.end_column);
-                }
+                error_parser(2,
+                             "The '%s' is not a valid layout node, style "
+                             "state or attribute at line %d, column %d",
+                             name, last_name.line, last_name.column);
                 return;
             }
         } else {
@@ -87,9 +71,8 @@ void parser_parse_layout_block(ast_layout_block_t *block, lexer_t *lexer) {
                 2,
                 "Unknown token '%s' inside a layout block it should be name of "
                 "an element or an attribute at line %d, column %d",
-                token_type_keyword(PARSER_CURRENT->type),
-                PARSER_CURRENT->location.end_line,
-                PARSER_CURRENT->location.end_column);
+                token_type_keyword(PARSER_CURRENT->type), PARSER_CURRENT->line,
+                PARSER_CURRENT->column);
         }
     }
 
@@ -98,50 +81,172 @@ void parser_parse_layout_block(ast_layout_block_t *block, lexer_t *lexer) {
     expect_close_block(lexer);
 }
 
+/**
+ *
+ * @variable parser_layout_names
+ * @brief Element, style state and attribute end-user names by words, a style
+ * state followed by STYLE_STATE_ENDS_GROUP is a suffixed state
+ * @type {name_trie_t}
+ *
+ */
+name_trie_t parser_layout_names;
+
+/**
+ *
+ * @function parser_layout_names_build
+ * @brief Fill parser_layout_names from the name tables (runs once)
+ * @returns {void}
+ *
+ */
+void parser_layout_names_build() {
+    DEBUG_ME;
+    name_trie_init(&parser_layout_names);
+
+    name_trie_add_table(&parser_layout_names,
+                        &ast_layout_node_type_enduser_names,
+                        PARSER_LAYOUT_NAME_NODE);
+    name_trie_add_table(&parser_layout_names, &ast_layout_state_enduser_names,
+                        PARSER_LAYOUT_NAME_STATE);
+    name_trie_add_table(&parser_layout_names,
+                        &ast_layout_attribute_type_enduser_names,
+                        PARSER_LAYOUT_NAME_ATTRIBUTE);
+
+    name_trie_add_suffix(&parser_layout_names, PARSER_LAYOUT_NAME_STATE,
+                         STYLE_STATE_ENDS_GROUP);
+}
+
+/**
+ *
+ * @function parser_layout_name_text
+ * @brief Append the words of a node of parser_layout_names to a string
+ * @params {size_t} node - Node
+ * @params {string_t*} text - String
+ * @returns {void}
+ *
+ */
+void parser_layout_name_text(size_t node, string_t *text) {
+    DEBUG_ME;
+    const name_trie_node_t *current = &parser_layout_names.nodes[node];
+
+    if (current->parent != 0) {
+        parser_layout_name_text(current->parent, text);
+        string_append_char(text, current->separator);
+    }
+
+    for (size_t i = 0; i < current->word_length; i++) {
+        string_append_char(text, current->word[i]);
+    }
+}
+
 /**
  *
  * @function parser_parse_layout_name
- * @brief Parse the layout name
+ * @brief Parse the layout name by walking parser_layout_names with its words
  * @params {lexer_t*} lexer - Lexer
- * @params {token_t**} last_name - Last token
- * @returns {string_t*} - String
+ * @params {token_t*} last_name - Last token, overwritten by the last
+ * identifier of the name
+ * @params {const name_trie_node_t**} found - Node of the name, NULL if the
+ * name is unknown (can be NULL)
+ * @returns {char*} - Name as written, valid until the next unknown name
  *
  */
-string_t *parser_parse_layout_name(lexer_t *lexer, token_t **last_name) {
+char *parser_parse_layout_name(lexer_t *lexer, token_t *last_name,
+                               const name_trie_node_t **found) {
     DEBUG_ME;
-    string_t *name = string_create(16);
+    // Only unknown and suffixed names are written out, known names are the
+    // strings of the name tables
+    static string_t *unknown = NULL;
+
+    if (!parser_layout_names.ready) {
+        parser_layout_names_build();
+    }
+    if (unknown == NULL) {
+        unknown = string_create(16);
+    }
 
-    string_append_str(name, token_value_stringify(PARSER_CURRENT));
+    char *word = token_value_stringify(lexer, PARSER_CURRENT);
+    size_t node = name_trie_child(&parser_layout_names, 0,
+                                  NAME_TRIE_NO_SEPARATOR, word, strlen(word));
+
+    if (node == 0) {
+        string_clear(unknown);
+        string_append_str(unknown, word);
+    }
 
     PARSER_NEXT;  // Eating the identifier token
 
     while (match(lexer, TOKEN_MINUS) || match(lexer, TOKEN_IDENTIFIER)) {
+        char separator = ' ';
+
         if (PARSER_CURRENT->type == TOKEN_MINUS) {
             PARSER_NEXT;  // Eating the minus token
 
-            string_append_char(name, '-');
-        } else {
-            string_append_char(name, ' ');
+            separator = '-';
         }
 
         if (match(lexer, TOKEN_IDENTIFIER)) {
-            string_append_str(name, token_value_stringify(PARSER_CURRENT));
-            *last_name = PARSER_CURRENT;
+            word = token_value_stringify(lexer, PARSER_CURRENT);
+
+            if (node != 0) {
+                size_t child = name_trie_child(&parser_layout_names, node,
+                                               separator, word, strlen(word));
+
+                if (child == 0) {
+                    string_clear(unknown);
+                    parser_layout_name_text(node, unknown);
+                }
+
+                node = child;
+            }
+
+            if (node == 0) {
+                string_append_char(unknown, separator);
+                string_append_str(unknown, word);
+            }
+
+            *last_name = *PARSER_CURRENT;
 
             PARSER_NEXT;  // Eating the identifier token
         } else {
+            if (node != 0) {
+                string_clear(unknown);
+                parser_layout_name_text(node, unknown);
+            }
+
             error_parser(
                 2,
                 "Expected an identifier after the dash in the attribute name "
-                "'%s' at line %d, column %d, but got %s",
-                name->data, PARSER_CURRENT->location.end_line,
-                PARSER_CURRENT->location.end_column,
+                "'%s-' at line %d, column %d, but got %s",
+                unknown->data, PARSER_CURRENT->line, PARSER_CURRENT->column,
                 token_type_keyword(PARSER_CURRENT->type));
             break;
         }
     }
 
-    return name;
+    // A prefix of a name is not a name
+    if (node != 0 && parser_layout_names.nodes[node].name == NULL) {
+        string_clear(unknown);
+        parser_layout_name_text(node, unknown);
+
+        node = 0;
+    }
+
+    if (found != NULL) {
+        *found = node == 0 ? NULL : &parser_layout_names.nodes[node];
+    }
+
+    if (node == 0) {
+        return unknown->data;
+    }
+
+    if (parser_layout_names.nodes[node].suffixed) {
+        string_clear(unknown);
+        parser_layout_name_text(node, unknown);
+
+        return unknown->data;
+    }
+
+    return (char *)parser_layout_names.nodes[node].name;
 }
 
 /**
@@ -169,8 +274,7 @@ void parser_parse_layout_block_children(ast_layout_block_t *block,
                              "line %d, column %d",
                              ast_layout_node_type_to_enduser_name(
                                  block->parent_node_type),
-                             last_name->location.end_line,
-                             last_name->location.end_column);
+                             last_name->line, last_name->column);
             }
 
             array_push(block->meta_children, node);
@@ -182,8 +286,7 @@ void parser_parse_layout_block_children(ast_layout_block_t *block,
     } else {
         error_parser(2,
                      "Expected a layout node at line %d, column %d, but got %s",
-                     PARSER_CURRENT->location.end_line,
-                     PARSER_CURRENT->location.end_column,
+                     PARSER_CURRENT->line, PARSER_CURRENT->column,
                      token_type_keyword(PARSER_CURRENT->type));
     }
 }
@@ -194,7 +297,7 @@ void parser_parse_layout_block_children(ast_layout_block_t *block,
  * @brief Parse the block attribute
  * @params {bool} onlyStyle - Only style
  * @params {ast_layout_block_t*} block - AST layout block node
- * @params {hashmap_t*} normal - Normal hashmap
+ * @params {enum_map_layout_attribute_t*} normal - Normal styles
  * @params {lexer_t*} lexer - Lexer
  * @params {char*} name - Name of the attribute
  * @params {token_t*} last_name - Last token
@@ -203,15 +306,16 @@ void parser_parse_layout_block_children(ast_layout_block_t *block,
  */
 void parser_parse_layout_block_attribute(bool onlyStyle,
                                          ast_layout_block_t *block,
-                                         hashmap_t *normal, lexer_t *lexer,
-                                         char *name, token_t *last_name) {
+                                         enum_map_layout_attribute_t *normal,
+                                         lexer_t *lexer, char *name,
+                                         token_t *last_name) {
     DEBUG_ME;
-    token_t *first_value = PARSER_CURRENT;  // TODO
+    token_t first_value = *PARSER_CURRENT;  // TODO
 
     if (match(lexer, TOKEN_TYPE_OPEN_BLOCK)) {
         error_parser(
             2, "Nonsupported layout element '%s' at line %d, column %d", name,
-            last_name->location.end_line, last_name->location.end_column);
+            last_name->line, last_name->column);
     }
     expect(lexer, TOKEN_ASSIGN);
 
@@ -222,56 +326,47 @@ void parser_parse_layout_block_attribute(bool onlyStyle,
                                            block->parent_node_type);
 
     ast_layout_attribute_t *attribute = ast_layout_attribute_create(
-        attribute_key_type, name, values, block->parent_node_type,
-        PARSER_CURRENT->location, first_value->location);
+        lexer->arena, attribute_key_type, name, values, block->parent_node_type,
+        token_location(PARSER_CURRENT), token_location(&first_value));
     if (!token_belongs_to_ast_layout_node(attribute_key_type, attribute)) {
-        attribute->destroy(attribute);
-
         error_parser(
             2,
             "Attribute '%s' does not belong to node '%s' at line %d, column %d",
             name, ast_layout_node_type_to_enduser_name(block->parent_node_type),
-            last_name->location.end_line, last_name->location.end_column);
+            last_name->line, last_name->column);
     }
 
     char *attribute_key_name =
         ast_layout_attribute_type_to_name(attribute_key_type);
 
     if (is_style_attribute(attribute_key_type)) {
-        if (hashmap_has(normal, attribute_key_name)) {
-            attribute->destroy(attribute);
-
-            error_parser(
+        if (enum_map_has(normal, attribute_key_type)) {
+                error_parser(
                 2,
                 "Style attribute '%s' already defined in the '%s' block at "
                 "line %d, column %d",
                 attribute_key_name,
                 ast_layout_node_type_to_enduser_name(block->parent_node_type),
-                last_name->location.end_line, last_name->location.end_column);
+                last_name->line, last_name->column);
         } else {
-            hashmap_put(normal, attribute_key_name, attribute);
+            enum_map_put(normal, attribute_key_type, attribute);
         }
     } else if (onlyStyle != true) {
-        if (hashmap_has(block->attributes, attribute_key_name)) {
-            attribute->destroy(attribute);
-
-            error_parser(
+        if (enum_map_has(block->attributes, attribute_key_type)) {
+                error_parser(
                 2,
                 "Attribute '%s' already defined in the '%s' block at line %d, "
                 "column %d",
                 attribute_key_name,
                 ast_layout_node_type_to_enduser_name(block->parent_node_type),
-                last_name->location.end_line, last_name->location.end_column);
+                last_name->line, last_name->column);
         } else {
-            hashmap_put(block->attributes, attribute_key_name, attribute);
+            enum_map_put(block->attributes, attribute_key_type, attribute);
         }
     } else {
-        attribute->destroy(attribute);
-
         error_parser(
             2, "Attribute '%s' is not a style attribute at line %d, column %d",
-            attribute_key_name, last_name->location.end_line,
-            last_name->location.end_column);
+            attribute_key_name, last_name->line, last_name->column);
     }
 }
 
@@ -292,10 +387,10 @@ ast_layout_node_t *parser_parse_layout_node(lexer_t *lexer, char *name,
 
     if (type == AST_LAYOUT_TYPE_ERROR) {
         error_ast(2, "Unknown layout node '%s' at line %d, column %d", name,
-                  last_name->location.end_line, last_name->location.end_column);
+                  last_name->line, last_name->column);
     }
 
-    ast_layout_node_t *node = ast_layout_node_create(type);
+    ast_layout_node_t *node = ast_layout_node_create(lexer->arena, type);
 
     parser_parse_layout_block(node->block, lexer);
 
@@ -322,34 +417,32 @@ void parser_parse_layout_block_style_state(ast_layout_block_t *block,
 
     if (style_state_type == AST_LAYOUT_ATTRIBUTE_STYLE_STATE_TYPE_ERROR) {
         error_parser(2, "Unknown style state '%s' at line %d, column %d", name,
-                     last_name->location.end_line,
-                     last_name->location.end_column);
+                     last_name->line, last_name->column);
     }
 
     expect_open_block(lexer);
 
-    if (hashmap_has(block->states, name) == true) {
+    if (enum_map_has(block->states, style_state_type) == true) {
         error_parser(
             2,
             "Style state '%s' already defined in the '%s' block at line %d, "
             "column %d",
             name, ast_layout_node_type_to_enduser_name(block->parent_node_type),
-            last_name->location.end_line, last_name->location.end_column);
+            last_name->line, last_name->column);
     }
 
-    ast_layout_style_state_t *state_styles = ast_layout_style_state_create();
+    ast_layout_style_state_t *state_styles =
+        ast_layout_style_state_create(lexer->arena);
 
     while (PARSER_CURRENT->type != TOKEN_TYPE_CLOSE_BLOCK) {
-        token_t *last_name2 = PARSER_CURRENT;
-        string_t *name2 = parser_parse_layout_name(lexer, &last_name2);
+        token_t last_name2 = *PARSER_CURRENT;
+        char *name2 = parser_parse_layout_name(lexer, &last_name2, NULL);
 
         parser_parse_layout_block_attribute(true, block, state_styles->normal,
-                                            lexer, name2->data, last_name2);
-
-        string_destroy(name2);
+                                            lexer, name2, &last_name2);
     }
 
-    hashmap_put(block->states, name, state_styles);
+    enum_map_put(block->states, style_state_type, state_styles);
 
     expect_close_block(lexer);
 }
@@ -363,7 +456,7 @@ void parser_parse_layout_block_style_state(ast_layout_block_t *block,
  *
  */
 array_value_t *parser_parse_layout_values(lexer_t *lexer) {
-    array_value_t *values = array_value_create(1);
+    array_value_t *values = array_value_create(lexer->arena, 1);
 
     ast_value_t *value = parser_parse_layout_value(lexer);
 
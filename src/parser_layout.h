@@ -6,9 +6,45 @@
 #include "ast.h"
 #include "base.h"
 #include "lexer.h"
+#include "name_trie.h"
 #include "parser_layout.h"
 #include "validator.h"
 
+// Kinds of the names in parser_layout_names
+#define PARSER_LAYOUT_NAME_NODE 0
+#define PARSER_LAYOUT_NAME_STATE 1
+#define PARSER_LAYOUT_NAME_ATTRIBUTE 2
+
+/**
+ *
+ * @variable parser_layout_names
+ * @brief Element, style state and attribute end-user names by words, a style
+ * state followed by STYLE_STATE_ENDS_GROUP is a suffixed state
+ * @type {name_trie_t}
+ *
+ */
+extern name_trie_t parser_layout_names;
+
+/**
+ *
+ * @function parser_layout_names_build
+ * @brief Fill parser_layout_names from the name tables (runs once)
+ * @returns {void}
+ *
+ */
+void parser_layout_names_build();
+
+/**
+ *
+ * @function parser_layout_name_text
+ * @brief Append the words of a node of parser_layout_names to a string
+ * @params {size_t} node - Node
+ * @params {string_t*} text - String
+ * @returns {void}
+ *
+ */
+void parser_layout_name_text(size_t node, string_t *text);
+
 /**
  *
  * @function parser_parse_layout_block
@@ -62,7 +98,7 @@ void parser_parse_layout_block_children(ast_layout_block_t *block,
  * @brief Parse the block attribute
  * @params {bool} onlyStyle - Only style
  * @params {ast_layout_block_t*} block - AST layout block node
- * @params {hashmap_t*} normal - Normal hashmap
+ * @params {enum_map_layout_attribute_t*} normal - Normal styles
  * @params {lexer_t*} lexer - Lexer
  * @params {char*} name - Name of the attribute
  * @params {token_t*} last_name - Last token
@@ -71,8 +107,9 @@ void parser_parse_layout_block_children(ast_layout_block_t *block,
  */
 void parser_parse_layout_block_attribute(bool onlyStyle,
                                          ast_layout_block_t *block,
-                                         hashmap_t *normal, lexer_t *lexer,
-                                         char *name, token_t *last_name);
+                                         enum_map_layout_attribute_t *normal,
+                                         lexer_t *lexer, char *name,
+                                         token_t *last_name);
 
 /**
  *
@@ -115,13 +152,17 @@ void parser_parse_layout_block_style_state(ast_layout_block_t *block,
 /**
  *
  * @function parser_parse_layout_name
- * @brief Parse the layout name
+ * @brief Parse the layout name by walking parser_layout_names with its words
  * @params {lexer_t*} lexer - Lexer
- * @params {token_t**} last_name - Last token
- * @returns {string_t*} - String
+ * @params {token_t*} last_name - Last token, overwritten by the last
+ * identifier of the name
+ * @params {const name_trie_node_t**} found - Node of the name, NULL if the
+ * name is unknown (can be NULL)
+ * @returns {char*} - Name as written, valid until the next unknown name
  *
  */
-string_t *parser_parse_layout_name(lexer_t *lexer, token_t **last_name);
+char *parser_parse_layout_name(lexer_t *lexer, token_t *last_name,
+                               const name_trie_node_t **found);
 
 /**
  *
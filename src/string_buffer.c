@@ -25,6 +25,29 @@ char *string_strdup(const char *source) {
     return dest;
 }
 
+/**
+ *
+ * @function string_strndup
+ * @brief Duplicate the first `length` bytes of a string (a slice of the source)
+ * @params {const char*} source - Source string
+ * @params {size_t} length - Number of bytes to copy
+ * @returns {char*}
+ *
+ */
+char *string_strndup(const char *source, size_t length) {
+    if (source == NULL) {
+        return NULL;
+    }
+
+    char *dest = memory_allocate(length + 1);
+
+    memcpy(dest, source, length);
+
+    dest[length] = '\0';
+
+    return dest;
+}
+
 /**
  *
  * @function my_strcasecmp
@@ -69,9 +92,6 @@ string_t *string_create(size_t initial_capacity) {
     str->data = memory_allocate(initial_capacity * sizeof(char));
     str->data[0] = '\0';
 
-    str->print = cast(void (*)(void *), string_print);
-    str->destroy = cast(void (*)(void *), string_destroy);
-
     return str;
 }
 
@@ -274,6 +294,70 @@ void string_append(string_t *str, const string_t *value) {
     string_append_str(str, value->data);
 }
 
+/**
+ *
+ * @function string_repeat
+ * @brief Repeat the end of the string, by copying what is already repeated
+ * each time so it takes O(log count) copies
+ * @params {string_t*} str - String
+ * @params {size_t} offset - Start of the end to repeat
+ * @params {size_t} count - Number of copies in total, 0 removes the end
+ * @returns {void}
+ *
+ */
+void string_repeat(string_t *str, size_t offset, size_t count) {
+    DEBUG_ME;
+    size_t length = str->length - offset;
+
+    if (count == 0) {
+        string_truncate(str, offset);
+        return;
+    } else if (count == 1 || length == 0) {
+        return;
+    }
+
+    if (length > (SIZE_MAX - 1 - offset) / count) {
+        panic("String is too large to repeat");
+    }
+
+    size_t total = offset + length * count;
+
+    if (total >= str->capacity) {
+        str->capacity = total + 1;
+        str->data = memory_reallocate(str->data, str->capacity * sizeof(char));
+    }
+
+    char *start = str->data + offset;
+    size_t copied = length;
+
+    while (copied <= (total - offset) / 2) {
+        memcpy(start + copied, start, copied);
+        copied *= 2;
+    }
+
+    memcpy(start + copied, start, total - offset - copied);
+
+    str->length = total;
+    str->data[total] = '\0';
+}
+
+/**
+ *
+ * @function string_truncate
+ * @brief Cut the string to a shorter length
+ * @params {string_t*} str - String
+ * @params {size_t} length - New length, at most the current one
+ * @returns {void}
+ *
+ */
+void string_truncate(string_t *str, size_t length) {
+    DEBUG_ME;
+    if (length < str->length) {
+        str->length = length;
+        str->data[length] = '\0';
+    }
+}
+
 /**
  *
  * @function string_set
@@ -288,6 +372,20 @@ void string_set(string_t *str, string_t *value) {
     return string_append_str(str, value->data);
 }
 
+/**
+ *
+ * @function string_clear
+ * @brief Empty a string, keeping its buffer
+ * @params {string_t*} str - String
+ * @returns {void}
+ *
+ */
+void string_clear(string_t *str) {
+    DEBUG_ME;
+    str->length = 0;
+    str->data[0] = '\0';
+}
+
 /**
  *
  * @function string_set_str
@@ -526,14 +624,9 @@ bool is_valid_utf8(const char *str) {
  */
 bool is_schar_alpha(const char *c) {
     DEBUG_ME;
-    wchar_t wc;
-    int len = mbtowc(&wc, c, MB_CUR_MAX);
-
-    if (len <= 0) {
-        return false;
-    }
+    size_t index = 0;
 
-    return iswalpha(wc);
+    return is_codepoint_identifier_start(utf8_decode(c, &index));
 }
 
 /**
@@ -546,7 +639,7 @@ bool is_schar_alpha(const char *c) {
  */
 bool is_char_digit(char c) {
     DEBUG_ME;
-    return c >= '0' && c <= '9';
+    return unicode_latin1_classes[(unsigned char)c] & UNICODE_CLASS_DIGIT;
 }
 
 /**
@@ -598,7 +691,7 @@ bool is_char_whitespace(char c) {
  */
 bool is_wchar_alpha(uint32_t codepoint) {
     DEBUG_ME;
-    return iswalpha(codepoint);
+    return is_codepoint_identifier_start(codepoint);
 }
 
 /**
@@ -610,8 +703,34 @@ bool is_wchar_alpha(uint32_t codepoint) {
  *
  */
 bool is_wchar_digit(uint32_t codepoint) {
-    return is_english_digit(codepoint) || is_persian_digit(codepoint) ||
-           is_arabic_digit(codepoint) || iswdigit(codepoint);
+    DEBUG_ME;
+    return is_codepoint_digit(codepoint);
+}
+
+/**
+ *
+ * @function is_codepoint_alpha
+ * @brief Check if a decoded codepoint is an alphabet
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool} True if the codepoint is an alphabet, false otherwise
+ *
+ */
+bool is_codepoint_alpha(uint32_t codepoint) {
+    DEBUG_ME;
+    return is_codepoint_identifier_start(codepoint);
+}
+
+/**
+ *
+ * @function is_codepoint_digit
+ * @brief Check if a decoded codepoint is a Persian/Arabic/English digit
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool} True if the codepoint is a digit, false otherwise
+ *
+ */
+bool is_codepoint_digit(uint32_t codepoint) {
+    DEBUG_ME;
+    return (unicode_class(codepoint) & UNICODE_CLASS_DIGIT) != 0;
 }
 
 /**
@@ -662,15 +781,7 @@ bool is_utf8_alpha(char *utf8) {
     // wchar_t wc = (wchar_t)codepoint;
     // return iswalpha(wc);
 
-    // Check if the codepoint is alphabetic (manual check for Unicode ranges)
-    if ((codepoint >= 0x41 && codepoint <= 0x5A) ||      // A-Z
-        (codepoint >= 0x61 && codepoint <= 0x7A) ||      // a-z
-        (codepoint >= 0x0600 && codepoint <= 0x06FF) ||  // Arabic alphabet
-        iswalpha(codepoint)) {  // Fallback to iswalpha for other languages
-        return true;
-    }
-
-    return false;
+    return is_codepoint_alpha(codepoint);
 }
 
 /**
@@ -683,50 +794,15 @@ bool is_utf8_alpha(char *utf8) {
  *
  */
 bool is_utf8_digit(char *utf8) {
-    // Persian digits
-    if (strcmp(utf8, "۰") == 0 ||  // Persian 0
-        strcmp(utf8, "۱") == 0 ||  // Persian 1
-        strcmp(utf8, "۲") == 0 ||  // Persian 2
-        strcmp(utf8, "۳") == 0 ||  // Persian 3
-        strcmp(utf8, "۴") == 0 ||  // Persian 4
-        strcmp(utf8, "۵") == 0 ||  // Persian 5
-        strcmp(utf8, "۶") == 0 ||  // Persian 6
-        strcmp(utf8, "۷") == 0 ||  // Persian 7
-        strcmp(utf8, "۸") == 0 ||  // Persian 8
-        strcmp(utf8, "۹") == 0     // Persian 9
-    ) {
-        return true;
-    }
-    // Arabic digits
-    else if (strcmp(utf8, "٠") == 0 ||  // Arabic 0
-             strcmp(utf8, "١") == 0 ||  // Arabic 1
-             strcmp(utf8, "٢") == 0 ||  // Arabic 2
-             strcmp(utf8, "٣") == 0 ||  // Arabic 3
-             strcmp(utf8, "٤") == 0 ||  // Arabic 4
-             strcmp(utf8, "٥") == 0 ||  // Arabic 5
-             strcmp(utf8, "٦") == 0 ||  // Arabic 6
-             strcmp(utf8, "٧") == 0 ||  // Arabic 7
-             strcmp(utf8, "٨") == 0 ||  // Arabic 8
-             strcmp(utf8, "٩") == 0     // Arabic 9
-    ) {
-        return true;
-    }
-    // English digits
-    else if (strcmp(utf8, "0") == 0 ||  // English 0
-             strcmp(utf8, "1") == 0 ||  // English 1
-             strcmp(utf8, "2") == 0 ||  // English 2
-             strcmp(utf8, "3") == 0 ||  // English 3
-             strcmp(utf8, "4") == 0 ||  // English 4
-             strcmp(utf8, "5") == 0 ||  // English 5
-             strcmp(utf8, "6") == 0 ||  // English 6
-             strcmp(utf8, "7") == 0 ||  // English 7
-             strcmp(utf8, "8") == 0 ||  // English 8
-             strcmp(utf8, "9") == 0     // English 9
-    ) {
-        return true;
+    DEBUG_ME;
+    if (utf8 == NULL || utf8[0] == '\0') {
+        return false;
     }
 
-    return false;
+    size_t index = 0;
+    uint32_t codepoint = utf8_decode(utf8, &index);
+
+    return utf8[index] == '\0' && is_codepoint_digit(codepoint);
 }
 
 /**
@@ -739,12 +815,10 @@ bool is_utf8_digit(char *utf8) {
  */
 char convert_to_english_digit(wchar_t ch) {
     DEBUG_ME;
-    if (is_english_digit(ch)) {
-        return (char)ch;
-    } else if (is_persian_digit(ch)) {
-        return '0' + (ch - 0x06F0);
-    } else if (is_arabic_digit(ch)) {
-        return '0' + (ch - 0x0660);
+    int value = unicode_digit_value(ch);
+
+    if (value >= 0) {
+        return (char)('0' + value);
     }
 
     return ch;
@@ -759,38 +833,19 @@ char convert_to_english_digit(wchar_t ch) {
  *
  */
 char convert_utf8_to_english_digit(char *uc) {
-    if (strcmp(uc, "۰") == 0 || strcmp(uc, "٠") == 0 || strcmp(uc, "0") == 0) {
-        return '0';
-    } else if (strcmp(uc, "۱") == 0 || strcmp(uc, "١") == 0 ||
-               strcmp(uc, "1") == 0) {
-        return '1';
-    } else if (strcmp(uc, "۲") == 0 || strcmp(uc, "٢") == 0 ||
-               strcmp(uc, "2") == 0) {
-        return '2';
-    } else if (strcmp(uc, "۳") == 0 || strcmp(uc, "٣") == 0 ||
-               strcmp(uc, "3") == 0) {
-        return '3';
-    } else if (strcmp(uc, "۴") == 0 || strcmp(uc, "٤") == 0 ||
-               strcmp(uc, "4") == 0) {
-        return '4';
-    } else if (strcmp(uc, "۵") == 0 || strcmp(uc, "٥") == 0 ||
-               strcmp(uc, "5") == 0) {
-        return '5';
-    } else if (strcmp(uc, "۶") == 0 || strcmp(uc, "٦") == 0 ||
-               strcmp(uc, "6") == 0) {
-        return '6';
-    } else if (strcmp(uc, "۷") == 0 || strcmp(uc, "٧") == 0 ||
-               strcmp(uc, "7") == 0) {
-        return '7';
-    } else if (strcmp(uc, "۸") == 0 || strcmp(uc, "٨") == 0 ||
-               strcmp(uc, "8") == 0) {
-        return '8';
-    } else if (strcmp(uc, "۹") == 0 || strcmp(uc, "٩") == 0 ||
-               strcmp(uc, "9") == 0) {
-        return '9';
+    DEBUG_ME;
+    if (uc == NULL || uc[0] == '\0') {
+        return '\0';
+    }
+
+    size_t index = 0;
+    int value = unicode_digit_value(utf8_decode(uc, &index));
+
+    if (value < 0 || uc[index] != '\0') {
+        return '\0';
     }
 
-    return '\0';
+    return (char)('0' + value);
 }
 
 /**
@@ -15,14 +15,13 @@
 #include "base.h"
 #include "lexer.h"
 #include "memory.h"
+#include "number.h"
+#include "unicode.h"
 
 typedef struct {
     size_t capacity;
     size_t length;
     char *data;
-
-    void (*print)(void *);
-    void (*destroy)(void *);
 } string_t;
 
 /**
@@ -110,6 +109,16 @@ void string_print(string_t *str);
  */
 void string_set(string_t *str, string_t *value);
 
+/**
+ *
+ * @function string_clear
+ * @brief Empty a string, keeping its buffer
+ * @params {string_t*} str - String
+ * @returns {void}
+ *
+ */
+void string_clear(string_t *str);
+
 /**
  *
  * @function string_set_str
@@ -132,6 +141,30 @@ void string_set_str(string_t *str, const char *value);
  */
 void string_append(string_t *str, const string_t *value);
 
+/**
+ *
+ * @function string_repeat
+ * @brief Repeat the end of the string, by copying what is already repeated
+ * each time so it takes O(log count) copies
+ * @params {string_t*} str - String
+ * @params {size_t} offset - Start of the end to repeat
+ * @params {size_t} count - Number of copies in total, 0 removes the end
+ * @returns {void}
+ *
+ */
+void string_repeat(string_t *str, size_t offset, size_t count);
+
+/**
+ *
+ * @function string_truncate
+ * @brief Cut the string to a shorter length
+ * @params {string_t*} str - String
+ * @params {size_t} length - New length, at most the current one
+ * @returns {void}
+ *
+ */
+void string_truncate(string_t *str, size_t length);
+
 /**
  *
  * @function string_lower_str
@@ -401,6 +434,26 @@ size_t mb2strlen(const char *identifier);
  */
 bool is_utf8_digit(char *utf8);
 
+/**
+ *
+ * @function is_codepoint_alpha
+ * @brief Check if a decoded codepoint is an alphabet
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool} True if the codepoint is an alphabet, false otherwise
+ *
+ */
+bool is_codepoint_alpha(uint32_t codepoint);
+
+/**
+ *
+ * @function is_codepoint_digit
+ * @brief Check if a decoded codepoint is a Persian/Arabic/English digit
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool} True if the codepoint is a digit, false otherwise
+ *
+ */
+bool is_codepoint_digit(uint32_t codepoint);
+
 /**
  *
  * @function is_utf8_alpha
@@ -475,6 +528,17 @@ string_t *string_create_from(const char *data, size_t start, size_t end);
  */
 char *string_strdup(const char *source);
 
+/**
+ *
+ * @function string_strndup
+ * @brief Duplicate the first `length` bytes of a string (a slice of the source)
+ * @params {const char*} source - Source string
+ * @params {size_t} length - Number of bytes to copy
+ * @returns {char*}
+ *
+ */
+char *string_strndup(const char *source, size_t length);
+
 /**
  *
  * @function my_strcasecmp
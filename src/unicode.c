@@ -0,0 +1,241 @@
+#include "unicode.h"
+
+// Short names to keep the tables readable
+#define _ UNICODE_CLASS_NONE
+#define S (UNICODE_CLASS_IDENTIFIER_START | UNICODE_CLASS_IDENTIFIER_CONTINUE)
+#define C UNICODE_CLASS_IDENTIFIER_CONTINUE
+#define D (UNICODE_CLASS_DIGIT | UNICODE_CLASS_IDENTIFIER_CONTINUE)
+#define W UNICODE_CLASS_WHITESPACE
+
+/**
+ *
+ * @variable unicode_latin1_classes
+ * @brief Classes of the first 256 codepoints (ASCII and Latin-1)
+ * @type {const uint8_t[256]}
+ *
+ */
+const uint8_t unicode_latin1_classes[256] = {
+    _, _, _, _, _, _, _, _, _, W, W, W, W, W, _, _,  // 0x00 - 0x0F
+    _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,  // 0x10 - 0x1F
+    W, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,  // 0x20 - 0x2F
+    D, D, D, D, D, D, D, D, D, D, _, _, _, _, _, _,  // 0x30 - 0x3F
+    _, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,  // 0x40 - 0x4F
+    S, S, S, S, S, S, S, S, S, S, S, _, _, _, _, S,  // 0x50 - 0x5F
+    _, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,  // 0x60 - 0x6F
+    S, S, S, S, S, S, S, S, S, S, S, _, _, _, _, _,  // 0x70 - 0x7F
+    _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,  // 0x80 - 0x8F
+    _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,  // 0x90 - 0x9F
+    _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,  // 0xA0 - 0xAF
+    _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,  // 0xB0 - 0xBF
+    S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,  // 0xC0 - 0xCF
+    S, S, S, S, S, S, S, _, S, S, S, S, S, S, S, S,  // 0xD0 - 0xDF
+    S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,  // 0xE0 - 0xEF
+    S, S, S, S, S, S, S, _, S, S, S, S, S, S, S, S,  // 0xF0 - 0xFF
+};
+
+/**
+ *
+ * @variable unicode_ranges
+ * @brief Classes of the supported blocks above U+00FF, sorted by first
+ * @type {const unicode_range_t[]}
+ *
+ */
+const unicode_range_t unicode_ranges[] = {
+    {0x0100, 0x024F, S},  // Latin Extended-A and B
+    {0x0610, 0x061A, C},  // Arabic signs
+    {0x0620, 0x064A, S},  // Arabic letters
+    {0x064B, 0x065F, C},  // Arabic diacritics
+    {0x0660, 0x0669, D},  // Arabic-Indic digits
+    {0x066E, 0x066F, S},  // Arabic letters
+    {0x0670, 0x0670, C},  // Superscript alef
+    {0x0671, 0x06D3, S},  // Arabic and Persian letters
+    {0x06D5, 0x06D5, S},  // Arabic letter ae
+    {0x06D6, 0x06ED, C},  // Arabic small high marks
+    {0x06EE, 0x06EF, S},  // Arabic letters
+    {0x06F0, 0x06F9, D},  // Persian digits
+    {0x06FA, 0x06FC, S},  // Arabic letters
+    {0x06FF, 0x06FF, S},  // Arabic letter heh with inverted v
+    {0x1E00, 0x1EFF, S},  // Latin Extended Additional
+    {0x200C, 0x200C, C},  // Zero width non-joiner (Persian half-space)
+};
+
+#define UNICODE_RANGES_LENGTH \
+    (sizeof(unicode_ranges) / sizeof(unicode_ranges[0]))
+
+#undef _
+#undef S
+#undef C
+#undef D
+#undef W
+
+/**
+ *
+ * @function unicode_range_find
+ * @brief Binary search the range of a codepoint above U+00FF
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {const unicode_range_t*} NULL if the codepoint is in no range
+ *
+ */
+const unicode_range_t *unicode_range_find(uint32_t codepoint) {
+    DEBUG_ME;
+    size_t low = 0;
+    size_t high = UNICODE_RANGES_LENGTH;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        const unicode_range_t *range = &unicode_ranges[middle];
+
+        if (codepoint < range->first) {
+            high = middle;
+        } else if (codepoint > range->last) {
+            low = middle + 1;
+        } else {
+            return range;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ *
+ * @function unicode_class
+ * @brief Get the class flags of a codepoint, independent of the locale
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {uint8_t} UNICODE_CLASS_* flags
+ *
+ */
+uint8_t unicode_class(uint32_t codepoint) {
+    DEBUG_ME;
+    if (codepoint < 256) {
+        return unicode_latin1_classes[codepoint];
+    }
+
+    const unicode_range_t *range = unicode_range_find(codepoint);
+
+    return range == NULL ? UNICODE_CLASS_NONE : range->classes;
+}
+
+/**
+ *
+ * @function unicode_digit_value
+ * @brief Get the value of an English, Persian or Arabic digit
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {int} 0 to 9, or -1 if the codepoint is not a digit
+ *
+ */
+int unicode_digit_value(uint32_t codepoint) {
+    DEBUG_ME;
+    if (codepoint < 256) {
+        if (unicode_latin1_classes[codepoint] & UNICODE_CLASS_DIGIT) {
+            return (int)(codepoint - '0');
+        }
+
+        return -1;
+    }
+
+    const unicode_range_t *range = unicode_range_find(codepoint);
+
+    // Every digit range starts at its zero
+    if (range != NULL && (range->classes & UNICODE_CLASS_DIGIT)) {
+        return (int)(codepoint - range->first);
+    }
+
+    return -1;
+}
+
+/**
+ *
+ * @function unicode_decode
+ * @brief Decode the UTF-8 character at index and advance past it, never reads
+ * past length and never reports an error
+ * @params {const char*} source - UTF-8 string
+ * @params {size_t} length - Length of the string in bytes
+ * @params {size_t*} index - Index of the current character
+ * @returns {uint32_t} Codepoint, or U+FFFD for an invalid sequence
+ *
+ */
+uint32_t unicode_decode(const char *source, size_t length, size_t *index) {
+    DEBUG_ME;
+    const unsigned char *s = (const unsigned char *)source + *index;
+    size_t left = length - *index;
+    uint32_t codepoint;
+    size_t bytes;
+
+    if (s[0] < 0x80) {
+        codepoint = s[0];
+        bytes = 1;
+    } else if ((s[0] & 0xE0) == 0xC0) {
+        codepoint = s[0] & 0x1F;
+        bytes = 2;
+    } else if ((s[0] & 0xF0) == 0xE0) {
+        codepoint = s[0] & 0x0F;
+        bytes = 3;
+    } else if ((s[0] & 0xF8) == 0xF0) {
+        codepoint = s[0] & 0x07;
+        bytes = 4;
+    } else {
+        *index += 1;
+
+        return 0xFFFD;
+    }
+
+    if (bytes > left) {
+        *index = length;
+
+        return 0xFFFD;
+    }
+
+    for (size_t i = 1; i < bytes; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *index += i;
+
+            return 0xFFFD;
+        }
+
+        codepoint = (codepoint << 6) | (s[i] & 0x3F);
+    }
+
+    *index += bytes;
+
+    return codepoint;
+}
+
+/**
+ *
+ * @function is_codepoint_identifier_start
+ * @brief Check if a codepoint can start an identifier
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool}
+ *
+ */
+bool is_codepoint_identifier_start(uint32_t codepoint) {
+    DEBUG_ME;
+    return (unicode_class(codepoint) & UNICODE_CLASS_IDENTIFIER_START) != 0;
+}
+
+/**
+ *
+ * @function is_codepoint_identifier_continue
+ * @brief Check if a codepoint can appear after the first one of an identifier
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool}
+ *
+ */
+bool is_codepoint_identifier_continue(uint32_t codepoint) {
+    DEBUG_ME;
+    return (unicode_class(codepoint) & UNICODE_CLASS_IDENTIFIER_CONTINUE) != 0;
+}
+
+/**
+ *
+ * @function is_codepoint_whitespace
+ * @brief Check if a codepoint is a whitespace
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool}
+ *
+ */
+bool is_codepoint_whitespace(uint32_t codepoint) {
+    DEBUG_ME;
+    return (unicode_class(codepoint) & UNICODE_CLASS_WHITESPACE) != 0;
+}
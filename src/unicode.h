@@ -0,0 +1,114 @@
+#ifndef _UNICODE_H_
+#define _UNICODE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "base.h"
+
+// Character classes are bit flags, a codepoint can be in more than one class
+#define UNICODE_CLASS_NONE 0
+#define UNICODE_CLASS_IDENTIFIER_START (1 << 0)
+#define UNICODE_CLASS_IDENTIFIER_CONTINUE (1 << 1)
+#define UNICODE_CLASS_DIGIT (1 << 2)
+#define UNICODE_CLASS_WHITESPACE (1 << 3)
+
+typedef struct {
+    uint32_t first;
+    uint32_t last;
+    uint8_t classes;
+} unicode_range_t;
+
+/**
+ *
+ * @variable unicode_latin1_classes
+ * @brief Classes of the first 256 codepoints (ASCII and Latin-1)
+ * @type {const uint8_t[256]}
+ *
+ */
+extern const uint8_t unicode_latin1_classes[256];
+
+/**
+ *
+ * @variable unicode_ranges
+ * @brief Classes of the supported blocks above U+00FF, sorted by first
+ * @type {const unicode_range_t[]}
+ *
+ */
+extern const unicode_range_t unicode_ranges[];
+
+/**
+ *
+ * @function unicode_range_find
+ * @brief Binary search the range of a codepoint above U+00FF
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {const unicode_range_t*} NULL if the codepoint is in no range
+ *
+ */
+const unicode_range_t *unicode_range_find(uint32_t codepoint);
+
+/**
+ *
+ * @function unicode_class
+ * @brief Get the class flags of a codepoint, independent of the locale
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {uint8_t} UNICODE_CLASS_* flags
+ *
+ */
+uint8_t unicode_class(uint32_t codepoint);
+
+/**
+ *
+ * @function unicode_digit_value
+ * @brief Get the value of an English, Persian or Arabic digit
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {int} 0 to 9, or -1 if the codepoint is not a digit
+ *
+ */
+int unicode_digit_value(uint32_t codepoint);
+
+/**
+ *
+ * @function unicode_decode
+ * @brief Decode the UTF-8 character at index and advance past it, never reads
+ * past length and never reports an error
+ * @params {const char*} source - UTF-8 string
+ * @params {size_t} length - Length of the string in bytes
+ * @params {size_t*} index - Index of the current character
+ * @returns {uint32_t} Codepoint, or U+FFFD for an invalid sequence
+ *
+ */
+uint32_t unicode_decode(const char *source, size_t length, size_t *index);
+
+/**
+ *
+ * @function is_codepoint_identifier_start
+ * @brief Check if a codepoint can start an identifier
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool}
+ *
+ */
+bool is_codepoint_identifier_start(uint32_t codepoint);
+
+/**
+ *
+ * @function is_codepoint_identifier_continue
+ * @brief Check if a codepoint can appear after the first one of an identifier
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool}
+ *
+ */
+bool is_codepoint_identifier_continue(uint32_t codepoint);
+
+/**
+ *
+ * @function is_codepoint_whitespace
+ * @brief Check if a codepoint is a whitespace
+ * @params {uint32_t} codepoint - Unicode codepoint
+ * @returns {bool}
+ *
+ */
+bool is_codepoint_whitespace(uint32_t codepoint);
+
+#endif
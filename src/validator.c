@@ -134,84 +134,47 @@ bool has_css_size_prefix(char *css_value, char **css_output_value) {
     size_t num_persian_prefixes =
         sizeof(persian_prefixes) / sizeof(persian_prefixes[0]);
 
-    size_t len = strlen(css_value);
-    if (len == 0) {
-        *css_output_value = NULL;
-
-        return false;
-    }
-
-    string_t *buffer = string_create(len + 1);
-
-    size_t i = 0;
-
-    if (css_value[i] == '-' || css_value[i] == '+') {
-        if (css_value[i] == '-') {
-            string_append_char(buffer, css_value[i]);
-        }
-
-        i++;
-    }
-
-    if (!isdigit(css_value[i])) {
+    number_scan_t scan;
+    if (!number_scan_string(css_value, NUMBER_SCAN_SIGN | NUMBER_SCAN_UNIT,
+                            &scan)) {
         *css_output_value = NULL;
 
-        string_destroy(buffer);
-
         return false;
     }
 
-    bool decimal_point_found = false;
-    while (i < len && (isdigit(css_value[i]) ||
-                       (css_value[i] == '.' && !decimal_point_found))) {
-        if (css_value[i] == '.') {
-            string_append_char(buffer, css_value[i]);
-
-            decimal_point_found = true;
-        } else {
-            string_append_char(buffer, css_value[i]);
-        }
-
-        i++;
-    }
-
-    while (i < len && isspace(css_value[i])) i++;
+    const char *generated_prefix = NULL;
 
-    for (size_t j = 0; j < num_prefixes; j++) {
+    for (size_t j = 0; j < num_prefixes && generated_prefix == NULL; j++) {
         size_t prefix_len = strlen(prefixes[j]);
 
-        if (len - i == prefix_len &&
-            strncmp(css_value + i, prefixes[j], prefix_len) == 0) {
-            string_append_str(buffer, generated_prefixes[j]);
-
-            *css_output_value = string_strdup(buffer->data);
-
-            string_destroy(buffer);
-
-            return true;
+        if (scan.unit_length == prefix_len &&
+            strncmp(scan.unit, prefixes[j], prefix_len) == 0) {
+            generated_prefix = generated_prefixes[j];
         }
     }
 
-    for (size_t j = 0; j < num_persian_prefixes; j++) {
+    for (size_t j = 0; j < num_persian_prefixes && generated_prefix == NULL;
+         j++) {
         size_t prefix_len = strlen(persian_prefixes[j]);
 
-        if (len - i == prefix_len &&
-            strncmp(css_value + i, persian_prefixes[j], prefix_len) == 0) {
-            string_append_str(buffer, generated_prefixes[j]);
-
-            *css_output_value = string_strdup(buffer->data);
-
-            string_destroy(buffer);
-
-            return true;
+        if (scan.unit_length == prefix_len &&
+            strncmp(scan.unit, persian_prefixes[j], prefix_len) == 0) {
+            generated_prefix = generated_prefixes[j];
         }
     }
 
-    *css_output_value = NULL;
+    if (generated_prefix == NULL) {
+        *css_output_value = NULL;
+
+        return false;
+    }
 
-    string_destroy(buffer);
+    // Digits are written back in English, e.g. "۱۲ پیکسل" becomes "12px"
+    size_t size = scan.text_length + strlen(generated_prefix) + 1;
+    *css_output_value = memory_allocate(size);
+    snprintf(*css_output_value, size, "%s%s", scan.text, generated_prefix);
 
-    return false;
+    return true;
 }
 
 /**
@@ -270,10 +233,10 @@ char *attribute_css_size_value(char *attribute_value) {
  */
 void validate_layout_block(ast_layout_block_t *block) {
     DEBUG_ME;
-    hashmap_layout_attribute_t *attributes = block->attributes;
+    enum_map_layout_attribute_t *attributes = block->attributes;
 
     ast_layout_attribute_t *attribute_content =
-        hashmap_get(attributes, "content");
+        enum_map_get(attributes, AST_LAYOUT_ATTRIBUTE_TYPE_CONTENT);
 
     if (attribute_content != NULL) {
         attribute_content->isContent = true;
@@ -281,15 +244,14 @@ void validate_layout_block(ast_layout_block_t *block) {
         array_value_t *values = attribute_content->values;
 
         if (values->length > 0) {
-            char *content = array_value_stringify(values, ", ");
+            char *content =
+                array_value_stringify_arena(block->arena, values, ", ");
 
             if (content != NULL) {
                 if (strlen(content) > 0) {
                     block->text_content = content;
                 } else {
-                    if (content != NULL) {
-                        memory_destroy(content);
-                    }
+                    salam_arena_free(block->arena, content);
                 }
             }
         }
@@ -336,7 +298,7 @@ bool token_belongs_to_ast_layout_node(
     // value attribute for input tag
     if ((attribute->parent_node_type == AST_LAYOUT_TYPE_INPUT) &&
         (attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_CONTENT)) {
-        attribute->final_key = string_strdup("value");
+        ast_layout_attribute_set_final_key(attribute, "value");
         return true;
     } else if (is_layout_node_a_single_tag(attribute->parent_node_type) &&
                attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_CONTENT) {
@@ -435,14 +397,15 @@ bool token_belongs_to_ast_layout_node(
 
         if (is_attribute_type_in_array(attribute_key_type, valid_attributes,
                                        valid_attributes_length)) {
-            attribute->final_key = string_strdup(
+            ast_layout_attribute_set_final_key(
+                attribute,
                 generator_code_layout_attribute_name(attribute_key_type));
 
             // name
             if (attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_NAME) {
                 ast_value_t *value = attribute->values->data[0];
 
-                if (value->type->kind == AST_TYPE_KIND_STRING &&
+                if (value->type.kind == AST_TYPE_KIND_STRING &&
                     strlen(value->data.string_value) == 0) {
                     error_validator(2,
                                     "Invalid value for attribute '%s' in '%s' "
@@ -456,11 +419,7 @@ bool token_belongs_to_ast_layout_node(
                     return false;
                 }
 
-                if (attribute->final_key != NULL) {
-                    memory_destroy(attribute->final_key);
-                }
-
-                attribute->final_key = string_strdup("font-family");
+                ast_layout_attribute_set_final_key(attribute, "font-family");
 
                 return true;
             }
@@ -471,7 +430,7 @@ bool token_belongs_to_ast_layout_node(
                 for (size_t i = 0; i < attribute->values->length; i++) {
                     ast_value_t *value = attribute->values->data[i];
 
-                    if (value->type->kind == AST_TYPE_KIND_STRING) {
+                    if (value->type.kind == AST_TYPE_KIND_STRING) {
                         char *out_extension = NULL;
 
                         if (has_font_extension(value->data.string_value,
@@ -514,11 +473,7 @@ bool token_belongs_to_ast_layout_node(
                     }
                 }
 
-                if (attribute->final_value != NULL) {
-                    memory_destroy(attribute->final_value);
-                }
-
-                attribute->final_value = string_strdup(buffer->data);
+                ast_layout_attribute_set_final_value(attribute, buffer->data);
 
                 string_destroy(buffer);
 
@@ -635,15 +590,11 @@ bool token_belongs_to_ast_layout_node(
                                        valid_attributes_length)) {
             // rename src to href
             if (attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_SRC) {
-                if (attribute->final_key != NULL) {
-                    memory_destroy(attribute->final_key);
-                }
-
                 if (attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_TYPE) {
-                    attribute->final_key = string_strdup("target");
+                    ast_layout_attribute_set_final_key(attribute, "target");
                 } else if (attribute_key_type ==
                            AST_LAYOUT_ATTRIBUTE_TYPE_SRC) {
-                    attribute->final_key = string_strdup("href");
+                    ast_layout_attribute_set_final_key(attribute, "href");
                 }
 
                 return true;
@@ -676,14 +627,10 @@ bool token_belongs_to_ast_layout_node(
 
         if (is_attribute_type_in_array(attribute_key_type, valid_attributes,
                                        valid_attributes_length)) {
-            if (attribute->final_key != NULL) {
-                memory_destroy(attribute->final_key);
-            }
-
             if (attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_TYPE) {
-                attribute->final_key = string_strdup("method");
+                ast_layout_attribute_set_final_key(attribute, "method");
             } else if (attribute_key_type == AST_LAYOUT_ATTRIBUTE_TYPE_SRC) {
-                attribute->final_key = string_strdup("action");
+                ast_layout_attribute_set_final_key(attribute, "action");
             }
 
             return true;
@@ -752,26 +699,16 @@ void validate_layout_mainbody(ast_layout_block_t *block) {
     DEBUG_ME;
     if (block != NULL) {
         if (block->attributes != NULL) {
-            if (block->attributes->data != NULL) {
-                size_t attributes_capacity = block->attributes->capacity;
-
-                for (size_t i = 0; i < attributes_capacity; i++) {
-                    hashmap_entry_t *entry = block->attributes->data[i];
-
-                    while (entry) {
-                        char *attribute_key = entry->key;
-                        ast_layout_attribute_type_t attribute_key_type =
-                            name_to_ast_layout_attribute_type(attribute_key);
-                        ast_layout_attribute_t *attribute_value = entry->value;
-
-                        if (is_attribute_type_in_array(
-                                attribute_key_type, valid_layout_attributes,
-                                valid_layout_attributes_length)) {
-                            attribute_value->ignoreMe = true;
-                        }
+            size_t attributes_length = block->attributes->length;
 
-                        entry = cast(hashmap_entry_t *, entry->next);
-                    }
+            for (size_t i = 0; i < attributes_length; i++) {
+                ast_layout_attribute_t *attribute_value =
+                    block->attributes->data[i];
+
+                if (is_attribute_type_in_array(
+                        attribute_value->type, valid_layout_attributes,
+                        valid_layout_attributes_length)) {
+                    attribute_value->ignoreMe = true;
                 }
             }
         }
@@ -827,8 +764,8 @@ bool is_attribute_type_a_style(ast_layout_attribute_type_t type) {
  *
  * @function validate_style_value_string
  * @brief Validate the style value string
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -838,7 +775,8 @@ bool is_attribute_type_a_style(ast_layout_attribute_type_t type) {
  *
  */
 bool validate_style_value_string(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -854,7 +792,7 @@ bool validate_style_value_string(
 
     ast_value_t *first = attribute->values->data[0];
 
-    if (first->type->kind == AST_TYPE_KIND_STRING) {
+    if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -866,8 +804,8 @@ bool validate_style_value_string(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -880,8 +818,8 @@ bool validate_style_value_string(
 
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -897,8 +835,8 @@ bool validate_style_value_string(
  *
  * @function validate_style_value_sizes_colors
  * @brief Validate the style values color or size
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -908,7 +846,8 @@ bool validate_style_value_string(
  *
  */
 bool validate_style_value_sizes_colors(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -931,8 +870,8 @@ bool validate_style_value_sizes_colors(
  *
  * @function validate_style_value_colors
  * @brief Validate the style values color
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -942,7 +881,8 @@ bool validate_style_value_sizes_colors(
  *
  */
 bool validate_style_value_colors(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -962,8 +902,8 @@ bool validate_style_value_colors(
  *
  * @function validate_style_value_color
  * @brief Validate the style value color
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -973,7 +913,8 @@ bool validate_style_value_colors(
  *
  */
 bool validate_style_value_color(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -989,7 +930,7 @@ bool validate_style_value_color(
 
     ast_value_t *first = attribute->values->data[0];
 
-    if (first->type->kind == AST_TYPE_KIND_STRING) {
+    if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -1003,8 +944,8 @@ bool validate_style_value_color(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -1016,8 +957,8 @@ bool validate_style_value_color(
             size_t i = 0;
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -1033,8 +974,8 @@ bool validate_style_value_color(
  *
  * @function validate_style_value_integer
  * @brief Validate the style value integer
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -1044,7 +985,8 @@ bool validate_style_value_color(
  *
  */
 bool validate_style_value_integer(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -1055,22 +997,24 @@ bool validate_style_value_integer(
 
     ast_value_t *first = attribute->values->data[0];
 
-    if (first->type->kind == AST_TYPE_KIND_INT) {
-        attribute->final_value = memory_allocate(20 * sizeof(char));
-        snprintf(attribute->final_value, 20, "%d", first->data.int_value);
+    if (first->type.kind == AST_TYPE_KIND_INT) {
+        char buffer[20];
+        snprintf(buffer, sizeof(buffer), "%d", first->data.int_value);
+        ast_layout_attribute_set_final_value(attribute, buffer);
 
         return true;
-    } else if (first->type->kind == AST_TYPE_KIND_FLOAT) {
+    } else if (first->type.kind == AST_TYPE_KIND_FLOAT) {
         if (first->data.float_value == (int)first->data.float_value) {
-            attribute->final_value = memory_allocate(20 * sizeof(char));
-            snprintf(attribute->final_value, 20, "%d",
+            char buffer[20];
+            snprintf(buffer, sizeof(buffer), "%d",
                      (int)first->data.float_value);
+            ast_layout_attribute_set_final_value(attribute, buffer);
 
             return true;
         }
 
         return false;
-    } else if (first->type->kind == AST_TYPE_KIND_STRING) {
+    } else if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -1082,8 +1026,8 @@ bool validate_style_value_integer(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -1097,8 +1041,8 @@ bool validate_style_value_integer(
 
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -1121,8 +1065,8 @@ bool validate_style_value_integer(
  *
  * @function validate_style_value_number
  * @brief Validate the style value number
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -1132,7 +1076,8 @@ bool validate_style_value_integer(
  *
  */
 bool validate_style_value_number(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -1143,11 +1088,11 @@ bool validate_style_value_number(
 
     ast_value_t *first = attribute->values->data[0];
 
-    if (first->type->kind == AST_TYPE_KIND_INT) {
+    if (first->type.kind == AST_TYPE_KIND_INT) {
         return true;
-    } else if (first->type->kind == AST_TYPE_KIND_FLOAT) {
+    } else if (first->type.kind == AST_TYPE_KIND_FLOAT) {
         return true;
-    } else if (first->type->kind == AST_TYPE_KIND_STRING) {
+    } else if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -1159,8 +1104,8 @@ bool validate_style_value_number(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -1174,8 +1119,8 @@ bool validate_style_value_number(
 
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -1198,8 +1143,8 @@ bool validate_style_value_number(
  *
  * @function validate_style_value_float
  * @brief Validate the style value float
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -1209,7 +1154,8 @@ bool validate_style_value_number(
  *
  */
 bool validate_style_value_float(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -1220,11 +1166,11 @@ bool validate_style_value_float(
 
     ast_value_t *first = attribute->values->data[0];
 
-    if (first->type->kind == AST_TYPE_KIND_INT) {
+    if (first->type.kind == AST_TYPE_KIND_INT) {
         return false;
-    } else if (first->type->kind == AST_TYPE_KIND_FLOAT) {
+    } else if (first->type.kind == AST_TYPE_KIND_FLOAT) {
         return true;
-    } else if (first->type->kind == AST_TYPE_KIND_STRING) {
+    } else if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -1236,8 +1182,8 @@ bool validate_style_value_float(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -1251,8 +1197,8 @@ bool validate_style_value_float(
 
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -1275,8 +1221,8 @@ bool validate_style_value_float(
  *
  * @function validate_style_value_percentage
  * @brief Validate the style value percentage
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -1286,7 +1232,8 @@ bool validate_style_value_float(
  *
  */
 bool validate_style_value_percentage(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -1297,7 +1244,7 @@ bool validate_style_value_percentage(
 
     ast_value_t *first = attribute->values->data[0];
 
-    if (first->type->kind == AST_TYPE_KIND_INT) {
+    if (first->type.kind == AST_TYPE_KIND_INT) {
         if (first->data.int_value <= 0 || first->data.int_value >= 100) {
             error_validator(2,
                             "Percentage value must be between 0 and 100 "
@@ -1311,13 +1258,14 @@ bool validate_style_value_percentage(
 
             return false;
         } else {
-            attribute->final_value = memory_allocate(20 * sizeof(char));
-            snprintf(attribute->final_value, 20, "%.2f",
+            char buffer[20];
+            snprintf(buffer, sizeof(buffer), "%.2f",
                      first->data.int_value / 100.0);
+            ast_layout_attribute_set_final_value(attribute, buffer);
 
             return true;
         }
-    } else if (first->type->kind == AST_TYPE_KIND_FLOAT) {
+    } else if (first->type.kind == AST_TYPE_KIND_FLOAT) {
         if (first->data.float_value <= 0 || first->data.float_value >= 1) {
             error_validator(2,
                             "Percentage value must be between 0 and 100 "
@@ -1331,13 +1279,13 @@ bool validate_style_value_percentage(
 
             return false;
         } else {
-            attribute->final_value = memory_allocate(20 * sizeof(char));
-            snprintf(attribute->final_value, 20, "%.2f",
-                     first->data.float_value);
+            char buffer[20];
+            snprintf(buffer, sizeof(buffer), "%.2f", first->data.float_value);
+            ast_layout_attribute_set_final_value(attribute, buffer);
 
             return true;
         }
-    } else if (first->type->kind == AST_TYPE_KIND_STRING) {
+    } else if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -1349,8 +1297,8 @@ bool validate_style_value_percentage(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -1364,8 +1312,8 @@ bool validate_style_value_percentage(
 
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -1384,8 +1332,8 @@ bool validate_style_value_percentage(
  *
  * @function validate_style_value_size
  * @brief Validate the style value size
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -1395,7 +1343,8 @@ bool validate_style_value_percentage(
  *
  */
 bool validate_style_value_size(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2) {
     DEBUG_ME;
@@ -1409,17 +1358,19 @@ bool validate_style_value_size(
     }
 
     ast_value_t *first = attribute->values->data[0];
-    if (first->type->kind == AST_TYPE_KIND_INT) {
-        attribute->final_value = memory_allocate(20 * sizeof(char));
-        snprintf(attribute->final_value, 20, "%dpx", first->data.int_value);
+    if (first->type.kind == AST_TYPE_KIND_INT) {
+        char buffer[20];
+        snprintf(buffer, sizeof(buffer), "%dpx", first->data.int_value);
+        ast_layout_attribute_set_final_value(attribute, buffer);
 
         return true;
-    } else if (first->type->kind == AST_TYPE_KIND_FLOAT) {
-        attribute->final_value = memory_allocate(20 * sizeof(char));
-        snprintf(attribute->final_value, 20, "%fpx", first->data.float_value);
+    } else if (first->type.kind == AST_TYPE_KIND_FLOAT) {
+        char buffer[20];
+        snprintf(buffer, sizeof(buffer), "%fpx", first->data.float_value);
+        ast_layout_attribute_set_final_value(attribute, buffer);
 
         return true;
-    } else if (first->type->kind == AST_TYPE_KIND_STRING) {
+    } else if (first->type.kind == AST_TYPE_KIND_STRING) {
         char *value = first->data.string_value;
 
         if (strlen(value) == 0) {
@@ -1431,8 +1382,8 @@ bool validate_style_value_size(
 
             while (allowed_values2[i].input != NULL) {
                 if (strcmp(value, allowed_values2[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values2[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values2[i].output);
 
                     return true;
                 }
@@ -1446,8 +1397,8 @@ bool validate_style_value_size(
 
             while (allowed_values1[i].input != NULL) {
                 if (strcmp(value, allowed_values1[i].input) == 0) {
-                    attribute->final_value =
-                        string_strdup(allowed_values1[i].output);
+                    ast_layout_attribute_set_final_value(
+                        attribute, allowed_values1[i].output);
 
                     return true;
                 }
@@ -1469,11 +1420,7 @@ bool validate_style_value_size(
             return false;
         }
 
-        if (attribute->final_value != NULL) {
-            memory_destroy(attribute->final_value);
-        }
-
-        attribute->final_value = string_strdup(out_value);
+        ast_layout_attribute_set_final_value(attribute, out_value);
 
         memory_destroy(buffer);
         memory_destroy(out_value);
@@ -1488,8 +1435,8 @@ bool validate_style_value_size(
  *
  * @function validate_style_value_sizes
  * @brief Validate the style values size
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 -
  * Allowed values 1
@@ -1500,7 +1447,8 @@ bool validate_style_value_size(
  *
  */
 bool validate_style_value_sizes(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2, bool length_124) {
     DEBUG_ME;
@@ -1527,13 +1475,14 @@ bool validate_style_value_sizes(
  *
  * @function validate_style_value
  * @brief Validate the style value
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @returns {bool} - True if the style value is valid, false otherwise
  *
  */
-bool validate_style_value(hashmap_t *styles, hashmap_t *new_styles,
+bool validate_style_value(enum_map_layout_attribute_t *styles,
+                          enum_map_layout_attribute_t *new_styles,
                           ast_layout_attribute_t *attribute) {
     DEBUG_ME;
     ast_value_t *first = attribute->values->data[0];
@@ -1545,7 +1494,7 @@ bool validate_style_value(hashmap_t *styles, hashmap_t *new_styles,
             ast_layout_node_type_to_enduser_name(attribute->parent_node_type));
 
         return false;
-    } else if (first->type->kind == AST_TYPE_KIND_STRING &&
+    } else if (first->type.kind == AST_TYPE_KIND_STRING &&
                strlen(first->data.string_value) == 0) {
         error_validator(
             2,
@@ -1560,7 +1509,7 @@ bool validate_style_value(hashmap_t *styles, hashmap_t *new_styles,
         return false;
     }
     // Global values
-    else if (first->type->kind == AST_TYPE_KIND_STRING &&
+    else if (first->type.kind == AST_TYPE_KIND_STRING &&
              attribute->values->length == 1) {
         if (false) {
         }
@@ -1594,7 +1543,7 @@ bool validate_style_value(hashmap_t *styles, hashmap_t *new_styles,
                                         GENERATED_NAME, FILTER,                \
                                         ALLOWED_VALUES, SUBTAGS)               \
     case TYPE: {                                                               \
-        attribute->final_key = string_strdup(GENERATED_NAME);                  \
+        ast_layout_attribute_set_final_key(attribute, GENERATED_NAME);         \
         const ast_layout_attribute_style_pair_t *values = ALLOWED_VALUES;      \
                                                                                \
         if (FILTER == AST_LAYOUY_ATTRIBUTE_STYLE_FILTER_COLOR) {               \
@@ -1619,8 +1568,8 @@ bool validate_style_value(hashmap_t *styles, hashmap_t *new_styles,
                                                                                \
             return true;                                                       \
         } else if (FILTER == AST_LAYOUY_ATTRIBUTE_STYLE_FILTER_STRINGS_ANY) {  \
-            attribute->final_value =                                           \
-                array_value_stringify(attribute->values, ",");                 \
+            attribute->final_value = array_value_stringify_arena(              \
+                attribute->arena, attribute->values, ",");                     \
                                                                                \
             return true;                                                       \
         } else if (FILTER == AST_LAYOUY_ATTRIBUTE_STYLE_FILTER_SIZE) {         \
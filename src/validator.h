@@ -9,9 +9,10 @@
 #include "array_custom.h"
 #include "ast.h"
 #include "base.h"
+#include "enum_map.h"
+#include "enum_map_custom.h"
 #include "generator.h"
 #include "hashmap.h"
-#include "hashmap_custom.h"
 #include "parser.h"
 #include "string_buffer.h"
 
@@ -118,13 +119,14 @@ bool is_style_attribute(ast_layout_attribute_type_t type);
  *
  * @function validate_style_value
  * @brief Validate the style value
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @returns {bool} - True if the style value is valid, false otherwise
  *
  */
-bool validate_style_value(hashmap_t *styles, hashmap_t *new_styles,
+bool validate_style_value(enum_map_layout_attribute_t *styles,
+                          enum_map_layout_attribute_t *new_styles,
                           ast_layout_attribute_t *attribute);
 
 /**
@@ -162,8 +164,8 @@ char *attribute_css_size_value(char *attribute_value);
  *
  * @function validate_style_value_sizes
  * @brief Validate the style values size
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -173,7 +175,8 @@ char *attribute_css_size_value(char *attribute_value);
  *
  */
 bool validate_style_value_sizes(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2, bool length_124);
 
@@ -181,8 +184,8 @@ bool validate_style_value_sizes(
  *
  * @function validate_style_value_color
  * @brief Validate the style value color
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -192,7 +195,8 @@ bool validate_style_value_sizes(
  *
  */
 bool validate_style_value_color(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -200,8 +204,8 @@ bool validate_style_value_color(
  *
  * @function validate_style_value_size
  * @brief Validate the style value size
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -211,7 +215,8 @@ bool validate_style_value_color(
  *
  */
 bool validate_style_value_size(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -219,8 +224,8 @@ bool validate_style_value_size(
  *
  * @function validate_style_value_size_color
  * @brief Validate the style value size or color
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -230,7 +235,8 @@ bool validate_style_value_size(
  *
  */
 bool validate_style_value_size_color(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -238,8 +244,8 @@ bool validate_style_value_size_color(
  *
  * @function validate_style_value_string
  * @brief Validate the style value string
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -249,7 +255,8 @@ bool validate_style_value_size_color(
  *
  */
 bool validate_style_value_string(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -257,8 +264,8 @@ bool validate_style_value_string(
  *
  * @function validate_style_value_percentage
  * @brief Validate the style value percentage
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -268,7 +275,8 @@ bool validate_style_value_string(
  *
  */
 bool validate_style_value_percentage(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -276,8 +284,8 @@ bool validate_style_value_percentage(
  *
  * @function validate_style_value_integer
  * @brief Validate the style value integer
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -287,7 +295,8 @@ bool validate_style_value_percentage(
  *
  */
 bool validate_style_value_integer(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -295,8 +304,8 @@ bool validate_style_value_integer(
  *
  * @function validate_style_value_sizes_colors
  * @brief Validate the style values color or size
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -306,7 +315,8 @@ bool validate_style_value_integer(
  *
  */
 bool validate_style_value_sizes_colors(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -314,8 +324,8 @@ bool validate_style_value_sizes_colors(
  *
  * @function validate_style_value_float
  * @brief Validate the style value float
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -325,7 +335,8 @@ bool validate_style_value_sizes_colors(
  *
  */
 bool validate_style_value_float(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -333,8 +344,8 @@ bool validate_style_value_float(
  *
  * @function validate_style_value_number
  * @brief Validate the style value number
- * @params {hashmap_t*} styles - Styles
- * @params {hashmap_t*} new_styles - New styles
+ * @params {enum_map_layout_attribute_t*} styles - Styles
+ * @params {enum_map_layout_attribute_t*} new_styles - New styles
  * @params {ast_layout_attribute_t*} attribute - Layout attribute
  * @params {const ast_layout_attribute_style_pair_t*} allowed_values1 - Allowed
  * values 1
@@ -344,7 +355,8 @@ bool validate_style_value_float(
  *
  */
 bool validate_style_value_number(
-    hashmap_t *styles, hashmap_t *new_styles, ast_layout_attribute_t *attribute,
+    enum_map_layout_attribute_t *styles,
+    enum_map_layout_attribute_t *new_styles, ast_layout_attribute_t *attribute,
     const ast_layout_attribute_style_pair_t *allowed_values1,
     const ast_layout_attribute_style_pair_t *allowed_values2);
 
@@ -0,0 +1,63 @@
+import sys
+import struct
+from pathlib import Path
+
+# Writes corrupted copies of a precompiled AST, see src/ast_binary.h. Every
+# copy changes one word of the file, but truncated.salamc which is missing
+# its last word. Records start with their type and refer to each other by
+# offset, a field is read as the word at its index in the record
+
+source = bytes(Path(sys.argv[1]).read_bytes())
+out_dir = Path(sys.argv[2])
+
+
+def word(offset, index):
+    return struct.unpack_from("<I", source, offset + index * 4)[0]
+
+
+def corrupt(name, offset, index, value):
+    data = bytearray(source)
+    struct.pack_into("<I", data, offset + index * 4, value)
+    (out_dir / (name + ".salamc")).write_bytes(data)
+
+
+# Header: magic (2 words), version, size, layout, functions
+root = word(0, 4)
+
+# Block: record, type, parent_type, parent_node_type, text_content,
+# attributes, styles, new_styles, states, children, meta_children
+# List: record, length, items; map: record, length, key and item pairs
+# Layout node: record, type, block
+node = word(word(root, 9), 2)
+block = word(node, 2)
+attributes = word(block, 5)
+styles = word(block, 6)
+states = word(block, 8)
+
+# Attribute: record, type, parent_node_type, flags, key, final_key,
+# final_value, values. Value: record, kind, location (6 words), data
+attribute = word(attributes, 3)
+values = word(attribute, 7)
+value = word(values, 2)
+
+(out_dir / "truncated.salamc").write_bytes(source[:-4])
+
+# The child node refers back to the root block
+corrupt("looping", node, 2, root)
+
+# A string value without its text
+corrupt("no-string", value, 8, 0)
+
+# An attribute without values
+corrupt("no-values", values, 1, 0)
+
+# The values of an attribute are its key string
+corrupt("wrong-record", attribute, 7, word(attribute, 4))
+
+# Stored enums out of their range
+corrupt("value-kind", value, 1, 0xFFFF)
+corrupt("attribute-type", attribute, 1, 0xFFFF)
+corrupt("style-type", styles, 2, 0xFFFF)
+corrupt("state-type", states, 2, 0xFFFF)
+corrupt("node-type", node, 1, 0xFFFF)
+corrupt("block-type", block, 1, 0xFFFF)
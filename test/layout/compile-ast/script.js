@@ -0,0 +1,6 @@
+function سلام(){
+if ("درست") {
+console.log(2.500000);
+}
+return(3);
+}
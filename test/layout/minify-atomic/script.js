@@ -0,0 +1 @@
+function سلام(){if("درست"){console.log(2.5);}return(3);}
\ No newline at end of file
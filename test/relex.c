@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lexer.h"
+#include "memory.h"
+
+// An edit applied with lexer_relex, the tokens must be the tokens of the
+// edited source lexed from scratch
+typedef struct {
+    const char *name;
+    const char *at;  // the edit is where this is first found, NULL at the end
+    const char *deleted;  // text removed there
+    const char *inserted;  // text inserted there
+} relex_case_t;
+
+static const char layout[] =
+    "صفحه:\n"
+    "    جعبه:\n"
+    "        رنگ = \"قرمز\" // رنگ متن\n"
+    "        عرض = 120\n"
+    "    تمام\n"
+    "تمام\n";
+
+static const relex_case_t cases[] = {
+    {"insert in an identifier", "به:", "", "ها"},
+    {"delete a whole line", "        رنگ",
+     "        رنگ = \"قرمز\" // رنگ متن\n", ""},
+    {"replace a number", "120", "120", "7.5"},
+    {"grow a string", "\"قرمز\"", "\"قرمز\"", "\"سبز و آبی\""},
+    {"start a comment", "        عرض", "", "// "},
+    {"end a comment", " // رنگ متن", " // رنگ متن", ""},
+    {"insert lines at the start", layout, "", "\n\n"},
+    {"append at the end", NULL, "", "// پایان\n"},
+    {"delete everything", layout, layout, ""},
+};
+
+/**
+ *
+ * @function relex_compare
+ * @brief Compare the source and tokens of a relexed lexer to the tokens of a
+ * source lexed from scratch
+ * @params {const char*} name - Name of the case
+ * @params {lexer_t*} relexed - Lexer updated with lexer_relex
+ * @params {const char*} source - Expected source
+ * @params {size_t} length - Length of the expected source
+ * @returns {bool} - Whether the tokens are the same
+ *
+ */
+bool relex_compare(const char *name, lexer_t *relexed, const char *source,
+                   size_t length) {
+    lexer_t *lexed = lexer_create("relex", source, length);
+    lexer_lex(lexed);
+
+    bool same = relexed->source_length == length &&
+                memcmp(relexed->source, source, length) == 0;
+
+    if (!same) {
+        printf("FAIL %s: the source is not the edited source\n", name);
+    } else if (relexed->tokens_length != lexed->tokens_length) {
+        printf("FAIL %s: %zu tokens instead of %zu\n", name,
+               relexed->tokens_length, lexed->tokens_length);
+
+        same = false;
+    }
+
+    for (size_t i = 0; same && i < lexed->tokens_length; i++) {
+        token_t *a = &relexed->tokens[i];
+        token_t *b = &lexed->tokens[i];
+
+        if (a->type != b->type || a->offset != b->offset ||
+            a->length != b->length || a->line != b->line ||
+            a->column != b->column) {
+            printf("FAIL %s: token %zu is %s at %u:%u instead of %s at %u:%u\n",
+                   name, i, token_name(a->type), a->line, a->column,
+                   token_name(b->type), b->line, b->column);
+
+            same = false;
+        }
+    }
+
+    lexer_destroy(lexed);
+
+    return same;
+}
+
+/**
+ *
+ * @function relex_check
+ * @brief Apply the edit of a case with lexer_relex and compare the tokens to
+ * the tokens of the edited source, then undo it on the same lexer, which
+ * edits the source it owns in place, and compare with the layout
+ * @params {const relex_case_t*} test - Case
+ * @returns {bool} - Whether the tokens are the same
+ *
+ */
+bool relex_check(const relex_case_t *test) {
+    size_t source_length = strlen(layout);
+    size_t offset = source_length;
+
+    if (test->at != NULL) {
+        offset = (size_t)(strstr(layout, test->at) - layout);
+    }
+
+    size_t deleted = strlen(test->deleted);
+    size_t inserted = strlen(test->inserted);
+    size_t length = source_length - deleted + inserted;
+
+    if (strncmp(layout + offset, test->deleted, deleted) != 0) {
+        printf("FAIL %s: the deleted text is not in the source\n",
+               test->name);
+
+        return false;
+    }
+
+    char *edited = memory_allocate(length + 1);
+    memcpy(edited, layout, offset);
+    memcpy(edited + offset, test->inserted, inserted);
+    memcpy(edited + offset + inserted, layout + offset + deleted,
+           source_length - offset - deleted);
+    edited[length] = '\0';
+
+    lexer_t *relexed = lexer_create("relex", layout, source_length);
+    lexer_lex(relexed);
+    lexer_relex(relexed, offset, deleted, test->inserted);
+
+    bool same = relex_compare(test->name, relexed, edited, length);
+
+    if (same) {
+        lexer_relex(relexed, offset, inserted, test->deleted);
+
+        same = relex_compare(test->name, relexed, layout, source_length);
+    }
+
+    if (same) {
+        printf("PASS %s\n", test->name);
+    }
+
+    lexer_destroy(relexed);
+    memory_destroy(edited);
+
+    return same;
+}
+
+int main(void) {
+    size_t failed = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (!relex_check(&cases[i])) {
+            failed++;
+        }
+    }
+
+    return failed == 0 ? 0 : 1;
+}
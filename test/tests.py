@@ -1,8 +1,13 @@
 import os
+import sys
+import shlex
+import shutil
 import filecmp
+import tempfile
+import subprocess
 from pathlib import Path
 
-salam_bin = "/mnt/c/Users/MAX/Salam/src/main"
+salam_bin = os.environ.get("SALAM_BIN", "/mnt/c/Users/MAX/Salam/src/main")
 
 total_tests = 0
 passed_tests = 0
@@ -15,16 +20,61 @@ COLOR_RED = "\033[91m"
 COLOR_BLUE = "\033[94m"
 
 
+def run_commands(directory, command_file, output_dir):
+    # Every line of command.txt is a command run in the output directory,
+    # "salam" is the binary under test and $TMP a scratch directory. What the
+    # commands print and their exit codes are compared as stdout.txt
+    output = ""
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        for line in command_file.read_text(encoding="utf-8").splitlines():
+            if not line.strip() or line.startswith("#"):
+                continue
+
+            args = shlex.split(line.replace("$TMP", tmp_dir))
+
+            if args[0] == "salam":
+                args[0] = salam_bin
+            elif args[0] == "python3":
+                args[0] = sys.executable
+
+            result = subprocess.run(
+                args, stdout=subprocess.PIPE, stderr=subprocess.PIPE
+            )
+
+            output += f"$ {line}\n"
+            output += result.stdout.decode("utf-8", "replace")
+            output += result.stderr.decode("utf-8", "replace")
+            output += f"exit {result.returncode}\n"
+
+        # Paths are printed as given or made canonical
+        output = output.replace(os.path.realpath(tmp_dir), "$TMP")
+        output = output.replace(tmp_dir, "$TMP")
+
+    output = output.replace(os.path.realpath(directory), "$DIR")
+
+    (output_dir / "stdout.txt").write_text(output, encoding="utf-8")
+
+
 def run_tests_in_directory(directory):
     output_dir = directory / "output"
 
     if "output" in directory.parts:
         return
 
-    output_dir.mkdir(exist_ok=True)
+    # Files left by an earlier run would hide a missing one
+    if output_dir.exists():
+        shutil.rmtree(output_dir)
+
+    output_dir.mkdir()
 
     os.chdir(output_dir)
 
+    command_file = directory / "command.txt"
+    if command_file.exists():
+        run_commands(directory, command_file, output_dir)
+        return
+
     parent_layout_file = directory / "layout.salam"
     if parent_layout_file.exists():
         os.system(f"{salam_bin} {parent_layout_file} > /dev/null 2>&1")
@@ -93,3 +143,5 @@ if __name__ == "__main__":
     print(f"{COLOR_GREEN}Passed test cases: {passed_tests}{COLOR_RESET}")
     print(f"{COLOR_RED}Failed test cases: {failed_tests}{COLOR_RESET}")
     print(f"{COLOR_BLUE}Warnings: {warnings}{COLOR_RESET}")
+
+    sys.exit(1 if failed_tests > 0 else 0)